@@ -0,0 +1,129 @@
+/*!
+ * \file   benchmarks/BenchmarkSuite.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <ctime>
+#include <chrono>
+#include <thread>
+#include <iomanip>
+#include <ostream>
+#include "BenchmarkSuite.hxx"
+
+namespace mgis::benchmarks {
+
+  /*!
+   * \brief escape a string for the JSON format
+   * \param[in] s: string
+   */
+  static std::string escape(const std::string& s) {
+    auto r = std::string{};
+    for (const auto c : s) {
+      if ((c == '"') || (c == '\\')) {
+        r += '\\';
+      }
+      r += c;
+    }
+    return r;
+  }  // end of escape
+
+  BenchmarkSuite::BenchmarkSuite(const double t, const std::string& f)
+      : min_time(t), filter(f) {}  // end of BenchmarkSuite::BenchmarkSuite
+
+  bool BenchmarkSuite::isSelected(const std::string& n) const {
+    return this->filter.empty() || (n.find(this->filter) != std::string::npos);
+  }  // end of BenchmarkSuite::isSelected
+
+  BenchmarkResult* BenchmarkSuite::run(const std::string& n,
+                                       const size_type items,
+                                       const size_type nth,
+                                       const std::function<void()>& f) {
+    using clock = std::chrono::steady_clock;
+    if (!this->isSelected(n)) {
+      return nullptr;
+    }
+    // warm-up
+    f();
+    auto niter = size_type{1};
+    auto elapsed = double{};
+    while (true) {
+      const auto start = clock::now();
+      for (size_type i = 0; i != niter; ++i) {
+        f();
+      }
+      elapsed = std::chrono::duration<double>(clock::now() - start).count();
+      if ((elapsed >= this->min_time) || (niter >= (size_type{1} << 30))) {
+        break;
+      }
+      niter *= 2;
+    }
+    auto r = BenchmarkResult{};
+    r.name = n;
+    r.iterations = niter;
+    r.real_time = elapsed * 1e9 / static_cast<double>(niter);
+    r.items_per_second =
+        static_cast<double>(items) * static_cast<double>(niter) / elapsed;
+    r.threads = nth;
+    this->results.push_back(std::move(r));
+    return &(this->results.back());
+  }  // end of BenchmarkSuite::run
+
+  void BenchmarkSuite::writeJSON(std::ostream& os) const {
+    const auto now = std::time(nullptr);
+    char date[64];
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+    os << std::setprecision(10);
+    os << "{\n"
+       << "  \"context\": {\n"
+       << "    \"date\": \"" << date << "\",\n"
+       << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+       << "    \"min_time\": " << this->min_time << "\n"
+       << "  },\n"
+       << "  \"benchmarks\": [";
+    auto first = true;
+    for (const auto& r : this->results) {
+      os << (first ? "\n" : ",\n");
+      first = false;
+      os << "    {\n"
+         << "      \"name\": \"" << escape(r.name) << "\",\n"
+         << "      \"run_type\": \"iteration\",\n"
+         << "      \"iterations\": " << r.iterations << ",\n"
+         << "      \"real_time\": " << r.real_time << ",\n"
+         << "      \"time_unit\": \"ns\",\n"
+         << "      \"threads\": " << r.threads << ",\n";
+      for (const auto& [k, v] : r.counters) {
+        os << "      \"" << escape(k) << "\": " << v << ",\n";
+      }
+      os << "      \"items_per_second\": " << r.items_per_second << "\n"
+         << "    }";
+    }
+    os << "\n  ]\n"
+       << "}\n";
+  }  // end of BenchmarkSuite::writeJSON
+
+  void BenchmarkSuite::writeSummary(std::ostream& os) const {
+    os << std::left << std::setw(56) << "benchmark" << std::right
+       << std::setw(14) << "time (ns)" << std::setw(16) << "points/s"
+       << std::setw(12) << "iterations" << '\n';
+    for (const auto& r : this->results) {
+      os << std::left << std::setw(56) << r.name << std::right
+         << std::setw(14) << std::setprecision(6) << r.real_time
+         << std::setw(16) << r.items_per_second << std::setw(12)
+         << r.iterations;
+      for (const auto& [k, v] : r.counters) {
+        os << ' ' << k << '=' << v;
+      }
+      os << '\n';
+    }
+  }  // end of BenchmarkSuite::writeSummary
+
+}  // end of namespace mgis::benchmarks
@@ -0,0 +1,93 @@
+/*!
+ * \file   benchmarks/BenchmarkSuite.hxx
+ * \brief  This file declares a minimal benchmark harness whose results are
+ * exported in the `JSON` format used by the `Google Benchmark` library.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_BENCHMARKS_BENCHMARKSUITE_HXX
+#define LIB_MGIS_BENCHMARKS_BENCHMARKSUITE_HXX
+
+#include <map>
+#include <deque>
+#include <string>
+#include <iosfwd>
+#include <functional>
+#include "MGIS/Config.hxx"
+
+namespace mgis::benchmarks {
+
+  //! \brief result of a benchmark
+  struct BenchmarkResult {
+    //! \brief name of the benchmark
+    std::string name;
+    //! \brief number of iterations
+    size_type iterations = 0;
+    //! \brief mean wall-clock time per iteration, in nanoseconds
+    double real_time = 0;
+    //! \brief number of items (integration points) treated per second
+    double items_per_second = 0;
+    //! \brief number of threads used
+    size_type threads = 1;
+    //! \brief additional counters (speedup, efficiency, etc.)
+    std::map<std::string, double> counters;
+  };  // end of struct BenchmarkResult
+
+  //! \brief a set of benchmarks
+  struct BenchmarkSuite {
+    /*!
+     * \brief constructor
+     * \param[in] t: minimal duration of a benchmark, in seconds
+     * \param[in] f: filter. Only the benchmarks whose names contain this
+     * string are run.
+     */
+    BenchmarkSuite(const double, const std::string&);
+    /*!
+     * \brief run a benchmark
+     * \return the result of the benchmark or null if the benchmark has been
+     * filtered out.
+     * \param[in] n: name of the benchmark
+     * \param[in] items: number of items treated at each call to `f`
+     * \param[in] nth: number of threads used by `f`
+     * \param[in] f: function to be benchmarked
+     *
+     * The function `f` is called repeatedly, the number of iterations being
+     * doubled until the total time exceeds the minimal duration.
+     */
+    BenchmarkResult* run(const std::string&,
+                         const size_type,
+                         const size_type,
+                         const std::function<void()>&);
+    //! \return if the benchmark of the given name shall be run
+    bool isSelected(const std::string&) const;
+    /*!
+     * \brief write the results in the `JSON` format
+     * \param[out] os: output stream
+     */
+    void writeJSON(std::ostream&) const;
+    //! \brief write a summary of the results in a human readable format
+    void writeSummary(std::ostream&) const;
+
+   private:
+    /*!
+     * \brief results. A deque is used so that the pointers returned by the
+     * `run` method stay valid when new benchmarks are run.
+     */
+    std::deque<BenchmarkResult> results;
+    //! \brief minimal duration of a benchmark
+    double min_time;
+    //! \brief filter
+    std::string filter;
+  };  // end of struct BenchmarkSuite
+
+}  // end of namespace mgis::benchmarks
+
+#endif /* LIB_MGIS_BENCHMARKS_BENCHMARKSUITE_HXX */
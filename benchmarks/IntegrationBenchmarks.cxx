@@ -0,0 +1,528 @@
+/*!
+ * \file   benchmarks/IntegrationBenchmarks.cxx
+ * \brief  This file implements the performance suite of the behaviour
+ * integration engine. The behaviours used are the ones compiled for the
+ * tests.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <array>
+#include <future>
+#include <random>
+#include <string>
+#include <numeric>
+#include <algorithm>
+#include <vector>
+#include <thread>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include "MGIS/Raise.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Partition.hxx"
+#include "MGIS/MemoryResource.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+#include "MGIS/Behaviour/FiniteStrainSupport.hxx"
+#include "BenchmarkSuite.hxx"
+
+namespace mgis::benchmarks {
+
+  //! \brief options of the benchmarks
+  struct BenchmarkOptions {
+    //! \brief path to the library containing the test behaviours
+    std::string library;
+    //! \brief output file
+    std::string output = "mgis-benchmarks.json";
+    //! \brief filter
+    std::string filter;
+    //! \brief number of integration points
+    size_type n = 10000;
+    //! \brief maximal number of threads
+    size_type max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    //! \brief minimal duration of a benchmark, in seconds
+    double min_time = 0.5;
+  };  // end of struct BenchmarkOptions
+
+  //! \return the list of the number of threads to be tested
+  static std::vector<size_type> getNumberOfThreads(const size_type nmax) {
+    auto nth = std::vector<size_type>{};
+    for (size_type i = 1; i < nmax; i *= 2) {
+      nth.push_back(i);
+    }
+    nth.push_back(nmax);
+    return nth;
+  }  // end of getNumberOfThreads
+
+  /*!
+   * \brief add the speedup and the efficiency with respect to the serial
+   * version
+   * \param[in] r: result of the multi-threaded benchmark
+   * \param[in] ref: result of the serial benchmark
+   */
+  static void addScalingCounters(BenchmarkResult* const r,
+                                 const BenchmarkResult* const ref) {
+    if ((r == nullptr) || (ref == nullptr)) {
+      return;
+    }
+    const auto speedup = ref->real_time / r->real_time;
+    r->counters["speedup"] = speedup;
+    r->counters["efficiency"] = speedup / static_cast<double>(r->threads);
+  }  // end of addScalingCounters
+
+  //! \brief check the exit status of an integration
+  static void checkIntegration(const int r) {
+    if (r == -1) {
+      mgis::raise("behaviour integration failed");
+    }
+  }  // end of checkIntegration
+
+  static void benchmarkLoad(BenchmarkSuite& s, const BenchmarkOptions& o) {
+    using namespace mgis::behaviour;
+    const auto h = Hypothesis::TRIDIMENSIONAL;
+    for (const auto* const n : {"Norton", "Plasticity"}) {
+      s.run("load/" + std::string{n}, 1, 1, [&o, n, h] {
+        const auto b = load(o.library, n, h);
+        static_cast<void>(b);
+      });
+    }
+    s.run("load/FiniteStrainSingleCrystal", 1, 1, [&o, h] {
+      const auto b =
+          load(FiniteStrainBehaviourOptions{}, o.library,
+               "FiniteStrainSingleCrystal", h);
+      static_cast<void>(b);
+    });
+  }  // end of benchmarkLoad
+
+  /*!
+   * \brief benchmark the integration of a behaviour
+   * \param[in] s: benchmark suite
+   * \param[in] o: options
+   * \param[in] n: behaviour name
+   * \param[in] e: axial strain imposed at each integration point
+   * \param[in] dt: time step
+   */
+  static void benchmarkIntegrate(BenchmarkSuite& s,
+                                 const BenchmarkOptions& o,
+                                 const std::string& n,
+                                 const real e,
+                                 const real dt) {
+    using namespace mgis::behaviour;
+    const auto prefix = "integrate/" + n;
+    if (!s.isSelected(prefix)) {
+      return;
+    }
+    const auto b = load(o.library, n, Hypothesis::TRIDIMENSIONAL);
+    auto m = MaterialDataManager{b, o.n};
+    setExternalStateVariable(m.s0, "Temperature", 293.15);
+    setExternalStateVariable(m.s1, "Temperature", 293.15);
+    for (size_type idx = 0; idx != m.n; ++idx) {
+      m.s1.gradients[idx * m.s1.gradients_stride] = e;
+    }
+    const auto it = IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
+    const auto* const ref = s.run(prefix + "/serial", o.n, 1, [&m, it, dt] {
+      checkIntegration(integrate(m, it, dt, 0, m.n));
+    });
+    for (const auto nth : getNumberOfThreads(o.max_threads)) {
+      ThreadPool p(nth);
+      auto* const r =
+          s.run(prefix + "/ThreadPool/threads:" + std::to_string(nth), o.n,
+                nth, [&p, &m, it, dt] {
+                  checkIntegration(integrate(p, m, it, dt));
+                });
+      addScalingCounters(r, ref);
+    }
+  }  // end of benchmarkIntegrate
+
+  static void benchmarkUpdateAndRevert(BenchmarkSuite& s,
+                                       const BenchmarkOptions& o) {
+    using namespace mgis::behaviour;
+    if ((!s.isSelected("update/Norton")) && (!s.isSelected("revert/Norton"))) {
+      return;
+    }
+    const auto b = load(o.library, "Norton", Hypothesis::TRIDIMENSIONAL);
+    auto m = MaterialDataManager{b, o.n};
+    s.run("update/Norton", o.n, 1, [&m] { update(m); });
+    s.run("revert/Norton", o.n, 1, [&m] { revert(m); });
+  }  // end of benchmarkUpdateAndRevert
+
+  static void benchmarkRotations(BenchmarkSuite& s,
+                                 const BenchmarkOptions& o) {
+    using namespace mgis::behaviour;
+    if (!s.isSelected("rotate")) {
+      return;
+    }
+    const auto b =
+        load(o.library, "OrthotropicElasticity", Hypothesis::TRIDIMENSIONAL);
+    const auto gsize = getArraySize(b.gradients, b.hypothesis);
+    const auto tfsize = getArraySize(b.thermodynamic_forces, b.hypothesis);
+    const auto Ksize = getTangentOperatorArraySize(b);
+    // a rotation of 30 degrees around the third axis
+    const auto c = std::cos(M_PI / 6);
+    const auto sn = std::sin(M_PI / 6);
+    const auto r = std::vector<real>{c, -sn, 0, sn, c, 0, 0, 0, 1};
+    auto rf = std::vector<real>(9 * o.n);
+    for (size_type i = 0; i != o.n; ++i) {
+      std::copy(r.begin(), r.end(), rf.begin() + 9 * i);
+    }
+    auto g = std::vector<real>(gsize * o.n, real(1.e-3));
+    auto mg = std::vector<real>(gsize * o.n);
+    auto tf = std::vector<real>(tfsize * o.n, real(100));
+    auto gtf = std::vector<real>(tfsize * o.n);
+    auto K = std::vector<real>(Ksize * o.n, real(1.e5));
+    auto gK = std::vector<real>(Ksize * o.n);
+    for (const auto& [suffix, rv] :
+         {std::pair<std::string, const std::vector<real>*>{"uniform", &r},
+          std::pair<std::string, const std::vector<real>*>{"field", &rf}}) {
+      const auto& rm = *rv;
+      s.run("rotateGradients/OrthotropicElasticity/" + suffix, o.n, 1,
+            [&mg, &b, &g, &rm] { rotateGradients(mg, b, g, rm); });
+      s.run("rotateThermodynamicForces/OrthotropicElasticity/" + suffix, o.n,
+            1, [&gtf, &b, &tf, &rm] {
+              rotateThermodynamicForces(gtf, b, tf, rm);
+            });
+      s.run("rotateTangentOperatorBlocks/OrthotropicElasticity/" + suffix,
+            o.n, 1, [&gK, &b, &K, &rm] {
+              rotateTangentOperatorBlocks(gK, b, K, rm);
+            });
+    }
+  }  // end of benchmarkRotations
+
+  static void benchmarkFiniteStrainConversions(BenchmarkSuite& s,
+                                               const BenchmarkOptions& o) {
+    using namespace mgis::behaviour;
+    if (!s.isSelected("convertFiniteStrain")) {
+      return;
+    }
+    const auto b = load(FiniteStrainBehaviourOptions{}, o.library,
+                        "FiniteStrainSingleCrystal",
+                        Hypothesis::TRIDIMENSIONAL);
+    auto m = MaterialDataManager{b, o.n};
+    m.allocateArrayOfTangentOperatorBlocks();
+    // deformation gradient
+    const auto F = std::array<real, 9u>{1.01, 0.99, 1, 2e-3, 0, 0, 0, 0, 0};
+    for (size_type idx = 0; idx != m.n; ++idx) {
+      std::copy(F.begin(), F.end(),
+                m.s1.gradients.begin() + idx * m.s1.gradients_stride);
+      for (size_type i = 0; i != m.s1.thermodynamic_forces_stride; ++i) {
+        m.s1.thermodynamic_forces[idx * m.s1.thermodynamic_forces_stride + i] =
+            real(100);
+      }
+    }
+    std::fill(m.K.begin(), m.K.end(), real(1e5));
+    auto P = std::vector<real>(9 * o.n);
+    auto dP = std::vector<real>(81 * o.n);
+    s.run("convertFiniteStrainStress/FiniteStrainSingleCrystal/PK1", o.n, 1,
+          [&P, &m] {
+            auto Ps = mgis::span<real>(P);
+            convertFiniteStrainStress(Ps, m, FiniteStrainStress::PK1);
+          });
+    s.run(
+        "convertFiniteStrainTangentOperator/FiniteStrainSingleCrystal/DPK1_DF",
+        o.n, 1, [&dP, &m] {
+          auto dPs = mgis::span<real>(dP);
+          convertFiniteStrainTangentOperator(
+              dPs, m, FiniteStrainTangentOperator::DPK1_DF);
+        });
+  }  // end of benchmarkFiniteStrainConversions
+
+  static void benchmarkPostProcessing(BenchmarkSuite& s,
+                                      const BenchmarkOptions& o) {
+    using namespace mgis::behaviour;
+    const auto prefix =
+        std::string{"executePostProcessing/PostProcessingTest/PrincipalStrain"};
+    if (!s.isSelected(prefix)) {
+      return;
+    }
+    const auto b =
+        load(o.library, "PostProcessingTest", Hypothesis::TRIDIMENSIONAL);
+    auto m = MaterialDataManager{b, o.n};
+    setMaterialProperty(m.s1, "YoungModulus", 150e9);
+    setMaterialProperty(m.s1, "PoissonRatio", 0.3);
+    setExternalStateVariable(m.s1, "Temperature", 293.15);
+    update(m);
+    const auto e = std::array<real, 6u>{1.3e-2, 1.2e-2, 1.4e-2, 0., 0., 0.};
+    for (size_type idx = 0; idx != m.n; ++idx) {
+      std::copy(e.begin(), e.end(),
+                m.s1.gradients.begin() + idx * m.s1.gradients_stride);
+    }
+    auto outputs = allocatePostProcessingVariables(m, "PrincipalStrain");
+    const auto* const ref =
+        s.run(prefix + "/serial", o.n, 1, [&outputs, &m] {
+          checkIntegration(
+              executePostProcessing(outputs, m, "PrincipalStrain").exit_status);
+        });
+    for (const auto nth : getNumberOfThreads(o.max_threads)) {
+      ThreadPool p(nth);
+      auto* const r =
+          s.run(prefix + "/ThreadPool/threads:" + std::to_string(nth), o.n,
+                nth, [&outputs, &p, &m] {
+                  checkIntegration(
+                      executePostProcessing(outputs, p, m, "PrincipalStrain")
+                          .exit_status);
+                });
+      addScalingCounters(r, ref);
+    }
+  }  // end of benchmarkPostProcessing
+
+  /*!
+   * \brief copy, in parallel, the state at the end of the time step into the
+   * state at the beginning of the time step. The `i`-th range of the uniform
+   * partition of the integration points is copied by the `i`-th thread of
+   * the pool. This kernel is memory-bound.
+   * \return the number of bytes read and written
+   * \param[in] p: thread pool
+   * \param[in] m: material data manager
+   */
+  static double copyStateInParallel(ThreadPool& p,
+                                    behaviour::MaterialDataManager& m) {
+    const auto bounds = getUniformPartition(m.n, p.getNumberOfThreads());
+    auto copy = [](mgis::span<const real> src, mgis::span<real> dest,
+                   const size_type stride, const size_type b,
+                   const size_type e) {
+      std::copy(src.begin() + b * stride, src.begin() + e * stride,
+                dest.begin() + b * stride);
+    };
+    std::vector<std::future<ThreadedTaskResult<void>>> tasks;
+    tasks.reserve(bounds.size() - 1);
+    for (size_type i = 0; i + 1 < bounds.size(); ++i) {
+      tasks.push_back(p.addTaskToThread(
+          i, [&m, &copy, b = bounds[i], e = bounds[i + 1]] {
+            copy(m.s1.gradients, m.s0.gradients, m.s0.gradients_stride, b, e);
+            copy(m.s1.thermodynamic_forces, m.s0.thermodynamic_forces,
+                 m.s0.thermodynamic_forces_stride, b, e);
+            copy(m.s1.internal_state_variables, m.s0.internal_state_variables,
+                 m.s0.internal_state_variables_stride, b, e);
+          }));
+    }
+    for (auto& t : tasks) {
+      auto r = t.get();
+      if (!r) {
+        r.rethrow();
+      }
+    }
+    const auto size = m.s0.gradients_stride + m.s0.thermodynamic_forces_stride +
+                      m.s0.internal_state_variables_stride;
+    return 2 * static_cast<double>(m.n * size * sizeof(real));
+  }  // end of copyStateInParallel
+
+  /*!
+   * \brief compare a memory-bound kernel and the integration of the `Norton`
+   * behaviour on a pool of threads bound to processing units when the
+   * memory is initialized by the main thread (`serial`) or by the threads of
+   * the pool (`firstTouch`). On NUMA machines, in the first case, all the
+   * memory pages are placed on the node of the main thread.
+   *
+   * The `bandwidth` counter gives the effective memory bandwidth in GB/s of
+   * the memory-bound kernel and the `speedup` counter gives the speedup
+   * obtained by the first-touch initialization.
+   *
+   * \param[in] s: benchmark suite
+   * \param[in] o: options
+   *
+   * \note this benchmark is only meaningful for a number of integration
+   * points large enough for the data not to fit in the caches, e.g.
+   * `--points=10000000`.
+   */
+  static void benchmarkFirstTouch(BenchmarkSuite& s,
+                                  const BenchmarkOptions& o) {
+    using namespace mgis::behaviour;
+    if (!s.isSelected("firstTouch")) {
+      return;
+    }
+    const auto b = load(o.library, "Norton", Hypothesis::TRIDIMENSIONAL);
+    ThreadPool p(o.max_threads, ThreadAffinityPolicy::COMPACT);
+    auto i = MaterialDataManagerInitializer{};
+    i.thread_pool = &p;
+    auto m1 = MaterialDataManager{b, o.n};
+    auto m2 = MaterialDataManager{b, o.n, i};
+    const auto it = IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
+    auto results = std::array<BenchmarkResult*, 4u>{};
+    auto pos = results.begin();
+    for (auto* const m : {&m1, &m2}) {
+      setExternalStateVariable(m->s0, "Temperature", 293.15);
+      setExternalStateVariable(m->s1, "Temperature", 293.15);
+      for (size_type idx = 0; idx != m->n; ++idx) {
+        m->s1.gradients[idx * m->s1.gradients_stride] = 5.e-5;
+      }
+      const auto suffix = std::string{(m == &m1) ? "serial" : "firstTouch"};
+      auto bytes = double{};
+      auto* const r = s.run(
+          "firstTouch/copyState/Norton/" + suffix, o.n, o.max_threads,
+          [&p, &bytes, m] { bytes = copyStateInParallel(p, *m); });
+      if (r != nullptr) {
+        r->counters["bandwidth"] = bytes / r->real_time;
+      }
+      *pos++ = r;
+      *pos++ = s.run("firstTouch/integrate/Norton/" + suffix, o.n,
+                     o.max_threads, [&p, m, it] {
+                       checkIntegration(integrate(p, *m, it, 180));
+                     });
+    }
+    for (size_type k = 0; k != 2; ++k) {
+      if ((results[k] != nullptr) && (results[k + 2] != nullptr)) {
+        results[k + 2]->counters["speedup"] =
+            results[k]->real_time / results[k + 2]->real_time;
+      }
+    }
+  }  // end of benchmarkFirstTouch
+
+  /*!
+   * \brief compare the allocation policies of the arrays of the material
+   * data manager on a streaming kernel (the `update` function), a kernel
+   * gathering an internal state variable in a random order, which is
+   * dominated by TLB misses for large numbers of integration points, and the
+   * integration of the `Norton` behaviour.
+   *
+   * The `speedup` counter gives the speedup with respect to the default
+   * allocation policy.
+   *
+   * \param[in] s: benchmark suite
+   * \param[in] o: options
+   *
+   * \note this benchmark is only meaningful for a number of integration
+   * points large enough for the data not to fit in the caches, e.g.
+   * `--points=10000000`. Explicit huge pages must be reserved by the
+   * system administrator (see `/proc/sys/vm/nr_hugepages`), otherwise
+   * the `hugetlb` policy falls back to transparent huge pages.
+   */
+  static void benchmarkAllocationPolicies(BenchmarkSuite& s,
+                                          const BenchmarkOptions& o) {
+    using namespace mgis::behaviour;
+    if (!s.isSelected("allocation")) {
+      return;
+    }
+    const auto b = load(o.library, "Norton", Hypothesis::TRIDIMENSIONAL);
+    const auto policies = std::array<std::pair<AllocationPolicy, const char*>,
+                                     4u>{
+        {{AllocationPolicy::DEFAULT, "default"},
+         {AllocationPolicy::ALIGNED, "aligned"},
+         {AllocationPolicy::TRANSPARENT_HUGE_PAGES, "thp"},
+         {AllocationPolicy::HUGETLB, "hugetlb"}}};
+    auto ordering = std::vector<size_type>(o.n);
+    std::iota(ordering.begin(), ordering.end(), size_type{0});
+    std::shuffle(ordering.begin(), ordering.end(), std::mt19937{12345});
+    auto buffer = std::vector<real>(o.n);
+    const auto it = IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
+    auto references = std::array<const BenchmarkResult*, 3u>{};
+    for (const auto& [policy, name] : policies) {
+      auto i = MaterialDataManagerInitializer{};
+      i.memory_resource = &getMemoryResource(policy);
+      auto m = MaterialDataManager{b, o.n, i};
+      setExternalStateVariable(m.s0, "Temperature", 293.15);
+      setExternalStateVariable(m.s1, "Temperature", 293.15);
+      for (size_type idx = 0; idx != m.n; ++idx) {
+        m.s1.gradients[idx * m.s1.gradients_stride] = 5.e-5;
+      }
+      const auto prefix = "allocation/" + std::string{name};
+      auto results = std::array<BenchmarkResult*, 3u>{
+          s.run(prefix + "/update/Norton", o.n, 1, [&m] { update(m); }),
+          s.run(prefix + "/randomGather/Norton", o.n, 1,
+                [&m, &buffer, &ordering] {
+                  extractInternalStateVariable(
+                      buffer, m.s1, "EquivalentViscoplasticStrain", ordering);
+                }),
+          s.run(prefix + "/integrate/Norton", o.n, 1, [&m, it] {
+            checkIntegration(integrate(m, it, 180, 0, m.n));
+          })};
+      for (size_type k = 0; k != results.size(); ++k) {
+        if (policy == AllocationPolicy::DEFAULT) {
+          references[k] = results[k];
+        } else if ((results[k] != nullptr) && (references[k] != nullptr)) {
+          results[k]->counters["speedup"] =
+              references[k]->real_time / results[k]->real_time;
+        }
+      }
+    }
+  }  // end of benchmarkAllocationPolicies
+
+  //! \brief display the usage of the benchmark executable
+  static void usage(std::ostream& os) {
+    os << "usage: mgis-benchmarks library [--output=file] [--filter=string]"
+          " [--points=n] [--max-threads=n] [--min-time=seconds]\n";
+  }  // end of usage
+
+  /*!
+   * \brief parse the command line arguments
+   * \param[in] argc: number of arguments
+   * \param[in] argv: arguments
+   */
+  static BenchmarkOptions parseArguments(const int argc,
+                                         const char* const* const argv) {
+    auto o = BenchmarkOptions{};
+    auto starts_with = [](const std::string& a, const char* const p,
+                          std::string& v) {
+      const auto s = std::string{p};
+      if (a.compare(0, s.size(), s) == 0) {
+        v = a.substr(s.size());
+        return true;
+      }
+      return false;
+    };
+    for (int i = 1; i != argc; ++i) {
+      const auto a = std::string{argv[i]};
+      auto v = std::string{};
+      if (starts_with(a, "--output=", v)) {
+        o.output = v;
+      } else if (starts_with(a, "--filter=", v)) {
+        o.filter = v;
+      } else if (starts_with(a, "--points=", v)) {
+        o.n = static_cast<size_type>(std::stoul(v));
+      } else if (starts_with(a, "--max-threads=", v)) {
+        o.max_threads = static_cast<size_type>(std::stoul(v));
+      } else if (starts_with(a, "--min-time=", v)) {
+        o.min_time = std::stod(v);
+      } else if ((!a.empty()) && (a[0] != '-') && (o.library.empty())) {
+        o.library = a;
+      } else {
+        mgis::raise("invalid argument '" + a + "'");
+      }
+    }
+    if (o.library.empty()) {
+      mgis::raise("no library specified");
+    }
+    if ((o.n == 0) || (o.max_threads == 0)) {
+      mgis::raise("invalid number of points or threads");
+    }
+    return o;
+  }  // end of parseArguments
+
+}  // end of namespace mgis::benchmarks
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis::benchmarks;
+  try {
+    const auto o = parseArguments(argc, argv);
+    auto s = BenchmarkSuite{o.min_time, o.filter};
+    benchmarkLoad(s, o);
+    benchmarkIntegrate(s, o, "Norton", 5.e-5, 180);
+    benchmarkIntegrate(s, o, "Plasticity", 2.e-2, 1);
+    benchmarkUpdateAndRevert(s, o);
+    benchmarkRotations(s, o);
+    benchmarkFiniteStrainConversions(s, o);
+    benchmarkPostProcessing(s, o);
+    benchmarkFirstTouch(s, o);
+    benchmarkAllocationPolicies(s, o);
+    s.writeSummary(std::cout);
+    std::ofstream out(o.output);
+    if (!out) {
+      mgis::raise("can't open file '" + o.output + "'");
+    }
+    s.writeJSON(out);
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    usage(std::cerr);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -23,6 +23,7 @@
 
 #include "MGIS/Config.h"
 #include "MGIS/Status.h"
+#include "MGIS/Executor.h"
 #include "MGIS/Behaviour/Variable.h"
 
 #ifdef __cplusplus
@@ -363,6 +364,60 @@ mgis_bv_behaviour_rotate_array_of_tangent_operator_blocks_out_of_place(
     const mgis_real* const,
     const mgis_real* const,
     const mgis_size_type);
+/*!
+ * \brief rotate gradients from the global frame to the material frame using
+ * the given executor to parallelize the computations.
+ * \param[in,out] e: executor
+ * \param[out] mg: gradients in the material frame
+ * \param[in] b: behaviour
+ * \param[in] gg: gradients in the global frame
+ * \param[in] r: rotation matrix
+ * \param[in] s: number of gradients to be rotated
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_behaviour_rotate_array_of_gradients_with_executor(
+    mgis_Executor* const,
+    mgis_real* const,
+    const mgis_bv_Behaviour* const,
+    const mgis_real* const,
+    const mgis_real* const,
+    const mgis_size_type);
+/*!
+ * \brief rotate thermodynamic forces from the material frame to the global
+ * frame using the given executor to parallelize the computations.
+ * \param[in,out] e: executor
+ * \param[out] gtf: thermodynamic forces in the global frame
+ * \param[in] b: behaviour
+ * \param[in] mtf: thermodynamic forces in the material frame
+ * \param[in] r: rotation matrix
+ * \param[in] s: number of thermodynamic forces to be rotated
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_behaviour_rotate_array_of_thermodynamic_forces_with_executor(
+    mgis_Executor* const,
+    mgis_real* const,
+    const mgis_bv_Behaviour* const,
+    const mgis_real* const,
+    const mgis_real* const,
+    const mgis_size_type);
+/*!
+ * \brief rotate tangent operator blocks from the material frame to the global
+ * frame using the given executor to parallelize the computations.
+ * \param[in,out] e: executor
+ * \param[out] gto: tangent operator blocks in the global frame
+ * \param[in] b: behaviour
+ * \param[in] mto: tangent operator blocks in the material frame
+ * \param[in] r: rotation matrix
+ * \param[in] s: number of tangent operator blocks to be rotated
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_behaviour_rotate_array_of_tangent_operator_blocks_with_executor(
+    mgis_Executor* const,
+    mgis_real* const,
+    const mgis_bv_Behaviour* const,
+    const mgis_real* const,
+    const mgis_real* const,
+    const mgis_size_type);
 /*!
  * \brief retrieve the library
  * \param[out] l: library
@@ -18,10 +18,15 @@
 #include "MGIS/Config.h"
 #include "MGIS/Status.h"
 #include "MGIS/ThreadPool.h"
+#include "MGIS/Executor.h"
 #include "MGIS/Behaviour/BehaviourDataView.h"
 #include "MGIS/Behaviour/Behaviour.h"
 #include "MGIS/Behaviour/MaterialDataManager.h"
 
+#ifdef __cplusplus
+#include "MGIS/Behaviour/Integrate.hxx"
+#endif /*  __cplusplus */
+
 #ifdef __cplusplus
 extern "C" {
 #endif /*  __cplusplus */
@@ -38,6 +43,169 @@ typedef enum {
   MGIS_BV_INTEGRATION_CONSISTENT_TANGENT_OPERATOR = 4
 } mgis_bv_IntegrationType;
 
+#ifdef __cplusplus
+using mgis_bv_BehaviourIntegrationOptions =
+    mgis::behaviour::BehaviourIntegrationOptions;
+using mgis_bv_BehaviourIntegrationResult =
+    mgis::behaviour::BehaviourIntegrationResult;
+using mgis_bv_MultiThreadedBehaviourIntegrationResult =
+    mgis::behaviour::MultiThreadedBehaviourIntegrationResult;
+#else
+/*!
+ * \brief an opaque structure which can only be accessed through the MGIS' API.
+ */
+typedef struct mgis_bv_BehaviourIntegrationOptions
+    mgis_bv_BehaviourIntegrationOptions;
+/*!
+ * \brief an opaque structure which can only be accessed through the MGIS' API.
+ */
+typedef struct mgis_bv_BehaviourIntegrationResult
+    mgis_bv_BehaviourIntegrationResult;
+/*!
+ * \brief an opaque structure which can only be accessed through the MGIS' API.
+ */
+typedef struct mgis_bv_MultiThreadedBehaviourIntegrationResult
+    mgis_bv_MultiThreadedBehaviourIntegrationResult;
+#endif
+
+/*!
+ * \brief create a behaviour integration options. By default, the integration
+ * type is `MGIS_BV_INTEGRATION_CONSISTENT_TANGENT_OPERATOR` and the speed of
+ * sound is not computed.
+ * \param[out] o: a pointer to the created options
+ */
+MGIS_C_EXPORT mgis_status mgis_bv_create_behaviour_integration_options(
+    mgis_bv_BehaviourIntegrationOptions**);
+/*!
+ * \brief set the type of integration to be performed
+ * \param[in,out] o: options
+ * \param[in] i: type of integration to be performed
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_behaviour_integration_options_set_integration_type(
+    mgis_bv_BehaviourIntegrationOptions* const, const mgis_bv_IntegrationType);
+/*!
+ * \brief specify if the speed of sound shall be computed
+ * \param[in,out] o: options
+ * \param[in] b: boolean value (0 means false)
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_behaviour_integration_options_set_speed_of_sound_flag(
+    mgis_bv_BehaviourIntegrationOptions* const, const int);
+/*!
+ * \brief specify if the integration costs shall be measured. Those costs are
+ * used to balance the ranges of integration points treated by each thread in
+ * the next multi-threaded integrations.
+ * \param[in,out] o: options
+ * \param[in] b: boolean value (0 means false)
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_behaviour_integration_options_set_integration_costs_flag(
+    mgis_bv_BehaviourIntegrationOptions* const, const int);
+/*!
+ * \brief free the memory associated with the given options.
+ * \param[in,out] o: options
+ */
+MGIS_C_EXPORT mgis_status mgis_bv_free_behaviour_integration_options(
+    mgis_bv_BehaviourIntegrationOptions**);
+/*!
+ * \param[out] r: a pointer to the created result
+ */
+MGIS_C_EXPORT mgis_status mgis_bv_create_behaviour_integration_result(
+    mgis_bv_BehaviourIntegrationResult**);
+/*!
+ * \brief return the exit status of an integration
+ * \param[out] s: exit status
+ * \param[in] r: result
+ */
+MGIS_C_EXPORT mgis_status mgis_bv_behaviour_integration_result_get_exit_status(
+    int* const, const mgis_bv_BehaviourIntegrationResult* const);
+/*!
+ * \brief return the time step increase factor proposed by the behaviour
+ * \param[out] rdt: time step increase factor
+ * \param[in] r: result
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_behaviour_integration_result_get_time_step_increase_factor(
+    mgis_real* const, const mgis_bv_BehaviourIntegrationResult* const);
+/*!
+ * \brief return the number of the integration point that failed or the number
+ * of the last integration point that reported unreliable results.
+ * \param[out] n: integration point number
+ * \param[in] r: result
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_behaviour_integration_result_get_integration_point_number(
+    mgis_size_type* const, const mgis_bv_BehaviourIntegrationResult* const);
+/*!
+ * \brief return the error message, if any
+ * \param[out] m: error message
+ * \param[in] r: result
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_behaviour_integration_result_get_error_message(
+    const char**, const mgis_bv_BehaviourIntegrationResult* const);
+/*!
+ * \brief free the memory associated with the given result.
+ * \param[in,out] r: result
+ */
+MGIS_C_EXPORT mgis_status mgis_bv_free_behaviour_integration_result(
+    mgis_bv_BehaviourIntegrationResult**);
+/*!
+ * \param[out] r: a pointer to the created result
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_create_multi_threaded_behaviour_integration_result(
+    mgis_bv_MultiThreadedBehaviourIntegrationResult**);
+/*!
+ * \brief return the exit status of an integration
+ * \param[out] s: exit status
+ * \param[in] r: result
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_multi_threaded_behaviour_integration_result_get_exit_status(
+    int* const, const mgis_bv_MultiThreadedBehaviourIntegrationResult* const);
+/*!
+ * \brief return the number of results, i.e. the number of chunks of
+ * integration points treated by the threads.
+ * \param[out] n: number of results
+ * \param[in] r: result
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_multi_threaded_behaviour_integration_result_get_number_of_results(
+    mgis_size_type* const,
+    const mgis_bv_MultiThreadedBehaviourIntegrationResult* const);
+/*!
+ * \brief return the result associated with the given chunk of integration
+ * points.
+ * \param[out] ri: result of the chunk. This pointer is owned by the result
+ * and must not be freed.
+ * \param[in] r: result
+ * \param[in] i: index of the chunk
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_multi_threaded_behaviour_integration_result_get_result(
+    const mgis_bv_BehaviourIntegrationResult**,
+    const mgis_bv_MultiThreadedBehaviourIntegrationResult* const,
+    const mgis_size_type);
+/*!
+ * \brief return the minimum of the time step increase factors proposed for
+ * all the chunks of integration points.
+ * \param[out] rdt: time step increase factor
+ * \param[in] r: result
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_multi_threaded_behaviour_integration_result_get_time_step_increase_factor(
+    mgis_real* const,
+    const mgis_bv_MultiThreadedBehaviourIntegrationResult* const);
+/*!
+ * \brief free the memory associated with the given result.
+ * \param[in,out] r: result
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_free_multi_threaded_behaviour_integration_result(
+    mgis_bv_MultiThreadedBehaviourIntegrationResult**);
+
 /*!
  * \brief integrate the behaviour. The returned value has the following
  * meaning:
@@ -114,6 +282,162 @@ mgis_bv_integrate_material_data_manager(int* const,
                                         const mgis_bv_IntegrationType,
                                         const mgis_real);
 
+/*!
+ * \brief integrate the behaviour for a range of integration points.
+ *
+ * \param[out] r: result
+ * \param[in,out] m: material data manager
+ * \param[in] o: integration options
+ * \param[in] dt: time step
+ * \param[in] b: first index of the range
+ * \param[in] e: last index of the range
+ *
+ * \note the returned status reports a failure if the integration failed
+ * for at least one integration point. In this case, the result gives
+ * detailed information about the failure.
+ */
+MGIS_C_EXPORT mgis_status mgis_bv_integrate_material_data_manager_part_2(
+    mgis_bv_BehaviourIntegrationResult* const,
+    mgis_bv_MaterialDataManager* const,
+    const mgis_bv_BehaviourIntegrationOptions* const,
+    const mgis_real,
+    const mgis_size_type,
+    const mgis_size_type);
+/*!
+ * \brief integrate the behaviour over all integration points using a thread
+ * pool to parallelize the integration.
+ *
+ * \param[out] r: result
+ * \param[in,out] p: thread pool
+ * \param[in,out] m: material data manager
+ * \param[in] o: integration options
+ * \param[in] dt: time step
+ */
+MGIS_C_EXPORT mgis_status mgis_bv_integrate_material_data_manager_2(
+    mgis_bv_MultiThreadedBehaviourIntegrationResult* const,
+    mgis_ThreadPool* const,
+    mgis_bv_MaterialDataManager* const,
+    const mgis_bv_BehaviourIntegrationOptions* const,
+    const mgis_real);
+/*!
+ * \brief integrate the behaviour over all integration points using the given
+ * executor to parallelize the integration.
+ *
+ * \param[out] r: result
+ * \param[in,out] e: executor
+ * \param[in,out] m: material data manager
+ * \param[in] o: integration options
+ * \param[in] dt: time step
+ */
+MGIS_C_EXPORT mgis_status mgis_bv_integrate_material_data_manager_with_executor(
+    mgis_bv_MultiThreadedBehaviourIntegrationResult* const,
+    mgis_Executor* const,
+    mgis_bv_MaterialDataManager* const,
+    const mgis_bv_BehaviourIntegrationOptions* const,
+    const mgis_real);
+/*!
+ * \brief execute the given post-processing over a range of integration
+ * points.
+ *
+ * \param[out] r: result
+ * \param[out] o: outputs of the post-processing
+ * \param[in] os: size of the outputs. This size must be equal to the
+ * number of integration points times the size of the outputs of the
+ * post-processing at one integration point.
+ * \param[in,out] m: material data manager
+ * \param[in] n: name of the post-processing
+ * \param[in] b: first index of the range
+ * \param[in] e: last index of the range
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_execute_material_data_manager_post_processing_part(
+    mgis_bv_BehaviourIntegrationResult* const,
+    mgis_real* const,
+    const mgis_size_type,
+    mgis_bv_MaterialDataManager* const,
+    const char* const,
+    const mgis_size_type,
+    const mgis_size_type);
+/*!
+ * \brief execute the given post-processing over all integration points
+ * using a thread pool.
+ *
+ * \param[out] r: result
+ * \param[out] o: outputs of the post-processing
+ * \param[in] os: size of the outputs
+ * \param[in,out] p: thread pool
+ * \param[in,out] m: material data manager
+ * \param[in] n: name of the post-processing
+ */
+MGIS_C_EXPORT mgis_status mgis_bv_execute_material_data_manager_post_processing(
+    mgis_bv_MultiThreadedBehaviourIntegrationResult* const,
+    mgis_real* const,
+    const mgis_size_type,
+    mgis_ThreadPool* const,
+    mgis_bv_MaterialDataManager* const,
+    const char* const);
+/*!
+ * \brief execute the given post-processing over all integration points using
+ * the given executor to parallelize the computations.
+ *
+ * \param[out] r: result
+ * \param[out] o: outputs of the post-processing
+ * \param[in] os: size of the outputs
+ * \param[in,out] e: executor
+ * \param[in,out] m: material data manager
+ * \param[in] n: name of the post-processing
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_execute_material_data_manager_post_processing_with_executor(
+    mgis_bv_MultiThreadedBehaviourIntegrationResult* const,
+    mgis_real* const,
+    const mgis_size_type,
+    mgis_Executor* const,
+    mgis_bv_MaterialDataManager* const,
+    const char* const);
+/*!
+ * \brief execute the given initialize function over a range of integration
+ * points.
+ *
+ * \param[out] r: result
+ * \param[in,out] m: material data manager
+ * \param[in] n: name of the initialize function
+ * \param[in] i: inputs of the initialize function. This pointer may be null
+ * if the initialize function has no input.
+ * \param[in] is: size of the inputs. The inputs can be uniform or not.
+ * \param[in] b: first index of the range
+ * \param[in] e: last index of the range
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_execute_material_data_manager_initialize_function_part(
+    mgis_bv_BehaviourIntegrationResult* const,
+    mgis_bv_MaterialDataManager* const,
+    const char* const,
+    const mgis_real* const,
+    const mgis_size_type,
+    const mgis_size_type,
+    const mgis_size_type);
+/*!
+ * \brief execute the given initialize function over all integration points
+ * using a thread pool.
+ *
+ * \param[out] r: result
+ * \param[in,out] p: thread pool
+ * \param[in,out] m: material data manager
+ * \param[in] n: name of the initialize function
+ * \param[in] i: inputs of the initialize function. This pointer may be null
+ * if the initialize function has no input.
+ * \param[in] is: size of the inputs. The inputs can be uniform or not.
+ */
+MGIS_C_EXPORT mgis_status
+mgis_bv_execute_material_data_manager_initialize_function(
+    mgis_bv_MultiThreadedBehaviourIntegrationResult* const,
+    mgis_ThreadPool* const,
+    mgis_bv_MaterialDataManager* const,
+    const char* const,
+    const mgis_real* const,
+    const mgis_size_type);
+
 #ifdef __cplusplus
 }
 #endif /*  __cplusplus */
@@ -0,0 +1,104 @@
+/*!
+ * \file   Executor.h
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_EXECUTOR_H
+#define LIB_MGIS_EXECUTOR_H
+
+#include "MGIS/Config.h"
+#include "MGIS/Status.h"
+#include "MGIS/ThreadPool.h"
+
+#ifdef __cplusplus
+#include "MGIS/Executor.hxx"
+#endif /*  __cplusplus */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /*  __cplusplus */
+
+#ifdef __cplusplus
+using mgis_Executor = mgis::Executor;
+#else
+/*!
+ * \brief an opaque structure which can only be accessed through the MGIS' API.
+ */
+typedef struct mgis_Executor mgis_Executor;
+#endif
+
+/*!
+ * \brief a function treating one chunk of work.
+ * \param[in] ctx: opaque context given to the callback
+ * \param[in] i: chunk index
+ */
+typedef void (*mgis_executor_chunk_function)(void*, mgis_size_type);
+/*!
+ * \brief a callback which must call `f(ctx, i)` for each `i` in `[0, n)`,
+ * possibly in parallel, and return when all chunks have been treated.
+ * \param[in] data: user data given at the creation of the executor
+ * \param[in] n: number of chunks
+ * \param[in] f: function treating one chunk
+ * \param[in] ctx: opaque context to be passed to `f`
+ */
+typedef void (*mgis_executor_callback)(void*,
+                                       mgis_size_type,
+                                       mgis_executor_chunk_function,
+                                       void*);
+
+/*!
+ * \brief create an executor relying on a thread pool
+ * \param[out] e: a pointer to the created executor
+ * \param[in] p: thread pool. The thread pool must outlive the executor.
+ */
+MGIS_C_EXPORT mgis_status
+mgis_create_thread_pool_executor(mgis_Executor**, mgis_ThreadPool* const);
+/*!
+ * \brief create an executor relying on the `OpenMP` runtime of the caller
+ * \param[out] e: a pointer to the created executor
+ * \param[in] n: number of chunks. If null, the value returned by
+ * `omp_get_max_threads` is used.
+ * \note this function fails if MGIS has been compiled without the
+ * `enable-openmp-executor` option.
+ */
+MGIS_C_EXPORT mgis_status mgis_create_openmp_executor(mgis_Executor**,
+                                                      const mgis_size_type);
+/*!
+ * \brief create an executor relying on a callback provided by the caller
+ * \param[out] e: a pointer to the created executor
+ * \param[in] c: callback
+ * \param[in] d: user data passed to the callback
+ * \param[in] n: number of chunks
+ */
+MGIS_C_EXPORT mgis_status
+mgis_create_callback_executor(mgis_Executor**,
+                              mgis_executor_callback,
+                              void* const,
+                              const mgis_size_type);
+/*!
+ * \brief get the number of chunks used by an executor
+ * \param[out] n: number of chunks
+ * \param[in] e: executor
+ */
+MGIS_C_EXPORT mgis_status
+mgis_executor_get_number_of_chunks(mgis_size_type* const,
+                                   const mgis_Executor* const);
+/*!
+ * \param[in,out] e: a pointer to the executor to be destroyed
+ */
+MGIS_C_EXPORT mgis_status mgis_free_executor(mgis_Executor**);
+
+#ifdef __cplusplus
+}  // end of extern "C"
+#endif
+
+#endif /* LIB_MGIS_EXECUTOR_H */
@@ -0,0 +1,131 @@
+/*!
+ * \file   Profiling.h
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_PROFILING_H
+#define LIB_MGIS_PROFILING_H
+
+#include "MGIS/Config.h"
+#include "MGIS/Status.h"
+
+#ifdef __cplusplus
+#include "MGIS/Profiling.hxx"
+#endif /*  __cplusplus */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /*  __cplusplus */
+
+#ifdef __cplusplus
+using mgis_ProfilingReport = mgis::profiling::ProfilingReport;
+#else
+/*!
+ * \brief an opaque structure which can only be accessed through the MGIS' API.
+ */
+typedef struct mgis_ProfilingReport mgis_ProfilingReport;
+#endif
+
+//! \brief statistics associated with an instrumented region
+typedef struct {
+  //! \brief number of calls
+  mgis_size_type calls;
+  //! \brief number of integration points treated
+  mgis_size_type points;
+  //! \brief number of failures
+  mgis_size_type failures;
+  //! \brief total wall time, in seconds
+  mgis_real total_time;
+  //! \brief minimal wall time of a call, in seconds
+  mgis_real min_time;
+  //! \brief maximal wall time of a call, in seconds
+  mgis_real max_time;
+} mgis_profiling_region_statistics;
+
+/*!
+ * \brief check if the profiling layer has been compiled in the library
+ * \param[out] b: result
+ */
+MGIS_C_EXPORT mgis_status mgis_is_profiling_available(int* const);
+/*!
+ * \brief enable or disable the profiling at runtime
+ * \param[in] b: enable the profiling if not null
+ */
+MGIS_C_EXPORT mgis_status mgis_enable_profiling(const int);
+/*!
+ * \brief check if the profiling is enabled
+ * \param[out] b: result
+ */
+MGIS_C_EXPORT mgis_status mgis_is_profiling_enabled(int* const);
+//! \brief reset all the profiling data
+MGIS_C_EXPORT mgis_status mgis_reset_profiling(void);
+/*!
+ * \brief take a snapshot of the profiling data
+ * \param[out] r: a pointer to the created report
+ */
+MGIS_C_EXPORT mgis_status mgis_get_profiling_report(mgis_ProfilingReport**);
+/*!
+ * \brief get the number of threads described by the report
+ * \param[out] n: number of threads
+ * \param[in] r: report
+ */
+MGIS_C_EXPORT mgis_status mgis_profiling_report_get_number_of_threads(
+    mgis_size_type* const, const mgis_ProfilingReport* const);
+/*!
+ * \brief get the statistics of a region, cumulated over all threads
+ * \param[out] s: statistics
+ * \param[in] r: report
+ * \param[in] n: name of the region
+ */
+MGIS_C_EXPORT mgis_status
+mgis_profiling_report_get_statistics(mgis_profiling_region_statistics* const,
+                                     const mgis_ProfilingReport* const,
+                                     const char* const);
+/*!
+ * \brief get the statistics of a region for the given thread
+ * \param[out] s: statistics
+ * \param[in] r: report
+ * \param[in] t: index of the thread in the report
+ * \param[in] n: name of the region
+ */
+MGIS_C_EXPORT mgis_status mgis_profiling_report_get_thread_statistics(
+    mgis_profiling_region_statistics* const,
+    const mgis_ProfilingReport* const,
+    const mgis_size_type,
+    const char* const);
+/*!
+ * \brief get the load imbalance of a region
+ * \param[out] l: load imbalance
+ * \param[in] r: report
+ * \param[in] n: name of the region
+ */
+MGIS_C_EXPORT mgis_status
+mgis_profiling_report_get_load_imbalance(mgis_real* const,
+                                         const mgis_ProfilingReport* const,
+                                         const char* const);
+/*!
+ * \brief write the report in a file using the `JSON` format
+ * \param[in] r: report
+ * \param[in] f: file name
+ */
+MGIS_C_EXPORT mgis_status mgis_profiling_report_write_json(
+    const mgis_ProfilingReport* const, const char* const);
+/*!
+ * \param[in,out] r: a pointer to the report to be destroyed
+ */
+MGIS_C_EXPORT mgis_status mgis_free_profiling_report(mgis_ProfilingReport**);
+
+#ifdef __cplusplus
+}  // end of extern "C"
+#endif
+
+#endif /* LIB_MGIS_PROFILING_H */
@@ -294,6 +294,82 @@ mgis_bv_behaviour_rotate_array_of_tangent_operator_blocks_out_of_place(
 }  // end of
    // mgis_bv_behaviour_rotate_array_of_tangent_operator_blocks_out_of_place
 
+mgis_status mgis_bv_behaviour_rotate_array_of_gradients_with_executor(
+    mgis_Executor* const e,
+    mgis_real* const mg,
+    const mgis_bv_Behaviour* const b,
+    const mgis_real* const gg,
+    const mgis_real* const r,
+    const mgis_size_type s) {
+  if ((e == nullptr) || (b == nullptr)) {
+    return mgis_report_failure(
+        "mgis_bv_behaviour_rotate_array_of_gradients_with_executor: "
+        "null argument");
+  }
+  try {
+    const auto n = s * mgis::behaviour::getArraySize(b->gradients, b->hypothesis);
+    mgis::behaviour::rotateGradients(*e, mgis::span<mgis::real>(mg, n), *b,
+                                     mgis::span<const mgis::real>(gg, n),
+                                     mgis::span<const mgis::real>(r, 9));
+  } catch (...) {
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of mgis_bv_behaviour_rotate_array_of_gradients_with_executor
+
+mgis_status
+mgis_bv_behaviour_rotate_array_of_thermodynamic_forces_with_executor(
+    mgis_Executor* const e,
+    mgis_real* const gtf,
+    const mgis_bv_Behaviour* const b,
+    const mgis_real* const mtf,
+    const mgis_real* const r,
+    const mgis_size_type s) {
+  if ((e == nullptr) || (b == nullptr)) {
+    return mgis_report_failure(
+        "mgis_bv_behaviour_rotate_array_of_thermodynamic_forces_with_executor: "
+        "null argument");
+  }
+  try {
+    const auto n =
+        s * mgis::behaviour::getArraySize(b->thermodynamic_forces, b->hypothesis);
+    mgis::behaviour::rotateThermodynamicForces(
+        *e, mgis::span<mgis::real>(gtf, n), *b,
+        mgis::span<const mgis::real>(mtf, n),
+        mgis::span<const mgis::real>(r, 9));
+  } catch (...) {
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of
+   // mgis_bv_behaviour_rotate_array_of_thermodynamic_forces_with_executor
+
+mgis_status
+mgis_bv_behaviour_rotate_array_of_tangent_operator_blocks_with_executor(
+    mgis_Executor* const e,
+    mgis_real* const gto,
+    const mgis_bv_Behaviour* const b,
+    const mgis_real* const mto,
+    const mgis_real* const r,
+    const mgis_size_type s) {
+  if ((e == nullptr) || (b == nullptr)) {
+    return mgis_report_failure(
+        "mgis_bv_behaviour_rotate_array_of_tangent_operator_blocks_with_"
+        "executor: null argument");
+  }
+  try {
+    const auto n = s * mgis::behaviour::getTangentOperatorArraySize(*b);
+    mgis::behaviour::rotateTangentOperatorBlocks(
+        *e, mgis::span<mgis::real>(gto, n), *b,
+        mgis::span<const mgis::real>(mto, n),
+        mgis::span<const mgis::real>(r, 9));
+  } catch (...) {
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of
+   // mgis_bv_behaviour_rotate_array_of_tangent_operator_blocks_with_executor
+
 mgis_status mgis_bv_behaviour_get_tangent_operator_array_size(
     mgis::size_type* const s, const mgis_bv_Behaviour* const b) {
   if (b == nullptr) {
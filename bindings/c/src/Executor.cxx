@@ -0,0 +1,79 @@
+/*!
+ * \file   Executor.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include "MGIS/Executor.h"
+
+extern "C" {
+
+mgis_status mgis_create_thread_pool_executor(mgis_Executor** e,
+                                             mgis_ThreadPool* const p) {
+  *e = nullptr;
+  if (p == nullptr) {
+    return mgis_report_failure(
+        "mgis_create_thread_pool_executor: null thread pool");
+  }
+  try {
+    *e = new mgis::ThreadPoolExecutor(*p);
+  } catch (...) {
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of mgis_create_thread_pool_executor
+
+mgis_status mgis_create_openmp_executor(mgis_Executor** e,
+                                        const mgis_size_type n) {
+  *e = nullptr;
+  try {
+    *e = new mgis::OpenMPExecutor(n);
+  } catch (...) {
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of mgis_create_openmp_executor
+
+mgis_status mgis_create_callback_executor(mgis_Executor** e,
+                                          mgis_executor_callback c,
+                                          void* const d,
+                                          const mgis_size_type n) {
+  *e = nullptr;
+  try {
+    *e = new mgis::CallbackExecutor(c, d, n);
+  } catch (...) {
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of mgis_create_callback_executor
+
+mgis_status mgis_executor_get_number_of_chunks(mgis_size_type* const n,
+                                               const mgis_Executor* const e) {
+  if (e == nullptr) {
+    return mgis_report_failure(
+        "mgis_executor_get_number_of_chunks: null executor");
+  }
+  *n = e->getNumberOfChunks();
+  return mgis_report_success();
+}  // end of mgis_executor_get_number_of_chunks
+
+mgis_status mgis_free_executor(mgis_Executor** e) {
+  try {
+    delete *e;
+    *e = nullptr;
+  } catch (...) {
+    *e = nullptr;
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of mgis_free_executor
+
+}  // end of extern "C"
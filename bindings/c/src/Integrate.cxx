@@ -11,6 +11,7 @@
  * project under specific licensing conditions.
  */
 
+#include <algorithm>
 #include "MGIS/Raise.hxx"
 #include "MGIS/Behaviour/BehaviourDataView.h"
 #include "MGIS/Behaviour/Behaviour.h"
@@ -100,4 +101,412 @@ mgis_status mgis_bv_integrate_material_data_manager_part(
   return mgis_report_success();
 }  // end of mgis_bv_integrate_material_data_manager_part
 
+mgis_status mgis_bv_create_behaviour_integration_options(
+    mgis_bv_BehaviourIntegrationOptions** o) {
+  *o = nullptr;
+  try {
+    *o = new mgis::behaviour::BehaviourIntegrationOptions();
+  } catch (...) {
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of mgis_bv_create_behaviour_integration_options
+
+mgis_status mgis_bv_behaviour_integration_options_set_integration_type(
+    mgis_bv_BehaviourIntegrationOptions* const o,
+    const mgis_bv_IntegrationType i) {
+  if (o == nullptr) {
+    return mgis_report_failure(
+        "mgis_bv_behaviour_integration_options_set_integration_type: "
+        "null argument");
+  }
+  try {
+    o->integration_type = convertIntegrationType(i);
+  } catch (...) {
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of mgis_bv_behaviour_integration_options_set_integration_type
+
+mgis_status mgis_bv_behaviour_integration_options_set_speed_of_sound_flag(
+    mgis_bv_BehaviourIntegrationOptions* const o, const int b) {
+  if (o == nullptr) {
+    return mgis_report_failure(
+        "mgis_bv_behaviour_integration_options_set_speed_of_sound_flag: "
+        "null argument");
+  }
+  o->compute_speed_of_sound = (b != 0);
+  return mgis_report_success();
+}  // end of mgis_bv_behaviour_integration_options_set_speed_of_sound_flag
+
+mgis_status mgis_bv_behaviour_integration_options_set_integration_costs_flag(
+    mgis_bv_BehaviourIntegrationOptions* const o, const int b) {
+  if (o == nullptr) {
+    return mgis_report_failure(
+        "mgis_bv_behaviour_integration_options_set_integration_costs_flag: "
+        "null argument");
+  }
+  o->measure_integration_costs = (b != 0);
+  return mgis_report_success();
+}  // end of mgis_bv_behaviour_integration_options_set_integration_costs_flag
+
+mgis_status mgis_bv_free_behaviour_integration_options(
+    mgis_bv_BehaviourIntegrationOptions** o) {
+  delete *o;
+  *o = nullptr;
+  return mgis_report_success();
+}  // end of mgis_bv_free_behaviour_integration_options
+
+mgis_status mgis_bv_create_behaviour_integration_result(
+    mgis_bv_BehaviourIntegrationResult** r) {
+  *r = nullptr;
+  try {
+    *r = new mgis::behaviour::BehaviourIntegrationResult();
+  } catch (...) {
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of mgis_bv_create_behaviour_integration_result
+
+mgis_status mgis_bv_behaviour_integration_result_get_exit_status(
+    int* const s, const mgis_bv_BehaviourIntegrationResult* const r) {
+  if (r == nullptr) {
+    return mgis_report_failure(
+        "mgis_bv_behaviour_integration_result_get_exit_status: "
+        "null argument");
+  }
+  *s = r->exit_status;
+  return mgis_report_success();
+}  // end of mgis_bv_behaviour_integration_result_get_exit_status
+
+mgis_status mgis_bv_behaviour_integration_result_get_time_step_increase_factor(
+    mgis_real* const rdt, const mgis_bv_BehaviourIntegrationResult* const r) {
+  if (r == nullptr) {
+    return mgis_report_failure(
+        "mgis_bv_behaviour_integration_result_get_time_step_increase_factor: "
+        "null argument");
+  }
+  *rdt = r->time_step_increase_factor;
+  return mgis_report_success();
+}  // end of mgis_bv_behaviour_integration_result_get_time_step_increase_factor
+
+mgis_status mgis_bv_behaviour_integration_result_get_integration_point_number(
+    mgis_size_type* const n, const mgis_bv_BehaviourIntegrationResult* const r) {
+  if (r == nullptr) {
+    return mgis_report_failure(
+        "mgis_bv_behaviour_integration_result_get_integration_point_number: "
+        "null argument");
+  }
+  *n = r->n;
+  return mgis_report_success();
+}  // end of mgis_bv_behaviour_integration_result_get_integration_point_number
+
+mgis_status mgis_bv_behaviour_integration_result_get_error_message(
+    const char** m, const mgis_bv_BehaviourIntegrationResult* const r) {
+  if (r == nullptr) {
+    return mgis_report_failure(
+        "mgis_bv_behaviour_integration_result_get_error_message: "
+        "null argument");
+  }
+  *m = r->error_message.c_str();
+  return mgis_report_success();
+}  // end of mgis_bv_behaviour_integration_result_get_error_message
+
+mgis_status mgis_bv_free_behaviour_integration_result(
+    mgis_bv_BehaviourIntegrationResult** r) {
+  delete *r;
+  *r = nullptr;
+  return mgis_report_success();
+}  // end of mgis_bv_free_behaviour_integration_result
+
+mgis_status mgis_bv_create_multi_threaded_behaviour_integration_result(
+    mgis_bv_MultiThreadedBehaviourIntegrationResult** r) {
+  *r = nullptr;
+  try {
+    *r = new mgis::behaviour::MultiThreadedBehaviourIntegrationResult();
+  } catch (...) {
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of mgis_bv_create_multi_threaded_behaviour_integration_result
+
+mgis_status mgis_bv_multi_threaded_behaviour_integration_result_get_exit_status(
+    int* const s, const mgis_bv_MultiThreadedBehaviourIntegrationResult* const r) {
+  if (r == nullptr) {
+    return mgis_report_failure(
+        "mgis_bv_multi_threaded_behaviour_integration_result_get_exit_status: "
+        "null argument");
+  }
+  *s = r->exit_status;
+  return mgis_report_success();
+}  // end of mgis_bv_multi_threaded_behaviour_integration_result_get_exit_status
+
+mgis_status
+mgis_bv_multi_threaded_behaviour_integration_result_get_number_of_results(
+    mgis_size_type* const n,
+    const mgis_bv_MultiThreadedBehaviourIntegrationResult* const r) {
+  if (r == nullptr) {
+    return mgis_report_failure(
+        "mgis_bv_multi_threaded_behaviour_integration_result_get_number_of_"
+        "results: null argument");
+  }
+  *n = r->results.size();
+  return mgis_report_success();
+}  // end of
+   // mgis_bv_multi_threaded_behaviour_integration_result_get_number_of_results
+
+mgis_status mgis_bv_multi_threaded_behaviour_integration_result_get_result(
+    const mgis_bv_BehaviourIntegrationResult** ri,
+    const mgis_bv_MultiThreadedBehaviourIntegrationResult* const r,
+    const mgis_size_type i) {
+  *ri = nullptr;
+  if (r == nullptr) {
+    return mgis_report_failure(
+        "mgis_bv_multi_threaded_behaviour_integration_result_get_result: "
+        "null argument");
+  }
+  if (i >= r->results.size()) {
+    return mgis_report_failure(
+        "mgis_bv_multi_threaded_behaviour_integration_result_get_result: "
+        "invalid index");
+  }
+  *ri = &(r->results[i]);
+  return mgis_report_success();
+}  // end of mgis_bv_multi_threaded_behaviour_integration_result_get_result
+
+mgis_status
+mgis_bv_multi_threaded_behaviour_integration_result_get_time_step_increase_factor(
+    mgis_real* const rdt,
+    const mgis_bv_MultiThreadedBehaviourIntegrationResult* const r) {
+  if (r == nullptr) {
+    return mgis_report_failure(
+        "mgis_bv_multi_threaded_behaviour_integration_result_get_time_step_"
+        "increase_factor: null argument");
+  }
+  *rdt = mgis::behaviour::BehaviourIntegrationResult{}.time_step_increase_factor;
+  for (const auto& ri : r->results) {
+    *rdt = std::min(*rdt, ri.time_step_increase_factor);
+  }
+  return mgis_report_success();
+}  // end of
+   // mgis_bv_multi_threaded_behaviour_integration_result_get_time_step_increase_factor
+
+mgis_status mgis_bv_free_multi_threaded_behaviour_integration_result(
+    mgis_bv_MultiThreadedBehaviourIntegrationResult** r) {
+  delete *r;
+  *r = nullptr;
+  return mgis_report_success();
+}  // end of mgis_bv_free_multi_threaded_behaviour_integration_result
+
+/*!
+ * \brief convert a result to a status
+ * \param[in] r: result
+ */
+static mgis_status convertToStatus(
+    const mgis::behaviour::BehaviourIntegrationResult& r) {
+  if (r.exit_status == -1) {
+    if (r.error_message.empty()) {
+      return mgis_report_failure("behaviour integration failed");
+    }
+    return mgis_report_failure(r.error_message.c_str());
+  }
+  return mgis_report_success();
+}  // end of convertToStatus
+
+/*!
+ * \brief convert a result to a status
+ * \param[in] r: result
+ */
+static mgis_status convertMultiThreadedResultToStatus(
+    const mgis::behaviour::MultiThreadedBehaviourIntegrationResult& r) {
+  if (r.exit_status == -1) {
+    for (const auto& ri : r.results) {
+      if (ri.exit_status == -1) {
+        return convertToStatus(ri);
+      }
+    }
+    return mgis_report_failure("behaviour integration failed");
+  }
+  return mgis_report_success();
+}  // end of convertMultiThreadedResultToStatus
+
+mgis_status mgis_bv_integrate_material_data_manager_part_2(
+    mgis_bv_BehaviourIntegrationResult* const r,
+    mgis_bv_MaterialDataManager* const m,
+    const mgis_bv_BehaviourIntegrationOptions* const o,
+    const mgis_real dt,
+    const mgis_size_type b,
+    const mgis_size_type e) {
+  if ((r == nullptr) || (m == nullptr) || (o == nullptr)) {
+    return mgis_report_failure(
+        "mgis_bv_integrate_material_data_manager_part_2: null argument");
+  }
+  try {
+    *r = mgis::behaviour::integrate(*m, *o, dt, b, e);
+  } catch (...) {
+    r->exit_status = -1;
+    return mgis_handle_cxx_exception();
+  }
+  return convertToStatus(*r);
+}  // end of mgis_bv_integrate_material_data_manager_part_2
+
+mgis_status mgis_bv_integrate_material_data_manager_2(
+    mgis_bv_MultiThreadedBehaviourIntegrationResult* const r,
+    mgis_ThreadPool* const p,
+    mgis_bv_MaterialDataManager* const m,
+    const mgis_bv_BehaviourIntegrationOptions* const o,
+    const mgis_real dt) {
+  if ((r == nullptr) || (p == nullptr) || (m == nullptr) || (o == nullptr)) {
+    return mgis_report_failure(
+        "mgis_bv_integrate_material_data_manager_2: null argument");
+  }
+  try {
+    *r = mgis::behaviour::integrate(*p, *m, *o, dt);
+  } catch (...) {
+    r->exit_status = -1;
+    return mgis_handle_cxx_exception();
+  }
+  return convertMultiThreadedResultToStatus(*r);
+}  // end of mgis_bv_integrate_material_data_manager_2
+
+mgis_status mgis_bv_integrate_material_data_manager_with_executor(
+    mgis_bv_MultiThreadedBehaviourIntegrationResult* const r,
+    mgis_Executor* const e,
+    mgis_bv_MaterialDataManager* const m,
+    const mgis_bv_BehaviourIntegrationOptions* const o,
+    const mgis_real dt) {
+  if ((r == nullptr) || (e == nullptr) || (m == nullptr) || (o == nullptr)) {
+    return mgis_report_failure(
+        "mgis_bv_integrate_material_data_manager_with_executor: "
+        "null argument");
+  }
+  try {
+    *r = mgis::behaviour::integrate(*e, *m, *o, dt);
+  } catch (...) {
+    r->exit_status = -1;
+    return mgis_handle_cxx_exception();
+  }
+  return convertMultiThreadedResultToStatus(*r);
+}  // end of mgis_bv_integrate_material_data_manager_with_executor
+
+mgis_status mgis_bv_execute_material_data_manager_post_processing_part(
+    mgis_bv_BehaviourIntegrationResult* const r,
+    mgis_real* const o,
+    const mgis_size_type os,
+    mgis_bv_MaterialDataManager* const m,
+    const char* const n,
+    const mgis_size_type b,
+    const mgis_size_type e) {
+  if ((r == nullptr) || (m == nullptr) || (n == nullptr)) {
+    return mgis_report_failure(
+        "mgis_bv_execute_material_data_manager_post_processing_part: "
+        "null argument");
+  }
+  try {
+    *r = mgis::behaviour::executePostProcessing(mgis::span<mgis::real>(o, os),
+                                                *m, n, b, e);
+  } catch (...) {
+    r->exit_status = -1;
+    return mgis_handle_cxx_exception();
+  }
+  return convertToStatus(*r);
+}  // end of mgis_bv_execute_material_data_manager_post_processing_part
+
+mgis_status mgis_bv_execute_material_data_manager_post_processing(
+    mgis_bv_MultiThreadedBehaviourIntegrationResult* const r,
+    mgis_real* const o,
+    const mgis_size_type os,
+    mgis_ThreadPool* const p,
+    mgis_bv_MaterialDataManager* const m,
+    const char* const n) {
+  if ((r == nullptr) || (p == nullptr) || (m == nullptr) || (n == nullptr)) {
+    return mgis_report_failure(
+        "mgis_bv_execute_material_data_manager_post_processing: "
+        "null argument");
+  }
+  try {
+    *r = mgis::behaviour::executePostProcessing(mgis::span<mgis::real>(o, os),
+                                                *p, *m, n);
+  } catch (...) {
+    r->exit_status = -1;
+    return mgis_handle_cxx_exception();
+  }
+  return convertMultiThreadedResultToStatus(*r);
+}  // end of mgis_bv_execute_material_data_manager_post_processing
+
+mgis_status mgis_bv_execute_material_data_manager_post_processing_with_executor(
+    mgis_bv_MultiThreadedBehaviourIntegrationResult* const r,
+    mgis_real* const o,
+    const mgis_size_type os,
+    mgis_Executor* const e,
+    mgis_bv_MaterialDataManager* const m,
+    const char* const n) {
+  if ((r == nullptr) || (e == nullptr) || (m == nullptr) || (n == nullptr)) {
+    return mgis_report_failure(
+        "mgis_bv_execute_material_data_manager_post_processing_with_executor: "
+        "null argument");
+  }
+  try {
+    *r = mgis::behaviour::executePostProcessing(mgis::span<mgis::real>(o, os),
+                                                *e, *m, n);
+  } catch (...) {
+    r->exit_status = -1;
+    return mgis_handle_cxx_exception();
+  }
+  return convertMultiThreadedResultToStatus(*r);
+}  // end of mgis_bv_execute_material_data_manager_post_processing_with_executor
+
+mgis_status mgis_bv_execute_material_data_manager_initialize_function_part(
+    mgis_bv_BehaviourIntegrationResult* const r,
+    mgis_bv_MaterialDataManager* const m,
+    const char* const n,
+    const mgis_real* const i,
+    const mgis_size_type is,
+    const mgis_size_type b,
+    const mgis_size_type e) {
+  if ((r == nullptr) || (m == nullptr) || (n == nullptr)) {
+    return mgis_report_failure(
+        "mgis_bv_execute_material_data_manager_initialize_function_part: "
+        "null argument");
+  }
+  try {
+    if (i == nullptr) {
+      *r = mgis::behaviour::executeInitializeFunction(*m, n, b, e);
+    } else {
+      *r = mgis::behaviour::executeInitializeFunction(
+          *m, n, mgis::span<const mgis::real>(i, is), b, e);
+    }
+  } catch (...) {
+    r->exit_status = -1;
+    return mgis_handle_cxx_exception();
+  }
+  return convertToStatus(*r);
+}  // end of mgis_bv_execute_material_data_manager_initialize_function_part
+
+mgis_status mgis_bv_execute_material_data_manager_initialize_function(
+    mgis_bv_MultiThreadedBehaviourIntegrationResult* const r,
+    mgis_ThreadPool* const p,
+    mgis_bv_MaterialDataManager* const m,
+    const char* const n,
+    const mgis_real* const i,
+    const mgis_size_type is) {
+  if ((r == nullptr) || (p == nullptr) || (m == nullptr) || (n == nullptr)) {
+    return mgis_report_failure(
+        "mgis_bv_execute_material_data_manager_initialize_function: "
+        "null argument");
+  }
+  try {
+    if (i == nullptr) {
+      *r = mgis::behaviour::executeInitializeFunction(*p, *m, n);
+    } else {
+      *r = mgis::behaviour::executeInitializeFunction(
+          *p, *m, n, mgis::span<const mgis::real>(i, is));
+    }
+  } catch (...) {
+    r->exit_status = -1;
+    return mgis_handle_cxx_exception();
+  }
+  return convertMultiThreadedResultToStatus(*r);
+}  // end of mgis_bv_execute_material_data_manager_initialize_function
+
 }  // end of extern "C"
@@ -0,0 +1,161 @@
+/*!
+ * \file   bindings/c/src/Profiling.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <fstream>
+#include "MGIS/Profiling.h"
+
+static void convertRegionStatistics(
+    mgis_profiling_region_statistics* const o,
+    const mgis::profiling::RegionStatistics& s) {
+  o->calls = s.calls;
+  o->points = s.points;
+  o->failures = s.failures;
+  o->total_time = s.total_time;
+  o->min_time = s.min_time;
+  o->max_time = s.max_time;
+}  // end of convertRegionStatistics
+
+extern "C" {
+
+mgis_status mgis_is_profiling_available(int* const b) {
+  *b = mgis::profiling::isProfilingAvailable();
+  return mgis_report_success();
+}  // end of mgis_is_profiling_available
+
+mgis_status mgis_enable_profiling(const int b) {
+  mgis::profiling::enableProfiling(b != 0);
+  return mgis_report_success();
+}  // end of mgis_enable_profiling
+
+mgis_status mgis_is_profiling_enabled(int* const b) {
+  *b = mgis::profiling::isProfilingEnabled();
+  return mgis_report_success();
+}  // end of mgis_is_profiling_enabled
+
+mgis_status mgis_reset_profiling(void) {
+  try {
+    mgis::profiling::resetProfiling();
+  } catch (...) {
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of mgis_reset_profiling
+
+mgis_status mgis_get_profiling_report(mgis_ProfilingReport** r) {
+  *r = nullptr;
+  try {
+    *r = new mgis::profiling::ProfilingReport(
+        mgis::profiling::getProfilingReport());
+  } catch (...) {
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of mgis_get_profiling_report
+
+mgis_status mgis_profiling_report_get_number_of_threads(
+    mgis_size_type* const n, const mgis_ProfilingReport* const r) {
+  if (r == nullptr) {
+    return mgis_report_failure(
+        "mgis_profiling_report_get_number_of_threads: null report");
+  }
+  *n = r->threads.size();
+  return mgis_report_success();
+}  // end of mgis_profiling_report_get_number_of_threads
+
+mgis_status mgis_profiling_report_get_statistics(
+    mgis_profiling_region_statistics* const s,
+    const mgis_ProfilingReport* const r,
+    const char* const n) {
+  if (r == nullptr) {
+    return mgis_report_failure(
+        "mgis_profiling_report_get_statistics: null report");
+  }
+  try {
+    convertRegionStatistics(s, r->getTotal(mgis::profiling::getRegion(n)));
+  } catch (...) {
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of mgis_profiling_report_get_statistics
+
+mgis_status mgis_profiling_report_get_thread_statistics(
+    mgis_profiling_region_statistics* const s,
+    const mgis_ProfilingReport* const r,
+    const mgis_size_type t,
+    const char* const n) {
+  if (r == nullptr) {
+    return mgis_report_failure(
+        "mgis_profiling_report_get_thread_statistics: null report");
+  }
+  if (t >= r->threads.size()) {
+    return mgis_report_failure(
+        "mgis_profiling_report_get_thread_statistics: invalid thread index");
+  }
+  try {
+    const auto region = mgis::profiling::getRegion(n);
+    convertRegionStatistics(
+        s, r->threads[t].regions[static_cast<mgis_size_type>(region)]);
+  } catch (...) {
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of mgis_profiling_report_get_thread_statistics
+
+mgis_status mgis_profiling_report_get_load_imbalance(
+    mgis_real* const l,
+    const mgis_ProfilingReport* const r,
+    const char* const n) {
+  if (r == nullptr) {
+    return mgis_report_failure(
+        "mgis_profiling_report_get_load_imbalance: null report");
+  }
+  try {
+    *l = r->getLoadImbalance(mgis::profiling::getRegion(n));
+  } catch (...) {
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of mgis_profiling_report_get_load_imbalance
+
+mgis_status mgis_profiling_report_write_json(
+    const mgis_ProfilingReport* const r, const char* const f) {
+  if (r == nullptr) {
+    return mgis_report_failure(
+        "mgis_profiling_report_write_json: null report");
+  }
+  try {
+    std::ofstream out(f);
+    if (!out) {
+      return mgis_report_failure(
+          "mgis_profiling_report_write_json: can't open file");
+    }
+    mgis::profiling::print_json(out, *r);
+  } catch (...) {
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of mgis_profiling_report_write_json
+
+mgis_status mgis_free_profiling_report(mgis_ProfilingReport** r) {
+  try {
+    delete *r;
+    *r = nullptr;
+  } catch (...) {
+    *r = nullptr;
+    return mgis_handle_cxx_exception();
+  }
+  return mgis_report_success();
+}  // end of mgis_free_profiling_report
+
+}  // end of extern "C"
@@ -111,7 +111,136 @@ namespace mgis::python {
                                          const mgis::size_type,
                                          const mgis::size_type);
 
-  mgis::span<mgis::real> mgis_convert_to_span(const boost::python::object&);
+  /*!
+   * \brief create a strided ndarray object describing the values of a
+   * variable stored in a larger array.
+   *
+   * If the variable is a scalar, an 1D-ndarray is returned. Otherwise, a
+   * 2D-ndarray is returned, each line corresponding to an integration point.
+   * The ndarray does not own the data.
+   *
+   * \param[in] v: pointer to the values of the variable at the first
+   * integration point
+   * \param[in] n: number of integration points
+   * \param[in] nc: size of the variable
+   * \param[in] stride: distance between the values associated with two
+   * consecutive integration points
+   */
+  boost::python::object wrapInStridedNumPyArray(double* const,
+                                                const mgis::size_type,
+                                                const mgis::size_type,
+                                                const mgis::size_type);
+  /*!
+   * \brief make the given ndarray refer to the object owning its memory.
+   *
+   * The owner is kept alive as long as the ndarray (or any view derived from
+   * it) exists, so that the ndarray can safely be used after all the other
+   * references to the owner have been released.
+   *
+   * \return the ndarray
+   * \param[in] a: ndarray created by one of the `wrapInNumPyArray` functions
+   * \param[in] o: owner of the memory. If `None`, the ndarray is not modified.
+   */
+  boost::python::object setNumPyArrayOwner(boost::python::object,
+                                           const boost::python::object&);
+  /*!
+   * \brief a view of the memory of a python object, as returned by the
+   * `mgis_convert_to_span` and `mgis_convert_to_const_span` functions.
+   *
+   * If the memory is exposed through the buffer protocol, the buffer is held
+   * by the view, so that the exporter can't resize or free the memory while
+   * the view exists.
+   *
+   * \note the view must be destroyed while the GIL is held.
+   * \note the view must not be stored beyond the call in which it is created.
+   * Arrays kept by MGIS must be converted using the
+   * `mgis_convert_to_external_span` function.
+   */
+  template <typename ValueType>
+  struct ArrayView : mgis::span<ValueType> {
+    /*!
+     * \brief constructor from a view of the data of a ndarray
+     * \param[in] v: values
+     */
+    ArrayView(const mgis::span<ValueType> v) : mgis::span<ValueType>(v) {}
+    /*!
+     * \brief constructor taking the ownership of a buffer
+     * \param[in] v: values
+     * \param[in] b: buffer, released by the destructor
+     */
+    ArrayView(const mgis::span<ValueType> v, const Py_buffer& b)
+        : mgis::span<ValueType>(v), buffer(b), has_buffer(true) {}
+    //! \brief move constructor
+    ArrayView(ArrayView&&) = delete;
+    //! \brief copy constructor
+    ArrayView(const ArrayView&) = delete;
+    //! \brief move assignement
+    ArrayView& operator=(ArrayView&&) = delete;
+    //! \brief copy assignement
+    ArrayView& operator=(const ArrayView&) = delete;
+    //! \brief destructor
+    ~ArrayView() {
+      if (this->has_buffer) {
+        PyBuffer_Release(&(this->buffer));
+      }
+    }
+
+   private:
+    //! \brief buffer, if any
+    Py_buffer buffer;
+    //! \brief boolean stating if the buffer must be released
+    bool has_buffer = false;
+  };  // end of struct ArrayView
+
+  /*!
+   * \brief return a view of the memory of a python object.
+   *
+   * No copy is made. The following objects are accepted:
+   *
+   * - C-contiguous ndarrays of `float64` of any dimension, using the native
+   *   byte order, which are seen as flat arrays.
+   * - objects exposing a C-contiguous buffer of native `double` values
+   *   through the buffer protocol (`memoryview`, `array.array('d')`, etc.).
+   *
+   * The memory must be writable: read-only ndarrays and buffers are
+   * rejected.
+   *
+   * \note the python object must outlive the returned view.
+   */
+  ArrayView<mgis::real> mgis_convert_to_span(const boost::python::object&);
+  /*!
+   * \brief return a read-only view of the memory of a python object.
+   *
+   * This function accepts the same objects than `mgis_convert_to_span`,
+   * including read-only ones.
+   *
+   * \note the python object must outlive the returned view.
+   */
+  ArrayView<const mgis::real> mgis_convert_to_const_span(
+      const boost::python::object&);
+  /*!
+   * \brief return a view of the memory of a writable ndarray meant to be
+   * kept by MGIS, for example as an external storage.
+   *
+   * Objects exposing their memory through the buffer protocol are rejected,
+   * since their memory may be resized or freed once the buffer is released.
+   *
+   * \note the ndarray must outlive the use of the returned span.
+   */
+  mgis::span<mgis::real> mgis_convert_to_external_span(
+      const boost::python::object&);
+  /*!
+   * \brief return a view of an one dimensional C-contiguous ndarray of
+   * integers, without copy.
+   *
+   * The integer type of the ndarray must have the same size than
+   * `mgis::size_type`. Negative values are not checked, but will be seen as
+   * very large indices.
+   *
+   * \note the python object must outlive the returned span.
+   */
+  mgis::span<const mgis::size_type> mgis_convert_to_size_type_span(
+      const boost::python::object&);
 
 }  // end of namespace mgis::python
 
@@ -0,0 +1,52 @@
+/*!
+ * \file   bindings/python/include/MGIS/Python/ReleaseGIL.hxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_PYTHON_RELEASEGIL_HXX
+#define LIB_MGIS_PYTHON_RELEASEGIL_HXX
+
+#include <boost/python/detail/wrap_python.hpp>
+
+namespace mgis::python {
+
+  /*!
+   * \brief an helper structure which releases the python global interpreter
+   * lock (GIL) in its constructor and acquires it back in its destructor.
+   *
+   * \note no python object shall be accessed while the GIL is released. In
+   * particular, all the conversions of the arguments of a function (for
+   * instance using `mgis_convert_to_span`) must be done before creating an
+   * object of this type.
+   */
+  struct ReleaseGIL {
+    //! \brief default constructor
+    ReleaseGIL() : state(PyEval_SaveThread()) {}
+    //! \brief destructor
+    ~ReleaseGIL() { PyEval_RestoreThread(this->state); }
+
+   private:
+    //! \brief move constructor
+    ReleaseGIL(ReleaseGIL&&) = delete;
+    //! \brief copy constructor
+    ReleaseGIL(const ReleaseGIL&) = delete;
+    //! \brief move assignement
+    ReleaseGIL& operator=(ReleaseGIL&&) = delete;
+    //! \brief copy assignement
+    ReleaseGIL& operator=(const ReleaseGIL&) = delete;
+    //! \brief state of the current thread
+    PyThreadState* const state;
+  };  // end of struct ReleaseGIL
+
+}  // end of namespace mgis::python
+
+#endif /* LIB_MGIS_PYTHON_RELEASEGIL_HXX */
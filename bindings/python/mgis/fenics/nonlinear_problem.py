@@ -111,6 +111,13 @@ class AbstractNonlinearProblem:
         self._init = True
 
         self.dt = 0
+        # thread pool used to transfer the values of the gradients, fluxes
+        # and internal state variables between MGIS and FEniCS. If None,
+        # those transfers are sequential.
+        self.thread_pool = None
+        # buffers used to transfer the values of the fluxes and internal
+        # state variables from MGIS to FEniCS
+        self._buffers = {}
 
         if self.material.rotation_matrix is not None:
             if isinstance(self.material.rotation_matrix,
@@ -291,10 +298,39 @@ class AbstractNonlinearProblem:
                     mgis_bv.MaterialStateManagerStorageMode.LocalStorage,
                 )
 
+    def _extract_values(self, f, values, state, name):
+        """
+        Copy the values of the variable `name` of the given state in `values`
+        using the MGIS function `f`
+        """
+        if self.thread_pool is None:
+            f(values, state, name)
+        else:
+            f(self.thread_pool, values, state, name)
+
+    def _set_values(self, f, state, name, values):
+        """
+        Copy `values` in the values of the variable `name` of the given state
+        using the MGIS function `f`
+        """
+        if self.thread_pool is None:
+            f(state, name, values)
+        else:
+            f(self.thread_pool, state, name, values)
+
+    def _get_buffer(self, key, size):
+        """
+        Return a buffer able to store the values of a variable of the given
+        size at each integration point. Buffers are allocated once and reused.
+        """
+        b = self._buffers.get(key, None)
+        if b is None:
+            b = np.empty(self.material.data_manager.n * size)
+            self._buffers[key] = b
+        return b
+
     def initialize_gradients(self):
-        buff = 0
-        for (g, size) in zip(self.material.get_gradient_names(),
-                             self.material.get_gradient_sizes()):
+        for g in self.material.get_gradient_names():
             gradient = self.gradients[g]
             try:
                 gradient.initialize_function(self.mesh, self.quadrature_degree)
@@ -302,14 +338,8 @@ class AbstractNonlinearProblem:
                 raise ValueError(
                     "Gradient '{}' has not been registered.".format(g))
             grad_vals = gradient.function.vector().get_local()
-            if gradient.shape > 0:
-                grad_vals = grad_vals.reshape(
-                    (self.material.data_manager.n, gradient.shape))
-            else:
-                grad_vals = grad_vals[:, np.newaxis]
-            self.material.data_manager.s0.gradients[:, buff:buff +
-                                                    size] = grad_vals
-            buff += size
+            self._set_values(mgis_bv.setGradient,
+                             self.material.data_manager.s0, g, grad_vals)
 
     def initialize_fluxes(self):
         fluxes = []
@@ -430,73 +460,51 @@ class AbstractNonlinearProblem:
             buff += block_shape
 
     def update_fluxes(self):
-        buff = 0
-        for (i, f) in enumerate(self.material.get_flux_names()):
+        for (f, size) in zip(self.material.get_flux_names(),
+                             self.material.get_flux_sizes()):
             flux = self.fluxes[f]
-            block_shape = self.material.get_flux_sizes()[i]
-            flux_vals = self.material.data_manager.s1.thermodynamic_forces[:,
-                                                                           buff:
-                                                                           buff
-                                                                           +
-                                                                           block_shape].ravel(
-                                                                           )
+            flux_vals = self._get_buffer(("flux", f), size)
+            self._extract_values(mgis_bv.extractThermodynamicForce, flux_vals,
+                                 self.material.data_manager.s1, f)
             if self.material.rotation_matrix is not None:
                 mgis_bv.rotateThermodynamicForces(flux_vals,
                                                   self.material.behaviour,
                                                   self.rotation_values)
             flux.function.vector().set_local(flux_vals)
             flux.function.vector().apply("insert")
-            buff += block_shape
 
     def update_gradients(self):
-        buff = 0
-        for (i, g) in enumerate(self.material.get_gradient_names()):
+        for g in self.material.get_gradient_names():
             gradient = self.gradients[g]
             gradient.update()
-            block_shape = self.material.get_gradient_sizes()[i]
             grad_vals = gradient.function.vector().get_local()
             if self.material.rotation_matrix is not None:
                 mgis_bv.rotateGradients(grad_vals, self.material.behaviour,
                                         self.rotation_values)
-            if gradient.shape > 0:
-                grad_vals = grad_vals.reshape(
-                    (self.material.data_manager.n, gradient.shape))
-            else:
-                grad_vals = grad_vals[:, np.newaxis]
-            self.material.data_manager.s1.gradients[:, buff:buff +
-                                                    block_shape] = grad_vals
-            buff += block_shape
+            self._set_values(mgis_bv.setGradient,
+                             self.material.data_manager.s1, g, grad_vals)
 
     def update_internal_state_variables(self):
         """Performs update of internal state variables"""
-        buff = 0
-        for (i, s) in enumerate(
-                self.material.get_internal_state_variable_names()):
+        for (s, size) in zip(
+                self.material.get_internal_state_variable_names(),
+                self.material.get_internal_state_variable_sizes(),
+        ):
             state_var = self.state_variables["internal"][s].function
-            block_shape = self.material.get_internal_state_variable_sizes()[i]
-            state_var.vector().set_local(
-                self.material.data_manager.s1.
-                internal_state_variables[:, buff:buff + block_shape].flatten())
+            state_var_vals = self._get_buffer(("internal", s), size)
+            self._extract_values(mgis_bv.extractInternalStateVariable,
+                                 state_var_vals,
+                                 self.material.data_manager.s1, s)
+            state_var.vector().set_local(state_var_vals)
             state_var.vector().apply("insert")
-            buff += block_shape
 
     def set_internal_state_variables(self):
         """Set initial value of internal state variables"""
-        buff = 0
-        for (i, s) in enumerate(
-                self.material.get_internal_state_variable_names()):
+        for s in self.material.get_internal_state_variable_names():
             state_var = self.state_variables["internal"][s]
             state_var_vals = state_var.function.vector().get_local()
-            if state_var.shape > 0:
-                state_var_vals = state_var_vals.reshape(
-                    (self.material.data_manager.n, state_var.shape))
-            else:
-                state_var_vals = state_var_vals[:, np.newaxis]
-            block_shape = self.material.get_internal_state_variable_sizes()[i]
-            self.material.data_manager.s0.internal_state_variables[:,
-                                                                   buff:buff +
-                                                                   block_shape] = state_var_vals
-            buff += block_shape
+            self._set_values(mgis_bv.setInternalStateVariable,
+                             self.material.data_manager.s0, s, state_var_vals)
 
     def add_before_update_constitutive_law_callback(self, c):
         """
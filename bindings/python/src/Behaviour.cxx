@@ -17,6 +17,7 @@
 #include <boost/python/def.hpp>
 #include "MGIS/Python/VectorConverter.hxx"
 #include "MGIS/Python/NumPySupport.hxx"
+#include "MGIS/Python/ReleaseGIL.hxx"
 #include "MGIS/Raise.hxx"
 #include "MGIS/Behaviour/Behaviour.hxx"
 
@@ -130,15 +131,19 @@ static void rotate_gradients_in_place_member(
     const mgis::behaviour::Behaviour &b,
     boost::python::object &g,
     boost::python::object &r) {
-  mgis::behaviour::rotateGradients(mgis::python::mgis_convert_to_span(g), b,
-                                   mgis::python::mgis_convert_to_span(r));
+  const auto g_values = mgis::python::mgis_convert_to_span(g);
+  const auto r_values = mgis::python::mgis_convert_to_const_span(r);
+  mgis::python::ReleaseGIL gil;
+  mgis::behaviour::rotateGradients(g_values, b, r_values);
 }  // end of rotate_gradients_in_place_member
 
 static void rotate_gradients_in_place(boost::python::object &g,
                                       const mgis::behaviour::Behaviour &b,
                                       boost::python::object &r) {
-  mgis::behaviour::rotateGradients(mgis::python::mgis_convert_to_span(g), b,
-                                   mgis::python::mgis_convert_to_span(r));
+  const auto g_values = mgis::python::mgis_convert_to_span(g);
+  const auto r_values = mgis::python::mgis_convert_to_const_span(r);
+  mgis::python::ReleaseGIL gil;
+  mgis::behaviour::rotateGradients(g_values, b, r_values);
 }  // end of rotate_gradients_in_place
 
 static void rotate_gradients_out_of_place_member(
@@ -146,36 +151,44 @@ static void rotate_gradients_out_of_place_member(
     boost::python::object &mg,
     boost::python::object &gg,
     boost::python::object &r) {
-  mgis::behaviour::rotateGradients(mgis::python::mgis_convert_to_span(mg), b,
-                                   mgis::python::mgis_convert_to_span(gg),
-                                   mgis::python::mgis_convert_to_span(r));
+  const auto mg_values = mgis::python::mgis_convert_to_span(mg);
+  const auto gg_values =
+      mgis::python::mgis_convert_to_const_span(gg);
+  const auto r_values = mgis::python::mgis_convert_to_const_span(r);
+  mgis::python::ReleaseGIL gil;
+  mgis::behaviour::rotateGradients(mg_values, b, gg_values, r_values);
 }  // end of rotate_gradients_out_of_place_member
 
 static void rotate_gradients_out_of_place(boost::python::object &mg,
                                           const mgis::behaviour::Behaviour &b,
                                           boost::python::object &gg,
                                           boost::python::object &r) {
-  mgis::behaviour::rotateGradients(mgis::python::mgis_convert_to_span(mg), b,
-                                   mgis::python::mgis_convert_to_span(gg),
-                                   mgis::python::mgis_convert_to_span(r));
+  const auto mg_values = mgis::python::mgis_convert_to_span(mg);
+  const auto gg_values =
+      mgis::python::mgis_convert_to_const_span(gg);
+  const auto r_values = mgis::python::mgis_convert_to_const_span(r);
+  mgis::python::ReleaseGIL gil;
+  mgis::behaviour::rotateGradients(mg_values, b, gg_values, r_values);
 }  // end of rotate_gradients_out_of_place
 
 static void rotate_thermodynamic_forces_in_place_member(
     const mgis::behaviour::Behaviour &b,
     boost::python::object &g,
     boost::python::object &r) {
-  mgis::behaviour::rotateThermodynamicForces(
-      mgis::python::mgis_convert_to_span(g), b,
-      mgis::python::mgis_convert_to_span(r));
+  const auto g_values = mgis::python::mgis_convert_to_span(g);
+  const auto r_values = mgis::python::mgis_convert_to_const_span(r);
+  mgis::python::ReleaseGIL gil;
+  mgis::behaviour::rotateThermodynamicForces(g_values, b, r_values);
 }  // end of rotate_thermodynamic_forces_in_place_member
 
 static void rotate_thermodynamic_forces_in_place(
     boost::python::object &g,
     const mgis::behaviour::Behaviour &b,
     boost::python::object &r) {
-  mgis::behaviour::rotateThermodynamicForces(
-      mgis::python::mgis_convert_to_span(g), b,
-      mgis::python::mgis_convert_to_span(r));
+  const auto g_values = mgis::python::mgis_convert_to_span(g);
+  const auto r_values = mgis::python::mgis_convert_to_const_span(r);
+  mgis::python::ReleaseGIL gil;
+  mgis::behaviour::rotateThermodynamicForces(g_values, b, r_values);
 }  // end of rotate_thermodynamic_forces_in_place
 
 static void rotate_thermodynamic_forces_out_of_place_member(
@@ -183,10 +196,13 @@ static void rotate_thermodynamic_forces_out_of_place_member(
     boost::python::object &mg,
     boost::python::object &gg,
     boost::python::object &r) {
-  mgis::behaviour::rotateThermodynamicForces(
-      mgis::python::mgis_convert_to_span(mg), b,
-      mgis::python::mgis_convert_to_span(gg),
-      mgis::python::mgis_convert_to_span(r));
+  const auto mg_values = mgis::python::mgis_convert_to_span(mg);
+  const auto gg_values =
+      mgis::python::mgis_convert_to_const_span(gg);
+  const auto r_values = mgis::python::mgis_convert_to_const_span(r);
+  mgis::python::ReleaseGIL gil;
+  mgis::behaviour::rotateThermodynamicForces(mg_values, b, gg_values,
+                                             r_values);
 }  // end of rotate_thermodynamic_forces_out_of_place_member
 
 static void rotate_thermodynamic_forces_out_of_place(
@@ -194,28 +210,33 @@ static void rotate_thermodynamic_forces_out_of_place(
     const mgis::behaviour::Behaviour &b,
     boost::python::object &gg,
     boost::python::object &r) {
-  mgis::behaviour::rotateThermodynamicForces(
-      mgis::python::mgis_convert_to_span(mg), b,
-      mgis::python::mgis_convert_to_span(gg),
-      mgis::python::mgis_convert_to_span(r));
+  const auto mg_values = mgis::python::mgis_convert_to_span(mg);
+  const auto gg_values =
+      mgis::python::mgis_convert_to_const_span(gg);
+  const auto r_values = mgis::python::mgis_convert_to_const_span(r);
+  mgis::python::ReleaseGIL gil;
+  mgis::behaviour::rotateThermodynamicForces(mg_values, b, gg_values,
+                                             r_values);
 }  // end of rotate_thermodynamic_forces_out_of_place
 
 static void rotate_tangent_operator_blocks_in_place_member(
     const mgis::behaviour::Behaviour &b,
     boost::python::object &g,
     boost::python::object &r) {
-  mgis::behaviour::rotateTangentOperatorBlocks(
-      mgis::python::mgis_convert_to_span(g), b,
-      mgis::python::mgis_convert_to_span(r));
+  const auto g_values = mgis::python::mgis_convert_to_span(g);
+  const auto r_values = mgis::python::mgis_convert_to_const_span(r);
+  mgis::python::ReleaseGIL gil;
+  mgis::behaviour::rotateTangentOperatorBlocks(g_values, b, r_values);
 }  // end of rotate_tangent_operator_blocks_in_place_member
 
 static void rotate_tangent_operator_blocks_in_place(
     boost::python::object &g,
     const mgis::behaviour::Behaviour &b,
     boost::python::object &r) {
-  mgis::behaviour::rotateTangentOperatorBlocks(
-      mgis::python::mgis_convert_to_span(g), b,
-      mgis::python::mgis_convert_to_span(r));
+  const auto g_values = mgis::python::mgis_convert_to_span(g);
+  const auto r_values = mgis::python::mgis_convert_to_const_span(r);
+  mgis::python::ReleaseGIL gil;
+  mgis::behaviour::rotateTangentOperatorBlocks(g_values, b, r_values);
 }  // end of rotate_tangent_operator_blocks_in_place
 
 static void rotate_tangent_operator_blocks_out_of_place_member(
@@ -223,10 +244,13 @@ static void rotate_tangent_operator_blocks_out_of_place_member(
     boost::python::object &mg,
     boost::python::object &gg,
     boost::python::object &r) {
-  mgis::behaviour::rotateTangentOperatorBlocks(
-      mgis::python::mgis_convert_to_span(mg), b,
-      mgis::python::mgis_convert_to_span(gg),
-      mgis::python::mgis_convert_to_span(r));
+  const auto mg_values = mgis::python::mgis_convert_to_span(mg);
+  const auto gg_values =
+      mgis::python::mgis_convert_to_const_span(gg);
+  const auto r_values = mgis::python::mgis_convert_to_const_span(r);
+  mgis::python::ReleaseGIL gil;
+  mgis::behaviour::rotateTangentOperatorBlocks(mg_values, b, gg_values,
+                                               r_values);
 }  // end of rotate_tangent_operator_blocks_out_of_place_member
 
 static void rotate_tangent_operator_blocks_out_of_place(
@@ -234,10 +258,13 @@ static void rotate_tangent_operator_blocks_out_of_place(
     const mgis::behaviour::Behaviour &b,
     boost::python::object &gg,
     boost::python::object &r) {
-  mgis::behaviour::rotateTangentOperatorBlocks(
-      mgis::python::mgis_convert_to_span(mg), b,
-      mgis::python::mgis_convert_to_span(gg),
-      mgis::python::mgis_convert_to_span(r));
+  const auto mg_values = mgis::python::mgis_convert_to_span(mg);
+  const auto gg_values =
+      mgis::python::mgis_convert_to_const_span(gg);
+  const auto r_values = mgis::python::mgis_convert_to_const_span(r);
+  mgis::python::ReleaseGIL gil;
+  mgis::behaviour::rotateTangentOperatorBlocks(mg_values, b, gg_values,
+                                               r_values);
 }  // end of rotate_tangent_operator_blocks_out_of_place
 
 static boost::python::list Behaviour_getInitializeFunctionsNames(
@@ -14,21 +14,24 @@
 
 #include <boost/python/def.hpp>
 #include <boost/python/class.hpp>
+#include <boost/python/extract.hpp>
 #include "MGIS/Python/NumPySupport.hxx"
 #include "MGIS/Behaviour/Behaviour.hxx"
 #include "MGIS/Behaviour/BehaviourData.hxx"
 
 void declareBehaviourData();
 
-static boost::python::object BehaviourData_getK(
-    mgis::behaviour::BehaviourData& d) {
+static boost::python::object BehaviourData_getK(boost::python::object o) {
+  auto& d = boost::python::extract<mgis::behaviour::BehaviourData&>(o)();
   if (d.s0.b.to_blocks.size() == 1u) {
     const auto s =
         getVariableSize(d.s0.b.to_blocks.front().first, d.s0.b.hypothesis);
-    return mgis::python::wrapInNumPyArray(d.K, s);
+    return mgis::python::setNumPyArrayOwner(
+        mgis::python::wrapInNumPyArray(d.K, s), o);
   }
-  return mgis::python::wrapInNumPyArray(d.K);
-}  // end of MaterialStateManager_getK
+  return mgis::python::setNumPyArrayOwner(mgis::python::wrapInNumPyArray(d.K),
+                                          o);
+}  // end of BehaviourData_getK
 
 void declareBehaviourData() {
   using mgis::behaviour::Behaviour;
@@ -15,6 +15,7 @@
 #include <boost/python/enum.hpp>
 #include <boost/python/def.hpp>
 #include "MGIS/Python/NumPySupport.hxx"
+#include "MGIS/Python/ReleaseGIL.hxx"
 #include "MGIS/Behaviour/MaterialDataManager.hxx"
 #include "MGIS/Behaviour/FiniteStrainSupport.hxx"
 
@@ -25,6 +26,7 @@ void py_convertFiniteStrainStress(boost::python::object o,
                                   const mgis::behaviour::MaterialDataManager& m,
                                   const mgis::behaviour::FiniteStrainStress t) {
   auto s = mgis::python::mgis_convert_to_span(o);
+  mgis::python::ReleaseGIL gil;
   mgis::behaviour::convertFiniteStrainStress(s, m, t);
 }  // end of py_py_convertFiniteStrainStress
 
@@ -33,6 +35,7 @@ void py_convertFiniteStrainTangentOperator(
     const mgis::behaviour::MaterialDataManager& m,
     const mgis::behaviour::FiniteStrainTangentOperator t) {
   auto K = mgis::python::mgis_convert_to_span(o);
+  mgis::python::ReleaseGIL gil;
   mgis::behaviour::convertFiniteStrainTangentOperator(K, m, t);
 }  // end of py_py_convertFiniteStrainTangentOperator
 
@@ -20,6 +20,7 @@
 #include "MGIS/Behaviour/MaterialDataManager.hxx"
 #include "MGIS/Behaviour/Integrate.hxx"
 #include "MGIS/Python/NumPySupport.hxx"
+#include "MGIS/Python/ReleaseGIL.hxx"
 #include "MGIS/Python/VectorConverter.hxx"
 
 void declareIntegrate();
@@ -27,14 +28,62 @@ void declareIntegrate();
 static int integrateBehaviourData1(mgis::behaviour::BehaviourData& d,
                                    const mgis::behaviour::Behaviour& b) {
   auto v = mgis::behaviour::make_view(d);
+  mgis::python::ReleaseGIL gil;
   const auto s = mgis::behaviour::integrate(v, b);
   return s;
 }  // end of integrateBehaviourData
 
+static int integrateBehaviourDataView(mgis::behaviour::BehaviourDataView& v,
+                                      const mgis::behaviour::Behaviour& b) {
+  mgis::python::ReleaseGIL gil;
+  return mgis::behaviour::integrate(v, b);
+}  // end of integrateBehaviourDataView
+
+static int MaterialDataManager_integrate(
+    mgis::behaviour::MaterialDataManager& m,
+    const mgis::behaviour::IntegrationType it,
+    const mgis::real dt,
+    const mgis::size_type b,
+    const mgis::size_type e) {
+  mgis::python::ReleaseGIL gil;
+  return mgis::behaviour::integrate(m, it, dt, b, e);
+}  // end of MaterialDataManager_integrate
+
+static int MaterialDataManager_integrate2(
+    mgis::ThreadPool& p,
+    mgis::behaviour::MaterialDataManager& m,
+    const mgis::behaviour::IntegrationType it,
+    const mgis::real dt) {
+  mgis::python::ReleaseGIL gil;
+  return mgis::behaviour::integrate(p, m, it, dt);
+}  // end of MaterialDataManager_integrate2
+
+static mgis::behaviour::BehaviourIntegrationResult
+MaterialDataManager_integrate3(
+    mgis::behaviour::MaterialDataManager& m,
+    const mgis::behaviour::BehaviourIntegrationOptions& opts,
+    const mgis::real dt,
+    const mgis::size_type b,
+    const mgis::size_type e) {
+  mgis::python::ReleaseGIL gil;
+  return mgis::behaviour::integrate(m, opts, dt, b, e);
+}  // end of MaterialDataManager_integrate3
+
+static mgis::behaviour::MultiThreadedBehaviourIntegrationResult
+MaterialDataManager_integrate4(
+    mgis::ThreadPool& p,
+    mgis::behaviour::MaterialDataManager& m,
+    const mgis::behaviour::BehaviourIntegrationOptions& opts,
+    const mgis::real dt) {
+  mgis::python::ReleaseGIL gil;
+  return mgis::behaviour::integrate(p, m, opts, dt);
+}  // end of MaterialDataManager_integrate4
+
 static int BehaviourDataView_executeInitializeFunction(
     mgis::behaviour::BehaviourDataView& v,
     const mgis::behaviour::Behaviour& b,
     const std::string& n) {
+  mgis::python::ReleaseGIL gil;
   return mgis::behaviour::executeInitializeFunction(v, b, n);
 }
 
@@ -43,7 +92,8 @@ static int BehaviourDataView_executeInitializeFunction2(
     const mgis::behaviour::Behaviour& b,
     const std::string& n,
     boost::python::object i) {
-  const auto inputs = mgis::python::mgis_convert_to_span(i);
+  const auto inputs = mgis::python::mgis_convert_to_const_span(i);
+  mgis::python::ReleaseGIL gil;
   return mgis::behaviour::executeInitializeFunction(v, b, n, inputs);
 }
 
@@ -51,6 +101,7 @@ static mgis::behaviour::BehaviourIntegrationResult
 MaterialDataManager_executeInitializeFunction(
     mgis::behaviour::MaterialDataManager& m,
     const std::string& n) {
+  mgis::python::ReleaseGIL gil;
   return mgis::behaviour::executeInitializeFunction(m, n);
 }
 
@@ -60,6 +111,7 @@ MaterialDataManager_executeInitializeFunction1(
     const std::string& n,
     const mgis::size_type b,
     const mgis::size_type e) {
+  mgis::python::ReleaseGIL gil;
   return mgis::behaviour::executeInitializeFunction(m, n, b, e);
 }
 
@@ -68,6 +120,7 @@ MaterialDataManager_executeInitializeFunction2(
     mgis::ThreadPool& t,
     mgis::behaviour::MaterialDataManager& m,
     const std::string& n) {
+  mgis::python::ReleaseGIL gil;
   return mgis::behaviour::executeInitializeFunction(t, m, n);
 }
 
@@ -76,7 +129,8 @@ MaterialDataManager_executeInitializeFunction3(
     mgis::behaviour::MaterialDataManager& m,
     const std::string& n,
     boost::python::object i) {
-  const auto inputs = mgis::python::mgis_convert_to_span(i);
+  const auto inputs = mgis::python::mgis_convert_to_const_span(i);
+  mgis::python::ReleaseGIL gil;
   return mgis::behaviour::executeInitializeFunction(m, n, inputs);
 }
 
@@ -87,7 +141,8 @@ MaterialDataManager_executeInitializeFunction4(
     boost::python::object i,
     const mgis::size_type b,
     const mgis::size_type e) {
-  const auto inputs = mgis::python::mgis_convert_to_span(i);
+  const auto inputs = mgis::python::mgis_convert_to_const_span(i);
+  mgis::python::ReleaseGIL gil;
   return mgis::behaviour::executeInitializeFunction(m, n, inputs, b, e);
 }
 
@@ -97,7 +152,8 @@ MaterialDataManager_executeInitializeFunction5(
     mgis::behaviour::MaterialDataManager& m,
     const std::string& n,
     boost::python::object i) {
-  const auto inputs = mgis::python::mgis_convert_to_span(i);
+  const auto inputs = mgis::python::mgis_convert_to_const_span(i);
+  mgis::python::ReleaseGIL gil;
   return mgis::behaviour::executeInitializeFunction(t, m, n, inputs);
 }
 
@@ -107,6 +163,7 @@ static int BehaviourDataView_executePostProcessing(
     const mgis::behaviour::Behaviour& b,
     const std::string& n) {
   const auto output = mgis::python::mgis_convert_to_span(o);
+  mgis::python::ReleaseGIL gil;
   return mgis::behaviour::executePostProcessing(output, v, b, n);
 }
 
@@ -116,6 +173,7 @@ MaterialDataManager_executePostProcessing(
     mgis::behaviour::MaterialDataManager& m,
     const std::string& n) {
   const auto output = mgis::python::mgis_convert_to_span(o);
+  mgis::python::ReleaseGIL gil;
   return mgis::behaviour::executePostProcessing(output, m, n);
 }
 
@@ -127,6 +185,7 @@ MaterialDataManager_executePostProcessing2(
     const mgis::size_type b,
     const mgis::size_type e) {
   const auto output = mgis::python::mgis_convert_to_span(o);
+  mgis::python::ReleaseGIL gil;
   return mgis::behaviour::executePostProcessing(output, m, n, b, e);
 }
 
@@ -137,6 +196,7 @@ MaterialDataManager_executePostProcessing3(
     mgis::behaviour::MaterialDataManager& m,
     const std::string& n) {
   const auto output = mgis::python::mgis_convert_to_span(o);
+  mgis::python::ReleaseGIL gil;
   return mgis::behaviour::executePostProcessing(output, t, m, n);
 }
 
@@ -182,7 +242,9 @@ void declareIntegrate() {
       .add_property("integration_type",
                     &BehaviourIntegrationOptions::integration_type)
       .add_property("compute_speed_of_sound",
-                    &BehaviourIntegrationOptions::compute_speed_of_sound);
+                    &BehaviourIntegrationOptions::compute_speed_of_sound)
+      .add_property("measure_integration_costs",
+                    &BehaviourIntegrationOptions::measure_integration_costs);
 
   boost::python::class_<BehaviourIntegrationResult>(
       "BehaviourIntegrationResult")
@@ -234,26 +296,12 @@ void declareIntegrate() {
   boost::python::def("executeInitializeFunction",
                      MaterialDataManager_executeInitializeFunction5);
 
-  int (*integrate_ptr1)(BehaviourDataView&, const Behaviour&) = integrate;
-  int (*integrate_ptr2)(MaterialDataManager&, const IntegrationType,
-                        const mgis::real, const mgis::size_type,
-                        const mgis::size_type) = integrate;
-  int (*integrate_ptr3)(mgis::ThreadPool&, MaterialDataManager&,
-                        const IntegrationType, const mgis::real) = integrate;
-  BehaviourIntegrationResult (*integrate_ptr4)(
-      MaterialDataManager&, const BehaviourIntegrationOptions&,
-      const mgis::real, const mgis::size_type, const mgis::size_type) =
-      integrate;
-  MultiThreadedBehaviourIntegrationResult (*integrate_ptr5)(
-      mgis::ThreadPool&, MaterialDataManager&,
-      const BehaviourIntegrationOptions&, const mgis::real) = integrate;
-
   boost::python::def("integrate", &integrateBehaviourData1);
-  boost::python::def("integrate", integrate_ptr1);
-  boost::python::def("integrate", integrate_ptr2);
-  boost::python::def("integrate", integrate_ptr3);
-  boost::python::def("integrate", integrate_ptr4);
-  boost::python::def("integrate", integrate_ptr5);
+  boost::python::def("integrate", &integrateBehaviourDataView);
+  boost::python::def("integrate", &MaterialDataManager_integrate);
+  boost::python::def("integrate", &MaterialDataManager_integrate2);
+  boost::python::def("integrate", &MaterialDataManager_integrate3);
+  boost::python::def("integrate", &MaterialDataManager_integrate4);
 
   boost::python::def("executePostProcessing",
                      BehaviourDataView_executePostProcessing);
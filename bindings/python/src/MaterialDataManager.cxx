@@ -14,7 +14,10 @@
 
 #include <boost/python/def.hpp>
 #include <boost/python/class.hpp>
+#include <boost/python/extract.hpp>
+#include "MGIS/Raise.hxx"
 #include "MGIS/Python/NumPySupport.hxx"
+#include "MGIS/Python/ReleaseGIL.hxx"
 #include "MGIS/Behaviour/Behaviour.hxx"
 #include "MGIS/Behaviour/MaterialDataManager.hxx"
 
@@ -23,48 +26,93 @@ void declareMaterialDataManager();
 static void MaterialDataManagerInitializer_bindTangentOperator(
     mgis::behaviour::MaterialDataManagerInitializer& i,
     boost::python::object K) {
-  i.K = mgis::python::mgis_convert_to_span(K);
+  i.K = mgis::python::mgis_convert_to_external_span(K);
 }  // end of MaterialDataManagerInitializer_bindTangentOperator
 
 static void MaterialDataManagerInitializer_bindSpeedOfSound(
     mgis::behaviour::MaterialDataManagerInitializer& i,
     boost::python::object vs) {
-  i.speed_of_sound = mgis::python::mgis_convert_to_span(vs);
+  i.speed_of_sound = mgis::python::mgis_convert_to_external_span(vs);
 }  // end of MaterialDataManagerInitializer_bindSpeedOfSound
 
 static void MaterialDataManager_useExternalArrayOfTangentOperatorBlocks(
     mgis::behaviour::MaterialDataManager& m, boost::python::object K) {
   m.useExternalArrayOfTangentOperatorBlocks(
-      mgis::python::mgis_convert_to_span(K));
+      mgis::python::mgis_convert_to_external_span(K));
 }  // end of MaterialDataManager_useExternalArrayOfTangentOperatorBlocks
 
 static void MaterialDataManager_useExternalArrayOfSpeedOfSounds(
     mgis::behaviour::MaterialDataManager& m, boost::python::object vs) {
-  m.useExternalArrayOfSpeedOfSounds(mgis::python::mgis_convert_to_span(vs));
+  m.useExternalArrayOfSpeedOfSounds(
+      mgis::python::mgis_convert_to_external_span(vs));
 }  // end of MaterialDataManager_useExternalArrayOfSpeedOfSounds
 
+static void MaterialDataManager_update(
+    mgis::behaviour::MaterialDataManager& m) {
+  mgis::python::ReleaseGIL gil;
+  mgis::behaviour::update(m);
+}  // end of MaterialDataManager_update
+
+static void MaterialDataManager_revert(
+    mgis::behaviour::MaterialDataManager& m) {
+  mgis::python::ReleaseGIL gil;
+  mgis::behaviour::revert(m);
+}  // end of MaterialDataManager_revert
+
 static boost::python::object MaterialDataManager_getK(
-    mgis::behaviour::MaterialDataManager& d) {
+    boost::python::object o) {
+  auto& d = boost::python::extract<mgis::behaviour::MaterialDataManager&>(o)();
+  if (requiresConversion(d.K_storage)) {
+    mgis::raise(
+        "MaterialDataManager::K: the tangent operator blocks are not stored "
+        "densely, use the getTangentOperatorBlocks method");
+  }
   if (d.b.to_blocks.size() == 1u) {
     const auto nl =
         getVariableSize(d.b.to_blocks.front().second, d.b.hypothesis);
     const auto nc =
         getVariableSize(d.b.to_blocks.front().first, d.b.hypothesis);
-    return mgis::python::wrapInNumPyArray(d.K, nc, nl);
+    return mgis::python::setNumPyArrayOwner(
+        mgis::python::wrapInNumPyArray(d.K, nc, nl), o);
   }
   const auto s = getTangentOperatorArraySize(d.b);
-  return mgis::python::wrapInNumPyArray(d.K, s);
+  return mgis::python::setNumPyArrayOwner(
+      mgis::python::wrapInNumPyArray(d.K, s), o);
 }  // end of MaterialDataManager_getK
 
+static void MaterialDataManager_getTangentOperatorBlocks(
+    const mgis::behaviour::MaterialDataManager& m, boost::python::object K) {
+  mgis::behaviour::getTangentOperatorBlocks(
+      mgis::python::mgis_convert_to_span(K), m);
+}  // end of MaterialDataManager_getTangentOperatorBlocks
+
+static boost::python::object MaterialDataManager_getSpeedOfSound(
+    boost::python::object o) {
+  auto& d = boost::python::extract<mgis::behaviour::MaterialDataManager&>(o)();
+  return mgis::python::setNumPyArrayOwner(
+      mgis::python::wrapInNumPyArray(d.speed_of_sound), o);
+}  // end of MaterialDataManager_getSpeedOfSound
+
+static boost::python::object MaterialDataManager_getIntegrationCosts(
+    boost::python::object o) {
+  auto& d = boost::python::extract<mgis::behaviour::MaterialDataManager&>(o)();
+  return mgis::python::setNumPyArrayOwner(
+      mgis::python::wrapInNumPyArray(d.integration_costs), o);
+}  // end of MaterialDataManager_getIntegrationCosts
+
 void declareMaterialDataManager() {
   using mgis::size_type;
   using mgis::behaviour::Behaviour;
   using mgis::behaviour::MaterialDataManager;
   using mgis::behaviour::MaterialDataManagerInitializer;
-  // pointers to free functions to disambiguate the function resolution
-  void (*ptr_update)(MaterialDataManager&) = &mgis::behaviour::update;
-  void (*ptr_revert)(MaterialDataManager&) = &mgis::behaviour::revert;
-  // exporting the MaterialDataManager class
+  using mgis::behaviour::TangentOperatorStorage;
+  // exporting the TangentOperatorStorage class
+  boost::python::class_<TangentOperatorStorage>("TangentOperatorStorage")
+      .def_readwrite("packed_symmetric",
+                     &TangentOperatorStorage::packed_symmetric)
+      .def_readwrite("single_precision",
+                     &TangentOperatorStorage::single_precision);
+  // exporting the MaterialDataManagerInitializer class
   boost::python::class_<MaterialDataManagerInitializer>(
       "MaterialDataManagerInitializer")
       .add_property("s0", &MaterialDataManagerInitializer::s0)
@@ -73,7 +121,9 @@ void declareMaterialDataManager() {
            &MaterialDataManagerInitializer_bindTangentOperator,
            "use the given array to store the tangent operator blocks")
       .def("bindSpeedOfSound", &MaterialDataManagerInitializer_bindSpeedOfSound,
-           "use the given array to store the speed of sounds");
+           "use the given array to store the speed of sounds")
+      .def_readwrite("tangent_operator_storage",
+                     &MaterialDataManagerInitializer::tangent_operator_storage);
   // exporting the MaterialDataManager class
   boost::python::class_<MaterialDataManager, boost::noncopyable>(
       "MaterialDataManager",
@@ -102,15 +152,28 @@ void declareMaterialDataManager() {
       .def("releaseArrayOfSpeedOfSounds",
            &MaterialDataManager::releaseArrayOfSpeedOfSounds,
            "release the array of speed of sounds")
+      .def("allocateArrayOfIntegrationCosts",
+           &MaterialDataManager::allocateArrayOfIntegrationCosts,
+           "allocate the array of integration costs")
+      .def("releaseArrayOfIntegrationCosts",
+           &MaterialDataManager::releaseArrayOfIntegrationCosts,
+           "release the array of integration costs")
       .def_readonly("n", &MaterialDataManager::n)
       .def_readonly("number_of_integration_points", &MaterialDataManager::n)
       .add_property("s0", &MaterialDataManager::s0)
       .add_property("s1", &MaterialDataManager::s1)
       .add_property("K", &MaterialDataManager_getK)
-      .def("update", ptr_update)
-      .def("revert", ptr_revert);
+      .def("getTangentOperatorBlocks",
+           &MaterialDataManager_getTangentOperatorBlocks,
+           "copy the dense tangent operator blocks of all integration points "
+           "in the given array, whatever their storage")
+      .add_property("speed_of_sound", &MaterialDataManager_getSpeedOfSound)
+      .add_property("integration_costs",
+                    &MaterialDataManager_getIntegrationCosts)
+      .def("update", &MaterialDataManager_update)
+      .def("revert", &MaterialDataManager_revert);
   // free functions
-  boost::python::def("update", ptr_update);
-  boost::python::def("revert", ptr_revert);
+  boost::python::def("update", &MaterialDataManager_update);
+  boost::python::def("revert", &MaterialDataManager_revert);
 
 }  // end of declareMaterialDataManager
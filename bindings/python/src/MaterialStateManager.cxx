@@ -15,78 +15,284 @@
 #include <boost/python/def.hpp>
 #include <boost/python/enum.hpp>
 #include <boost/python/class.hpp>
+#include <boost/python/extract.hpp>
 #include "MGIS/Raise.hxx"
+#include "MGIS/ThreadPool.hxx"
 #include "MGIS/Python/NumPySupport.hxx"
+#include "MGIS/Python/ReleaseGIL.hxx"
 #include "MGIS/Behaviour/Behaviour.hxx"
 #include "MGIS/Behaviour/MaterialStateManager.hxx"
 
 static void MaterialStateManagerInitializer_bindGradients(
     mgis::behaviour::MaterialStateManagerInitializer& i,
     boost::python::object K) {
-  i.gradients = mgis::python::mgis_convert_to_span(K);
+  i.gradients = mgis::python::mgis_convert_to_external_span(K);
 }  // end of MaterialStateManagerInitializer_bindGradients
 
 static void MaterialStateManagerInitializer_bindThermodynamicForces(
     mgis::behaviour::MaterialStateManagerInitializer& i,
     boost::python::object K) {
-  i.thermodynamic_forces = mgis::python::mgis_convert_to_span(K);
+  i.thermodynamic_forces = mgis::python::mgis_convert_to_external_span(K);
 }  // end of MaterialStateManagerInitializer_bindThermodynamicForces
 
 static void MaterialStateManagerInitializer_bindInternalStateVariables(
     mgis::behaviour::MaterialStateManagerInitializer& i,
     boost::python::object K) {
-  i.internal_state_variables = mgis::python::mgis_convert_to_span(K);
+  i.internal_state_variables = mgis::python::mgis_convert_to_external_span(K);
 }  // end of MaterialStateManagerInitializer_bindInternalStateVariables
 
 static void MaterialStateManagerInitializer_bindStoredEnergies(
     mgis::behaviour::MaterialStateManagerInitializer& i,
     boost::python::object K) {
-  i.stored_energies = mgis::python::mgis_convert_to_span(K);
+  i.stored_energies = mgis::python::mgis_convert_to_external_span(K);
 }  // end of MaterialStateManagerInitializer_bindStoredEnergies
 
 static void MaterialStateManagerInitializer_bindDissipatedEnergies(
     mgis::behaviour::MaterialStateManagerInitializer& i,
     boost::python::object K) {
-  i.dissipated_energies = mgis::python::mgis_convert_to_span(K);
+  i.dissipated_energies = mgis::python::mgis_convert_to_external_span(K);
 }  // end of MaterialStateManagerInitializer_bindDissipatedEnergies
 
+static mgis::behaviour::MaterialStateManager& getMaterialStateManager(
+    boost::python::object o) {
+  return boost::python::extract<mgis::behaviour::MaterialStateManager&>(o)();
+}  // end of getMaterialStateManager
+
 static boost::python::object MaterialStateManager_getGradients(
-    mgis::behaviour::MaterialStateManager& s) {
-  return mgis::python::wrapInNumPyArray(s.gradients, s.gradients_stride);
+    boost::python::object o) {
+  auto& s = getMaterialStateManager(o);
+  return mgis::python::setNumPyArrayOwner(
+      mgis::python::wrapInNumPyArray(s.gradients, s.gradients_stride), o);
 }  // end of MaterialStateManager_getGradients
 
 static boost::python::object MaterialStateManager_getThermodynamicForces(
-    mgis::behaviour::MaterialStateManager& s) {
-  return mgis::python::wrapInNumPyArray(s.thermodynamic_forces,
-                                        s.thermodynamic_forces_stride);
+    boost::python::object o) {
+  auto& s = getMaterialStateManager(o);
+  return mgis::python::setNumPyArrayOwner(
+      mgis::python::wrapInNumPyArray(s.thermodynamic_forces,
+                                     s.thermodynamic_forces_stride),
+      o);
 }  // end of MaterialStateManager_getThermodynamicForces
 
 static boost::python::object MaterialStateManager_getInternalStateVariables(
-    mgis::behaviour::MaterialStateManager& s) {
-  return mgis::python::wrapInNumPyArray(s.internal_state_variables,
-                                        s.internal_state_variables_stride);
+    boost::python::object o) {
+  auto& s = getMaterialStateManager(o);
+  return mgis::python::setNumPyArrayOwner(
+      mgis::python::wrapInNumPyArray(s.internal_state_variables,
+                                     s.internal_state_variables_stride),
+      o);
 }  // end of MaterialStateManager_getInternalStateVariables
 
 static boost::python::object MaterialStateManager_getStoredEnergies(
-    mgis::behaviour::MaterialStateManager& s) {
+    boost::python::object o) {
+  auto& s = getMaterialStateManager(o);
   if (!s.b.computesStoredEnergy) {
     mgis::raise(
         "MaterialStateManager_getStoredEnergies: "
         "the stored energy is not computed by the behaviour");
   }
-  return mgis::python::wrapInNumPyArray(s.stored_energies);
+  return mgis::python::setNumPyArrayOwner(
+      mgis::python::wrapInNumPyArray(s.stored_energies), o);
 }  // end of MaterialStateManager_getStoredEnergy
 
 static boost::python::object MaterialStateManager_getDissipatedEnergies(
-    mgis::behaviour::MaterialStateManager& s) {
+    boost::python::object o) {
+  auto& s = getMaterialStateManager(o);
   if (!s.b.computesDissipatedEnergy) {
     mgis::raise(
         "MaterialStateManager_getDissipatedEnergies: "
         "the dissipated energy is not computed by the behaviour");
   }
-  return mgis::python::wrapInNumPyArray(s.dissipated_energies);
+  return mgis::python::setNumPyArrayOwner(
+      mgis::python::wrapInNumPyArray(s.dissipated_energies), o);
 }  // end of MaterialStateManager_getDissipatedEnergy
 
+static boost::python::object MaterialStateManager_getVariableView(
+    boost::python::object o,
+    mgis::span<mgis::real>& values,
+    const mgis::size_type stride,
+    const std::vector<mgis::behaviour::Variable>& variables,
+    const std::string& n) {
+  const auto& s = getMaterialStateManager(o);
+  const auto& v = mgis::behaviour::getVariable(variables, n);
+  const auto nc = mgis::behaviour::getVariableSize(v, s.b.hypothesis);
+  const auto offset =
+      mgis::behaviour::getVariableOffset(variables, n, s.b.hypothesis);
+  return mgis::python::setNumPyArrayOwner(
+      mgis::python::wrapInStridedNumPyArray(values.data() + offset, s.n, nc,
+                                            stride),
+      o);
+}  // end of MaterialStateManager_getVariableView
+
+static boost::python::object MaterialStateManager_getGradient(
+    boost::python::object o, const std::string& n) {
+  auto& s = getMaterialStateManager(o);
+  return MaterialStateManager_getVariableView(
+      o, s.gradients, s.gradients_stride, s.b.gradients, n);
+}  // end of MaterialStateManager_getGradient
+
+static boost::python::object MaterialStateManager_getThermodynamicForce(
+    boost::python::object o, const std::string& n) {
+  auto& s = getMaterialStateManager(o);
+  return MaterialStateManager_getVariableView(
+      o, s.thermodynamic_forces, s.thermodynamic_forces_stride,
+      s.b.thermodynamic_forces, n);
+}  // end of MaterialStateManager_getThermodynamicForce
+
+static boost::python::object MaterialStateManager_getInternalStateVariable(
+    boost::python::object o, const std::string& n) {
+  auto& s = getMaterialStateManager(o);
+  return MaterialStateManager_getVariableView(
+      o, s.internal_state_variables, s.internal_state_variables_stride,
+      s.b.isvs, n);
+}  // end of MaterialStateManager_getInternalStateVariable
+
+//! \brief type of the functions extracting the values of a variable
+using ExtractFunction =
+    void (*)(mgis::span<mgis::real>,
+             const mgis::behaviour::MaterialStateManager&,
+             const mgis::string_view,
+             const mgis::span<const mgis::size_type>);
+//! \brief type of the functions extracting the values of a variable
+using ParallelExtractFunction =
+    void (*)(mgis::ThreadPool&,
+             mgis::span<mgis::real>,
+             const mgis::behaviour::MaterialStateManager&,
+             const mgis::string_view,
+             const mgis::span<const mgis::size_type>);
+//! \brief type of the functions setting the values of a variable
+using SetFunction = void (*)(mgis::behaviour::MaterialStateManager&,
+                             const mgis::string_view,
+                             const mgis::span<const mgis::real>,
+                             const mgis::span<const mgis::size_type>);
+//! \brief type of the functions setting the values of a variable
+using ParallelSetFunction =
+    void (*)(mgis::ThreadPool&,
+             mgis::behaviour::MaterialStateManager&,
+             const mgis::string_view,
+             const mgis::span<const mgis::real>,
+             const mgis::span<const mgis::size_type>);
+
+template <ExtractFunction f>
+static void MaterialStateManager_extract(
+    boost::python::object o,
+    const mgis::behaviour::MaterialStateManager& s,
+    const std::string& n) {
+  const auto values = mgis::python::mgis_convert_to_span(o);
+  mgis::python::ReleaseGIL gil;
+  f(values, s, n, {});
+}  // end of MaterialStateManager_extract
+
+template <ExtractFunction f>
+static void MaterialStateManager_extract2(
+    boost::python::object o,
+    const mgis::behaviour::MaterialStateManager& s,
+    const std::string& n,
+    boost::python::object ordering) {
+  const auto values = mgis::python::mgis_convert_to_span(o);
+  const auto indices = mgis::python::mgis_convert_to_size_type_span(ordering);
+  mgis::python::ReleaseGIL gil;
+  f(values, s, n, indices);
+}  // end of MaterialStateManager_extract2
+
+template <ParallelExtractFunction f>
+static void MaterialStateManager_extract3(
+    mgis::ThreadPool& p,
+    boost::python::object o,
+    const mgis::behaviour::MaterialStateManager& s,
+    const std::string& n) {
+  const auto values = mgis::python::mgis_convert_to_span(o);
+  mgis::python::ReleaseGIL gil;
+  f(p, values, s, n, {});
+}  // end of MaterialStateManager_extract3
+
+template <ParallelExtractFunction f>
+static void MaterialStateManager_extract4(
+    mgis::ThreadPool& p,
+    boost::python::object o,
+    const mgis::behaviour::MaterialStateManager& s,
+    const std::string& n,
+    boost::python::object ordering) {
+  const auto values = mgis::python::mgis_convert_to_span(o);
+  const auto indices = mgis::python::mgis_convert_to_size_type_span(ordering);
+  mgis::python::ReleaseGIL gil;
+  f(p, values, s, n, indices);
+}  // end of MaterialStateManager_extract4
+
+template <SetFunction f>
+static void MaterialStateManager_set(mgis::behaviour::MaterialStateManager& s,
+                                     const std::string& n,
+                                     boost::python::object v) {
+  const auto values = mgis::python::mgis_convert_to_const_span(v);
+  mgis::python::ReleaseGIL gil;
+  f(s, n, values, {});
+}  // end of MaterialStateManager_set
+
+template <SetFunction f>
+static void MaterialStateManager_set2(mgis::behaviour::MaterialStateManager& s,
+                                      const std::string& n,
+                                      boost::python::object v,
+                                      boost::python::object ordering) {
+  const auto values = mgis::python::mgis_convert_to_const_span(v);
+  const auto indices = mgis::python::mgis_convert_to_size_type_span(ordering);
+  mgis::python::ReleaseGIL gil;
+  f(s, n, values, indices);
+}  // end of MaterialStateManager_set2
+
+template <ParallelSetFunction f>
+static void MaterialStateManager_set3(mgis::ThreadPool& p,
+                                      mgis::behaviour::MaterialStateManager& s,
+                                      const std::string& n,
+                                      boost::python::object v) {
+  const auto values = mgis::python::mgis_convert_to_const_span(v);
+  mgis::python::ReleaseGIL gil;
+  f(p, s, n, values, {});
+}  // end of MaterialStateManager_set3
+
+template <ParallelSetFunction f>
+static void MaterialStateManager_set4(mgis::ThreadPool& p,
+                                      mgis::behaviour::MaterialStateManager& s,
+                                      const std::string& n,
+                                      boost::python::object v,
+                                      boost::python::object ordering) {
+  const auto values = mgis::python::mgis_convert_to_const_span(v);
+  const auto indices = mgis::python::mgis_convert_to_size_type_span(ordering);
+  mgis::python::ReleaseGIL gil;
+  f(p, s, n, values, indices);
+}  // end of MaterialStateManager_set4
+
+/*!
+ * \brief declare the python functions extracting the values of a variable
+ * \param[in] n: name of the python functions
+ */
+template <ExtractFunction f, ParallelExtractFunction f2>
+static void declareExtractFunctions(const char* const n) {
+  const auto* const d =
+      "extract the values of a variable in the given array. An optional "
+      "array of indices can be used to specify the ordering of the "
+      "integration points";
+  boost::python::def(n, &MaterialStateManager_extract<f>, d);
+  boost::python::def(n, &MaterialStateManager_extract2<f>, d);
+  boost::python::def(n, &MaterialStateManager_extract3<f2>, d);
+  boost::python::def(n, &MaterialStateManager_extract4<f2>, d);
+}  // end of declareExtractFunctions
+
+/*!
+ * \brief declare the python functions setting the values of a variable
+ * \param[in] n: name of the python functions
+ */
+template <SetFunction f, ParallelSetFunction f2>
+static void declareSetFunctions(const char* const n) {
+  const auto* const d =
+      "set the values of a variable from the given array. An optional "
+      "array of indices can be used to specify the ordering of the "
+      "integration points";
+  boost::python::def(n, &MaterialStateManager_set<f>, d);
+  boost::python::def(n, &MaterialStateManager_set2<f>, d);
+  boost::python::def(n, &MaterialStateManager_set3<f2>, d);
+  boost::python::def(n, &MaterialStateManager_set4<f2>, d);
+}  // end of declareSetFunctions
+
 static void MaterialStateManager_setMaterialProperty(
     mgis::behaviour::MaterialStateManager& s,
     const std::string& n,
@@ -99,7 +305,12 @@ static void MaterialStateManager_setMaterialProperty2(
     const std::string& n,
     const boost::python::object& o,
     const mgis::behaviour::MaterialStateManager::StorageMode s) {
-  setMaterialProperty(sm, n, mgis::python::mgis_convert_to_span(o), s);
+  if (s == mgis::behaviour::MaterialStateManager::EXTERNAL_STORAGE) {
+    setMaterialProperty(sm, n, mgis::python::mgis_convert_to_external_span(o),
+                        s);
+  } else {
+    setMaterialProperty(sm, n, mgis::python::mgis_convert_to_span(o), s);
+  }
 }  // end of MaterialStateManager_setMaterialProperty
 
 static void MaterialStateManager_setExternalStateVariable(
@@ -114,9 +325,63 @@ static void MaterialStateManager_setExternalStateVariable2(
     const std::string& n,
     const boost::python::object& o,
     const mgis::behaviour::MaterialStateManager::StorageMode s) {
-  setExternalStateVariable(sm, n, mgis::python::mgis_convert_to_span(o), s);
+  if (s == mgis::behaviour::MaterialStateManager::EXTERNAL_STORAGE) {
+    setExternalStateVariable(
+        sm, n, mgis::python::mgis_convert_to_external_span(o), s);
+  } else {
+    setExternalStateVariable(sm, n, mgis::python::mgis_convert_to_span(o), s);
+  }
 }  // end of MaterialStateManager_setExternalStateVariable
 
+static boost::python::object MaterialStateManager_getFieldView(
+    boost::python::object o,
+    mgis::behaviour::MaterialStateManager::FieldHolder& f,
+    const mgis::size_type nc) {
+  if (std::holds_alternative<mgis::real>(f)) {
+    return boost::python::object(std::get<mgis::real>(f));
+  }
+  if (std::holds_alternative<mgis::span<mgis::real>>(f)) {
+    auto& v = std::get<mgis::span<mgis::real>>(f);
+    return mgis::python::setNumPyArrayOwner(
+        nc == 1 ? mgis::python::wrapInNumPyArray(v)
+                : mgis::python::wrapInNumPyArray(v, nc),
+        o);
+  }
+  auto& v = std::get<std::vector<mgis::real>>(f);
+  return mgis::python::setNumPyArrayOwner(
+      nc == 1 ? mgis::python::wrapInNumPyArray(v)
+              : mgis::python::wrapInNumPyArray(v, nc),
+      o);
+}  // end of MaterialStateManager_getFieldView
+
+static boost::python::object MaterialStateManager_getMaterialProperty(
+    boost::python::object o, const std::string& n) {
+  auto& s = getMaterialStateManager(o);
+  const auto p = s.material_properties.find(n);
+  if (p == s.material_properties.end()) {
+    mgis::raise(
+        "MaterialStateManager_getMaterialProperty: "
+        "material property '" +
+        n + "' is not defined");
+  }
+  return MaterialStateManager_getFieldView(o, p->second, 1);
+}  // end of MaterialStateManager_getMaterialProperty
+
+static boost::python::object MaterialStateManager_getExternalStateVariable(
+    boost::python::object o, const std::string& n) {
+  auto& s = getMaterialStateManager(o);
+  const auto p = s.external_state_variables.find(n);
+  if (p == s.external_state_variables.end()) {
+    mgis::raise(
+        "MaterialStateManager_getExternalStateVariable: "
+        "external state variable '" +
+        n + "' is not defined");
+  }
+  const auto& v = mgis::behaviour::getVariable(s.b.esvs, n);
+  return MaterialStateManager_getFieldView(
+      o, p->second, mgis::behaviour::getVariableSize(v, s.b.hypothesis));
+}  // end of MaterialStateManager_getExternalStateVariable
+
 void declareMaterialStateManager();
 
 void declareMaterialStateManager() {
@@ -172,6 +437,20 @@ void declareMaterialStateManager() {
                     &MaterialStateManager_getDissipatedEnergies)
       .add_property("internal_state_variables",
                     &MaterialStateManager_getInternalStateVariables)
+      .def("getGradient", &MaterialStateManager_getGradient,
+           "return a view of the values of the given gradient")
+      .def("getThermodynamicForce", &MaterialStateManager_getThermodynamicForce,
+           "return a view of the values of the given thermodynamic force")
+      .def("getInternalStateVariable",
+           &MaterialStateManager_getInternalStateVariable,
+           "return a view of the values of the given internal state variable")
+      .def("getMaterialProperty", &MaterialStateManager_getMaterialProperty,
+           "return the value of the given material property if uniform, "
+           "or a view of its values otherwise")
+      .def("getExternalStateVariable",
+           &MaterialStateManager_getExternalStateVariable,
+           "return the value of the given external state variable if "
+           "uniform, or a view of its values otherwise")
       .def("setMaterialProperty", &MaterialStateManager_setMaterialProperty)
       .def("setMaterialProperty", &MaterialStateManager_setMaterialProperty2)
       .def("setExternalStateVariable",
@@ -187,5 +466,21 @@ void declareMaterialStateManager() {
                      &MaterialStateManager_setExternalStateVariable);
   boost::python::def("setExternalStateVariable",
                      &MaterialStateManager_setExternalStateVariable2);
+  declareExtractFunctions<mgis::behaviour::extractGradient,
+                          mgis::behaviour::extractGradient>("extractGradient");
+  declareExtractFunctions<mgis::behaviour::extractThermodynamicForce,
+                          mgis::behaviour::extractThermodynamicForce>(
+      "extractThermodynamicForce");
+  declareExtractFunctions<mgis::behaviour::extractInternalStateVariable,
+                          mgis::behaviour::extractInternalStateVariable>(
+      "extractInternalStateVariable");
+  declareSetFunctions<mgis::behaviour::setGradient,
+                      mgis::behaviour::setGradient>("setGradient");
+  declareSetFunctions<mgis::behaviour::setThermodynamicForce,
+                      mgis::behaviour::setThermodynamicForce>(
+      "setThermodynamicForce");
+  declareSetFunctions<mgis::behaviour::setInternalStateVariable,
+                      mgis::behaviour::setInternalStateVariable>(
+      "setInternalStateVariable");
 
 }  // end of declareMaterialStateManager
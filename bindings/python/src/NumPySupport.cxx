@@ -12,6 +12,8 @@
  *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
  */
 
+#include <string>
+#include <string_view>
 #include <numpy/ndarrayobject.h>
 #include "MGIS/Raise.hxx"
 #include "MGIS/Python/NumPySupport.hxx"
@@ -100,28 +102,161 @@ namespace mgis::python {
     return wrapInNumPyArray(std::get<mgis::span<double>>(v), nl, nc);
   }  // end of wrapInNumPyArray
 
-  mgis::span<mgis::real> mgis_convert_to_span(const boost::python::object& o) {
-    if (!PyArray_Check(o.ptr())) {
+  boost::python::object wrapInStridedNumPyArray(double* const v,
+                                                const size_type n,
+                                                const size_type nc,
+                                                const size_type stride) {
+    const auto nd = (nc == 1) ? 1 : 2;
+    npy_intp dims[2] = {static_cast<npy_intp>(n), static_cast<npy_intp>(nc)};
+    npy_intp strides[2] = {static_cast<npy_intp>(stride * sizeof(double)),
+                           static_cast<npy_intp>(sizeof(double))};
+    auto* const arr =
+        PyArray_New(&PyArray_Type, nd, dims, NPY_DOUBLE, strides, v, 0,
+                    NPY_ARRAY_ALIGNED | NPY_ARRAY_WRITEABLE, nullptr);
+    boost::python::handle<> handle(arr);
+    return boost::python::object(handle);
+  }  // end of wrapInStridedNumPyArray
+
+  boost::python::object setNumPyArrayOwner(boost::python::object a,
+                                           const boost::python::object& o) {
+    if (!PyArray_Check(a.ptr())) {
+      mgis::raise("setNumPyArrayOwner: invalid argument");
+    }
+    if (o.ptr() == Py_None) {
+      return a;
+    }
+    // PyArray_SetBaseObject steals a reference to the owner
+    Py_INCREF(o.ptr());
+    if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(a.ptr()),
+                              o.ptr()) != 0) {
+      boost::python::throw_error_already_set();
+    }
+    return a;
+  }  // end of setNumPyArrayOwner
+
+  /*!
+   * \return a view of the buffer exposed by a python object
+   * \param[in] o: python object
+   * \param[in] writable: if true, the buffer must be writable
+   */
+  template <typename ValueType>
+  static ArrayView<ValueType> convertBufferToArrayView(
+      const boost::python::object& o, const bool writable) {
+    auto buffer = Py_buffer{};
+    const auto flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT |
+                       (writable ? PyBUF_WRITABLE : 0);
+    if (PyObject_GetBuffer(o.ptr(), &buffer, flags) != 0) {
+      PyErr_Clear();
       const auto type = std::string(o.ptr()->ob_type->tp_name);
+      if (writable) {
+        mgis::raise("convert_to_span: argument of type ('" + type +
+                    "') does not expose a writable C-contiguous buffer");
+      }
       mgis::raise("convert_to_span: argument of type ('" + type +
-                  "') is not convertible to PyArrayObject");
+                  "') does not expose a C-contiguous buffer");
     }
-    auto* const a = reinterpret_cast<PyArrayObject*>(o.ptr());
-    if (a->descr->type_num != NPY_DOUBLE) {
+    // only the native byte order is accepted
+#if PY_LITTLE_ENDIAN
+    constexpr auto native_format = std::string_view{"<d"};
+#else
+    constexpr auto native_format = std::string_view{">d"};
+#endif
+    const auto* const f = buffer.format;
+    const auto is_double = (f == nullptr) || (std::string_view{f} == "d") ||
+                           (std::string_view{f} == "@d") ||
+                           (std::string_view{f} == "=d") ||
+                           (std::string_view{f} == native_format);
+    if ((!is_double) || (buffer.itemsize != sizeof(mgis::real))) {
+      PyBuffer_Release(&buffer);
+      mgis::raise(
+          "convert_to_span: buffer does not hold double values "
+          "in the native byte order");
+    }
+    auto* const values = static_cast<ValueType*>(buffer.buf);
+    const auto n = buffer.len / buffer.itemsize;
+    // the buffer is released by the view
+    return ArrayView<ValueType>(
+        {values, static_cast<typename mgis::span<ValueType>::index_type>(n)},
+        buffer);
+  }  // end of convertBufferToArrayView
+
+  /*!
+   * \return a view of the memory of a ndarray
+   * \param[in] a: ndarray
+   * \param[in] writable: if true, the memory must be writable
+   */
+  static mgis::span<mgis::real> convertNumPyArrayToSpan(
+      PyArrayObject* const a, const bool writable) {
+    if ((PyArray_TYPE(a) != NPY_DOUBLE) || (!PyArray_ISNOTSWAPPED(a))) {
       mgis::raise("convert_to_span: invalid numpy object");
     }
-    if (a == nullptr) {
-      mgis::raise("convert_to_span: argument not convertible to PyArrayObject");
+    if (!PyArray_IS_C_CONTIGUOUS(a)) {
+      mgis::raise(
+          "convert_to_span: the array is not C-contiguous. "
+          "Consider using numpy.ascontiguousarray");
     }
-    // number of dimensions
-    const auto nd = PyArray_NDIM(a);
-    if (nd != 1) {
-      mgis::raise("convert_to_span: expected one dimensional array");
+    if ((writable) && (!PyArray_ISWRITEABLE(a))) {
+      mgis::raise("convert_to_span: the array is not writeable");
     }
-    auto* const shape = PyArray_DIMS(a);
-    const auto n = shape[0];
-    auto* const values = static_cast<double*>(PyArray_GETPTR1(a, 0));
+    // multi-dimensional arrays are seen as flat arrays
+    const auto n = PyArray_SIZE(a);
+    auto* const values = static_cast<double*>(PyArray_DATA(a));
     return {values, static_cast<mgis::span<mgis::real>::index_type>(n)};
+  }  // end of convertNumPyArrayToSpan
+
+  ArrayView<mgis::real> mgis_convert_to_span(const boost::python::object& o) {
+    if (!PyArray_Check(o.ptr())) {
+      return convertBufferToArrayView<mgis::real>(o, true);
+    }
+    auto* const a = reinterpret_cast<PyArrayObject*>(o.ptr());
+    return ArrayView<mgis::real>(convertNumPyArrayToSpan(a, true));
   }  // end of mgis_convert_to_span
 
+  ArrayView<const mgis::real> mgis_convert_to_const_span(
+      const boost::python::object& o) {
+    if (!PyArray_Check(o.ptr())) {
+      return convertBufferToArrayView<const mgis::real>(o, false);
+    }
+    auto* const a = reinterpret_cast<PyArrayObject*>(o.ptr());
+    return ArrayView<const mgis::real>(convertNumPyArrayToSpan(a, false));
+  }  // end of mgis_convert_to_const_span
+
+  mgis::span<mgis::real> mgis_convert_to_external_span(
+      const boost::python::object& o) {
+    if (!PyArray_Check(o.ptr())) {
+      const auto type = std::string(o.ptr()->ob_type->tp_name);
+      mgis::raise("convert_to_external_span: argument of type ('" + type +
+                  "') is not a numpy array. Only numpy arrays can be used "
+                  "as an external storage");
+    }
+    auto* const a = reinterpret_cast<PyArrayObject*>(o.ptr());
+    return convertNumPyArrayToSpan(a, true);
+  }  // end of mgis_convert_to_external_span
+
+  mgis::span<const mgis::size_type> mgis_convert_to_size_type_span(
+      const boost::python::object& o) {
+    if (!PyArray_Check(o.ptr())) {
+      const auto type = std::string(o.ptr()->ob_type->tp_name);
+      mgis::raise("convert_to_size_type_span: argument of type ('" + type +
+                  "') is not convertible to PyArrayObject");
+    }
+    auto* const a = reinterpret_cast<PyArrayObject*>(o.ptr());
+    if ((!PyArray_ISINTEGER(a)) ||
+        (PyArray_ITEMSIZE(a) != sizeof(mgis::size_type))) {
+      mgis::raise(
+          "convert_to_size_type_span: "
+          "invalid numpy object (expected an array of 64 bits integers)");
+    }
+    if ((PyArray_NDIM(a) != 1) || (!PyArray_IS_C_CONTIGUOUS(a))) {
+      mgis::raise(
+          "convert_to_size_type_span: "
+          "expected an one dimensional C-contiguous array");
+    }
+    const auto n = PyArray_SIZE(a);
+    const auto* const values =
+        static_cast<const mgis::size_type*>(PyArray_DATA(a));
+    return {values,
+            static_cast<mgis::span<const mgis::size_type>::index_type>(n)};
+  }  // end of mgis_convert_to_size_type_span
+
 }  // end of namespace mgis::python
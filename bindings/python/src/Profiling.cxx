@@ -0,0 +1,105 @@
+/*!
+ * \file   bindings/python/src/Profiling.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <sstream>
+#include <fstream>
+#include <boost/python/def.hpp>
+#include <boost/python/args.hpp>
+#include <boost/python/class.hpp>
+#include "MGIS/Raise.hxx"
+#include "MGIS/Profiling.hxx"
+
+static mgis::profiling::RegionStatistics ProfilingReport_getTotal(
+    const mgis::profiling::ProfilingReport& r, const std::string& n) {
+  return r.getTotal(mgis::profiling::getRegion(n));
+}  // end of ProfilingReport_getTotal
+
+static mgis::profiling::RegionStatistics ProfilingReport_getThreadStatistics(
+    const mgis::profiling::ProfilingReport& r,
+    const mgis::size_type t,
+    const std::string& n) {
+  if (t >= r.threads.size()) {
+    mgis::raise("ProfilingReport::getThreadStatistics: invalid thread index");
+  }
+  const auto region = mgis::profiling::getRegion(n);
+  return r.threads[t].regions[static_cast<mgis::size_type>(region)];
+}  // end of ProfilingReport_getThreadStatistics
+
+static mgis::real ProfilingReport_getLoadImbalance(
+    const mgis::profiling::ProfilingReport& r, const std::string& n) {
+  return r.getLoadImbalance(mgis::profiling::getRegion(n));
+}  // end of ProfilingReport_getLoadImbalance
+
+static mgis::size_type ProfilingReport_getNumberOfThreads(
+    const mgis::profiling::ProfilingReport& r) {
+  return r.threads.size();
+}  // end of ProfilingReport_getNumberOfThreads
+
+static std::string ProfilingReport_toJSON(
+    const mgis::profiling::ProfilingReport& r) {
+  std::ostringstream os;
+  mgis::profiling::print_json(os, r);
+  return os.str();
+}  // end of ProfilingReport_toJSON
+
+static void ProfilingReport_writeJSON(const mgis::profiling::ProfilingReport& r,
+                                      const std::string& f) {
+  std::ofstream out(f);
+  if (!out) {
+    mgis::raise("ProfilingReport::writeJSON: can't open file '" + f + "'");
+  }
+  mgis::profiling::print_json(out, r);
+}  // end of ProfilingReport_writeJSON
+
+void declareProfiling() {
+  using namespace mgis::profiling;
+  boost::python::class_<RegionStatistics>("RegionStatistics")
+      .def_readonly("calls", &RegionStatistics::calls, "number of calls")
+      .def_readonly("points", &RegionStatistics::points,
+                    "number of integration points treated")
+      .def_readonly("failures", &RegionStatistics::failures,
+                    "number of failures")
+      .def_readonly("total_time", &RegionStatistics::total_time,
+                    "total wall time, in seconds")
+      .def_readonly("min_time", &RegionStatistics::min_time,
+                    "minimal wall time of a call, in seconds")
+      .def_readonly("max_time", &RegionStatistics::max_time,
+                    "maximal wall time of a call, in seconds");
+  boost::python::class_<ProfilingReport>("ProfilingReport")
+      .def("getTotal", ProfilingReport_getTotal,
+           "return the statistics of the given region, cumulated over all "
+           "threads")
+      .def("getThreadStatistics", ProfilingReport_getThreadStatistics,
+           "return the statistics of the given region for the given thread")
+      .def("getLoadImbalance", ProfilingReport_getLoadImbalance,
+           "return the load imbalance of the given region")
+      .def("getNumberOfThreads", ProfilingReport_getNumberOfThreads,
+           "return the number of threads described by the report")
+      .def("toJSON", ProfilingReport_toJSON,
+           "return the report in the `JSON` format")
+      .def("writeJSON", ProfilingReport_writeJSON,
+           "write the report in the given file using the `JSON` format");
+  boost::python::def("isProfilingAvailable", isProfilingAvailable,
+                     "return if the profiling layer has been compiled in "
+                     "the library");
+  boost::python::def("enableProfiling", enableProfiling,
+                     (boost::python::arg("b") = true),
+                     "enable or disable the profiling at runtime");
+  boost::python::def("isProfilingEnabled", isProfilingEnabled,
+                     "return if the profiling is enabled");
+  boost::python::def("resetProfiling", resetProfiling,
+                     "reset all the profiling data");
+  boost::python::def("getProfilingReport", getProfilingReport,
+                     "return a snapshot of the profiling data");
+}  // end of declareProfiling
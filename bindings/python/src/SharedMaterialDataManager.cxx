@@ -0,0 +1,81 @@
+/*!
+ * \file   SharedMaterialDataManager.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <boost/python/class.hpp>
+#include <boost/python/copy_const_reference.hpp>
+#include <boost/python/return_internal_reference.hpp>
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/SharedMaterialDataManager.hxx"
+
+void declareSharedMaterialDataManager();
+
+static mgis::behaviour::MaterialDataManager&
+SharedMaterialDataManager_getMaterialDataManager(
+    mgis::behaviour::SharedMaterialDataManager& m) {
+  return m.getMaterialDataManager();
+}  // end of SharedMaterialDataManager_getMaterialDataManager
+
+void declareSharedMaterialDataManager() {
+  using mgis::size_type;
+  using mgis::behaviour::Behaviour;
+  using mgis::behaviour::SharedMaterialDataManager;
+  using mgis::behaviour::SharedMaterialDataManagerOptions;
+  // exporting the SharedMaterialDataManagerOptions class
+  boost::python::class_<SharedMaterialDataManagerOptions>(
+      "SharedMaterialDataManagerOptions")
+      .def_readwrite("tangent_operator",
+                     &SharedMaterialDataManagerOptions::tangent_operator,
+                     "store the tangent operator blocks")
+      .def_readwrite("speed_of_sound",
+                     &SharedMaterialDataManagerOptions::speed_of_sound,
+                     "store the speed of sound")
+      .def_readwrite("integration_costs",
+                     &SharedMaterialDataManagerOptions::integration_costs,
+                     "store the integration costs")
+      .def_readwrite("material_properties",
+                     &SharedMaterialDataManagerOptions::material_properties,
+                     "store the values of the scalar material properties")
+      .def_readwrite(
+          "external_state_variables",
+          &SharedMaterialDataManagerOptions::external_state_variables,
+          "store the values of the external state variables");
+  // exporting the SharedMaterialDataManager class
+  boost::python::class_<SharedMaterialDataManager, boost::noncopyable>(
+      "SharedMaterialDataManager",
+      boost::python::init<const Behaviour&, const size_type,
+                          const std::string&>())
+      .def(boost::python::init<const Behaviour&, const size_type,
+                               const std::string&,
+                               const SharedMaterialDataManagerOptions&>())
+      .def(boost::python::init<const Behaviour&, const std::string&>())
+      .def(boost::python::init<const Behaviour&, const std::string&,
+                               const size_type, const size_type>())
+      .def("getMaterialDataManager",
+           &SharedMaterialDataManager_getMaterialDataManager,
+           boost::python::return_internal_reference<>(),
+           "return the material data manager")
+      .def("getName", &SharedMaterialDataManager::getName,
+           boost::python::return_value_policy<
+               boost::python::copy_const_reference>(),
+           "return the name of the shared memory segment")
+      .def("getNumberOfIntegrationPoints",
+           &SharedMaterialDataManager::getNumberOfIntegrationPoints,
+           "return the number of integration points stored in the segment")
+      .def("getOffset", &SharedMaterialDataManager::getOffset,
+           "return the index, in the segment, of the first integration point "
+           "of the material data manager")
+      .def("isOwner", &SharedMaterialDataManager::isOwner,
+           "return if this object created the segment");
+}  // end of declareSharedMaterialDataManager
@@ -14,33 +14,40 @@
 
 #include <boost/python/def.hpp>
 #include <boost/python/class.hpp>
+#include <boost/python/extract.hpp>
 #include "MGIS/Python/NumPySupport.hxx"
 #include "MGIS/Behaviour/State.hxx"
 
 void declareState();
 
-static boost::python::object State_getGradients(mgis::behaviour::State& s) {
-  return mgis::python::wrapInNumPyArray(s.gradients);
+static boost::python::object State_getGradients(boost::python::object o) {
+  auto& s = boost::python::extract<mgis::behaviour::State&>(o)();
+  return mgis::python::setNumPyArrayOwner(
+      mgis::python::wrapInNumPyArray(s.gradients), o);
 }  // end of State_getGradients
 
-static boost::python::object State_getThermodynamicForces(
-    mgis::behaviour::State& s) {
-  return mgis::python::wrapInNumPyArray(s.thermodynamic_forces);
+static boost::python::object State_getThermodynamicForces(boost::python::object o) {
+  auto& s = boost::python::extract<mgis::behaviour::State&>(o)();
+  return mgis::python::setNumPyArrayOwner(
+      mgis::python::wrapInNumPyArray(s.thermodynamic_forces), o);
 }  // end of State_getThermodynamicForces
 
-static boost::python::object State_getMaterialProperties(
-    mgis::behaviour::State& s) {
-  return mgis::python::wrapInNumPyArray(s.material_properties);
+static boost::python::object State_getMaterialProperties(boost::python::object o) {
+  auto& s = boost::python::extract<mgis::behaviour::State&>(o)();
+  return mgis::python::setNumPyArrayOwner(
+      mgis::python::wrapInNumPyArray(s.material_properties), o);
 }  // end of State_getMaterialProperties
 
-static boost::python::object State_getInternalStateVariables(
-    mgis::behaviour::State& s) {
-  return mgis::python::wrapInNumPyArray(s.internal_state_variables);
+static boost::python::object State_getInternalStateVariables(boost::python::object o) {
+  auto& s = boost::python::extract<mgis::behaviour::State&>(o)();
+  return mgis::python::setNumPyArrayOwner(
+      mgis::python::wrapInNumPyArray(s.internal_state_variables), o);
 }  // end of State_getInternalStateVariables
 
-static boost::python::object State_getExternalStateVariables(
-    mgis::behaviour::State& s) {
-  return mgis::python::wrapInNumPyArray(s.external_state_variables);
+static boost::python::object State_getExternalStateVariables(boost::python::object o) {
+  auto& s = boost::python::extract<mgis::behaviour::State&>(o)();
+  return mgis::python::setNumPyArrayOwner(
+      mgis::python::wrapInNumPyArray(s.external_state_variables), o);
 }  // end of State_getExternalStateVariables
 
 static void State_setExternalStateVariable(mgis::behaviour::State& s,
@@ -51,7 +58,7 @@ static void State_setExternalStateVariable(mgis::behaviour::State& s,
     mgis::behaviour::setExternalStateVariable(s, n, e());
   } else {
     mgis::behaviour::setExternalStateVariable(
-        s, n, mgis::python::mgis_convert_to_span(v));
+        s, n, mgis::python::mgis_convert_to_const_span(v));
   }
 }  // end of State_setExternalStateVariable
 
@@ -63,7 +70,7 @@ static void State_setExternalStateVariable2(mgis::behaviour::State& s,
     mgis::behaviour::setExternalStateVariable(s, o, e());
   } else {
     mgis::behaviour::setExternalStateVariable(
-        s, o, mgis::python::mgis_convert_to_span(v));
+        s, o, mgis::python::mgis_convert_to_const_span(v));
   }
 }  // end of State_setExternalStateVariable2
 
@@ -13,9 +13,20 @@
  */
 
 #include <boost/python/class.hpp>
+#include <boost/python/enum.hpp>
 #include "MGIS/ThreadPool.hxx"
 
 void declareThreadPool() {
+  boost::python::enum_<mgis::ThreadAffinityPolicy>("ThreadAffinityPolicy")
+      .value("NONE", mgis::ThreadAffinityPolicy::NONE)
+      .value("COMPACT", mgis::ThreadAffinityPolicy::COMPACT)
+      .value("SCATTER", mgis::ThreadAffinityPolicy::SCATTER);
   boost::python::class_<mgis::ThreadPool, boost::noncopyable>(
-      "ThreadPool", boost::python::init<mgis::size_type>());
+      "ThreadPool", boost::python::init<mgis::size_type>())
+      .def(boost::python::init<mgis::size_type, mgis::ThreadAffinityPolicy>())
+      .def("getNumberOfThreads", &mgis::ThreadPool::getNumberOfThreads)
+      .def("getThreadAffinityPolicy",
+           &mgis::ThreadPool::getThreadAffinityPolicy)
+      .def("getThreadProcessingUnit",
+           &mgis::ThreadPool::getThreadProcessingUnit);
 }  // end of declareThreadPool
\ No newline at end of file
@@ -24,6 +24,7 @@ void declareBehaviourData();
 void declareBehaviourDataView();
 void declareMaterialDataManager();
 void declareMaterialStateManager();
+void declareSharedMaterialDataManager();
 void declareIntegrate();
 void declareFiniteStrainSupport();
 
@@ -37,6 +38,7 @@ BOOST_PYTHON_MODULE(behaviour) {
   declareBehaviourDataView();
   declareMaterialDataManager();
   declareMaterialStateManager();
+  declareSharedMaterialDataManager();
   declareIntegrate();
   declareFiniteStrainSupport();
 }  // end of module behaviour
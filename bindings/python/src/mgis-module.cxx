@@ -16,5 +16,9 @@
 
 // forward declarations
 void declareThreadPool();
+void declareProfiling();
 
-BOOST_PYTHON_MODULE(_mgis) { declareThreadPool(); }  // end of module behaviour
+BOOST_PYTHON_MODULE(_mgis) {
+  declareThreadPool();
+  declareProfiling();
+}  // end of module behaviour
@@ -0,0 +1,115 @@
+/*!
+ * \file   include/MGIS/Allocator.hxx
+ * \brief  This file declares the `Allocator` class.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_ALLOCATOR_HXX
+#define LIB_MGIS_ALLOCATOR_HXX
+
+#include <new>
+#include <limits>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+#include "MGIS/MemoryResource.hxx"
+
+namespace mgis {
+
+  /*!
+   * \brief an allocator based on a memory resource.
+   *
+   * This allocator default-initializes the elements of a `std::vector` when
+   * no value is given, rather than value-initializing them. For trivial
+   * types such as `real`, this means that `resize(n)` does not write in the
+   * allocated memory. The memory pages are thus not touched by the calling
+   * thread, which allows them to be placed on the NUMA node of the thread
+   * which writes them first.
+   *
+   * The memory resource is propagated on copy, move and swap.
+   */
+  template <typename T>
+  struct Allocator {
+    //! \brief type of the allocated elements
+    using value_type = T;
+    //! \brief the memory resource is propagated on copy assignement
+    using propagate_on_container_copy_assignment = std::true_type;
+    //! \brief the memory resource is propagated on move assignement
+    using propagate_on_container_move_assignment = std::true_type;
+    //! \brief the memory resource is propagated on swap
+    using propagate_on_container_swap = std::true_type;
+    //! \brief default constructor, using the default memory resource
+    Allocator() noexcept : resource(&getDefaultMemoryResource()) {}
+    /*!
+     * \brief constructor from a memory resource
+     * \param[in] r: memory resource
+     */
+    Allocator(MemoryResource& r) noexcept : resource(&r) {}
+    //! \brief converting constructor
+    template <typename U>
+    Allocator(const Allocator<U>& a) noexcept
+        : resource(&a.getMemoryResource()) {}
+    /*!
+     * \return a pointer to an uninitialized array of the given size
+     * \param[in] n: number of elements
+     */
+    T* allocate(const std::size_t n) {
+      if (n > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+        throw std::bad_alloc();
+      }
+      return static_cast<T*>(
+          this->resource->allocate(n * sizeof(T), alignof(T)));
+    }
+    /*!
+     * \brief release an array
+     * \param[in] p: pointer to the array
+     * \param[in] n: number of elements
+     */
+    void deallocate(T* const p, const std::size_t n) noexcept {
+      this->resource->deallocate(p, n * sizeof(T), alignof(T));
+    }
+    //! \brief default-initialize an element
+    template <typename U>
+    void construct(U* const p) noexcept(
+        std::is_nothrow_default_constructible<U>::value) {
+      ::new (static_cast<void*>(p)) U;
+    }
+    //! \brief construct an element from the given arguments
+    template <typename U, typename... Args>
+    void construct(U* const p, Args&&... args) noexcept(
+        std::is_nothrow_constructible<U, Args...>::value) {
+      ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+    //! \return the underlying memory resource
+    MemoryResource& getMemoryResource() const noexcept {
+      return *(this->resource);
+    }
+
+   private:
+    //! \brief underlying memory resource
+    MemoryResource* resource;
+  };  // end of struct Allocator
+
+  //! \brief comparison operator
+  template <typename T, typename U>
+  bool operator==(const Allocator<T>& a, const Allocator<U>& b) noexcept {
+    return &(a.getMemoryResource()) == &(b.getMemoryResource());
+  }  // end of operator==
+
+  //! \brief comparison operator
+  template <typename T, typename U>
+  bool operator!=(const Allocator<T>& a, const Allocator<U>& b) noexcept {
+    return !(a == b);
+  }  // end of operator!=
+
+}  // end of namespace mgis
+
+#endif /* LIB_MGIS_ALLOCATOR_HXX */
@@ -26,6 +26,13 @@
 #include "MGIS/Behaviour/FiniteStrainBehaviourOptions.hxx"
 #include "MGIS/Behaviour/BehaviourFctPtr.hxx"
 
+namespace mgis {
+
+  // forward declaration
+  struct Executor;
+
+}  // end of namespace mgis
+
 namespace mgis::behaviour {
 
   //! \brief structure describing an initialize function of a behaviour
@@ -506,6 +513,56 @@ namespace mgis::behaviour {
                                                const Behaviour &,
                                                const mgis::span<const real> &,
                                                const RotationMatrix3D &);
+  /*!
+   * \brief rotate an array of gradients from the global frame to the material
+   * frame using the given executor to parallelize the computations.
+   * \param[in,out] e: executor
+   * \param[out] mg: array of gradients in the material frame
+   * \param[in] b: behaviour description
+   * \param[out] gg: array of gradients in the global frame
+   * \param[in] r: rotation matrix from the global frame to the material
+   * frame (an array of size 9 or 9*n where n is the number of integration
+   * points).
+   */
+  MGIS_EXPORT void rotateGradients(mgis::Executor &,
+                                   mgis::span<real>,
+                                   const Behaviour &,
+                                   const mgis::span<const real> &,
+                                   const mgis::span<const real> &);
+  /*!
+   * \brief rotate an array of thermodynamics forces from the material frame
+   * to the global frame using the given executor to parallelize the
+   * computations.
+   * \param[in,out] e: executor
+   * \param[out] gtf: thermodynamics forces in the global frame
+   * \param[in] b: behaviour description
+   * \param[in] mtf: thermodynamics forces in the material frame
+   * \param[in] r: rotation matrix from the global frame to the material
+   * frame (an array of size 9 or 9*n where n is the number of integration
+   * points).
+   */
+  MGIS_EXPORT void rotateThermodynamicForces(mgis::Executor &,
+                                             mgis::span<real>,
+                                             const Behaviour &,
+                                             const mgis::span<const real> &,
+                                             const mgis::span<const real> &);
+  /*!
+   * \brief rotate an array of tangent operator blocks from the material frame
+   * to the global frame using the given executor to parallelize the
+   * computations.
+   * \param[in,out] e: executor
+   * \param[out] gK: tangent operator blocks in the global frame
+   * \param[in] b: behaviour description
+   * \param[in] mK: tangent operator blocks in the material frame
+   * \param[in] r: rotation matrix from the global frame to the material
+   * frame (an array of size 9 or 9*n where n is the number of integration
+   * points).
+   */
+  MGIS_EXPORT void rotateTangentOperatorBlocks(mgis::Executor &,
+                                               mgis::span<real>,
+                                               const Behaviour &,
+                                               const mgis::span<const real> &,
+                                               const mgis::span<const real> &);
   /*!
    * \brief set the value of a parameter
    * \param[in] b: behaviour description
@@ -0,0 +1,162 @@
+/*!
+ * \file   include/MGIS/Behaviour/Checkpoint.hxx
+ * \brief  This file declares functions to save the state of a
+ * `MaterialDataManager` in a binary checkpoint file and to restore it.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_BEHAVIOUR_CHECKPOINT_HXX
+#define LIB_MGIS_BEHAVIOUR_CHECKPOINT_HXX
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "MGIS/Config.hxx"
+
+namespace mgis {
+
+  // forward declaration
+  struct ThreadPool;
+
+}  // end of namespace mgis
+
+namespace mgis::behaviour {
+
+  // forward declaration
+  struct MaterialDataManager;
+
+  //! \brief version of the checkpoint format written by `saveCheckpoint`
+  inline constexpr std::uint32_t checkpoint_format_version = 2;
+
+  /*!
+   * \brief options passed to the `saveCheckpoint` and `restoreCheckpoint`
+   * functions
+   */
+  struct CheckpointOptions {
+    /*!
+     * \brief thread pool used to write, check and restore the arrays by
+     * chunks in parallel. If null, those operations are performed by the
+     * calling thread.
+     */
+    mgis::ThreadPool* thread_pool = nullptr;
+    /*!
+     * \brief size, in bytes, of the chunks used to write the arrays and to
+     * compute their checksums. This value is stored in the checkpoint file
+     * and is only used by `saveCheckpoint`.
+     */
+    size_type chunk_size = size_type{1} << 22;
+    //! \brief if true, the checksums are verified by `restoreCheckpoint`
+    bool verify_checksums = true;
+  };  // end of struct CheckpointOptions
+
+  /*!
+   * \brief description of an internal state variable stored in a checkpoint
+   */
+  struct CheckpointVariable {
+    //! \brief name of the variable
+    std::string name;
+    //! \brief type identifier of the variable
+    int type_identifier = 0;
+    //! \brief size of the variable
+    size_type size = 0;
+  };  // end of struct CheckpointVariable
+
+  /*!
+   * \brief description of the content of a checkpoint file
+   */
+  struct CheckpointInformation {
+    //! \brief version of the format
+    std::uint32_t version = 0;
+    //! \brief name of the behaviour
+    std::string behaviour;
+    //! \brief modelling hypothesis
+    std::string hypothesis;
+    //! \brief library in which the behaviour was loaded
+    std::string library;
+    //! \brief version of `TFEL` used to generate the behaviour
+    std::string tfel_version;
+    //! \brief number of integration points
+    size_type n = 0;
+    //! \brief layout of the internal state variables
+    std::vector<CheckpointVariable> isvs;
+    //! \brief names of the arrays and uniform values stored in the file
+    std::vector<std::string> fields;
+  };  // end of struct CheckpointInformation
+
+  /*!
+   * \brief save the given material data manager in a binary checkpoint file.
+   *
+   * The following data are saved: the identity of the behaviour (name,
+   * modelling hypothesis, library and version of `TFEL`), the layout of the
+   * internal state variables, the states at the beginning and at the end of
+   * the time step (including the material properties and the external state
+   * variables, either uniform or not), the tangent operator blocks, the
+   * speed of sound and the integration costs, if allocated, and the
+   * proposed time step increase factor.
+   *
+   * The file starts with a fixed-size header holding a magic string, the
+   * version of the format and a description of the binary representation
+   * of the data, followed by the metadata. The arrays are stored after the
+   * metadata, each array starting at an offset aligned on a page, so that
+   * the file can be memory-mapped. Each array is written by chunks, in
+   * parallel if a thread pool is given. A checksum is computed for each
+   * chunk and the checksum of an array is the checksum of the checksums of
+   * its chunks.
+   *
+   * The storage of the tangent operator blocks (see the
+   * `TangentOperatorStorage` structure) is also saved.
+   *
+   * \note tangent operator blocks stored in single precision are not
+   * supported: an exception is thrown if they are allocated.
+   *
+   * \param[in] f: file name
+   * \param[in] m: material data manager
+   * \param[in] opts: options
+   */
+  MGIS_EXPORT void saveCheckpoint(const std::string&,
+                                  const MaterialDataManager&,
+                                  const CheckpointOptions& = {});
+  /*!
+   * \brief restore a material data manager from a checkpoint file.
+   *
+   * The name of the behaviour, the modelling hypothesis, the number of
+   * integration points and the sizes of the gradients and the thermodynamic
+   * forces must match the ones stored in the file. The storage of the
+   * tangent operator blocks must also match if those blocks are stored in
+   * the file. The internal state variables are restored by name if their
+   * layout changed: the variables which do not exist anymore are ignored
+   * and the values of the new variables are left unchanged. A variable
+   * whose size changed is reported as an error.
+   *
+   * On `POSIX` systems, the file is memory-mapped and the data are copied
+   * directly from the mapping to the arrays of the material data manager.
+   *
+   * The file is fully checked, including the checksums if requested, before
+   * any array of the material data manager is modified: if an error is
+   * reported, the material data manager is left unchanged.
+   *
+   * \param[in,out] m: material data manager
+   * \param[in] f: file name
+   * \param[in] opts: options
+   */
+  MGIS_EXPORT void restoreCheckpoint(MaterialDataManager&,
+                                     const std::string&,
+                                     const CheckpointOptions& = {});
+  /*!
+   * \return a description of the content of the given checkpoint file
+   * \param[in] f: file name
+   */
+  MGIS_EXPORT CheckpointInformation
+  readCheckpointInformation(const std::string&);
+
+}  // end of namespace mgis::behaviour
+
+#endif /* LIB_MGIS_BEHAVIOUR_CHECKPOINT_HXX */
@@ -0,0 +1,114 @@
+/*!
+ * \file   include/MGIS/Behaviour/ElasticPredictor.hxx
+ * \brief  This file declares the `ElasticPredictor` structure which allows
+ * to bypass the behaviour integration at integration points known to stay
+ * elastic.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_BEHAVIOUR_ELASTICPREDICTOR_HXX
+#define LIB_MGIS_BEHAVIOUR_ELASTICPREDICTOR_HXX
+
+#include <functional>
+#include <string_view>
+#include "MGIS/Config.hxx"
+
+namespace mgis::behaviour {
+
+  // forward declaration
+  struct MaterialDataManager;
+  // forward declaration
+  struct BehaviourIntegrationOptions;
+
+  /*!
+   * \brief a structure describing a fast path for the integration points
+   * known to stay elastic during the time step.
+   *
+   * If the predicate is set, it is called before the integration of the
+   * behaviour at each integration point. If the predicate returns true, the
+   * kernel is called in place of the behaviour. Otherwise, the behaviour is
+   * integrated as usual.
+   *
+   * The elastic predictor is not used for prediction steps (see the
+   * `IntegrationType` enumeration).
+   */
+  struct ElasticPredictor {
+    /*!
+     * \brief a function returning true if the given integration point is
+     * known to stay elastic during the time step. This function is typically
+     * a cheap comparison of a trial stress to the yield stress. It must be
+     * thread-safe.
+     *
+     * The arguments are the material data manager and the index of the
+     * integration point.
+     */
+    using Predicate =
+        std::function<bool(const MaterialDataManager&, const size_type)>;
+    /*!
+     * \brief a function updating the state at the end of the time step, and
+     * the tangent operator if required, at an elastic integration point. It
+     * must be thread-safe.
+     *
+     * The arguments are the material data manager, the integration options,
+     * the time step and the index of the integration point. The returned
+     * value has the same meaning than the one of the `integrate` function.
+     */
+    using Kernel = std::function<int(MaterialDataManager&,
+                                     const BehaviourIntegrationOptions&,
+                                     const real,
+                                     const size_type)>;
+    //! \return if the elastic predictor is enabled
+    bool isEnabled() const { return static_cast<bool>(this->predicate); }
+    //! \brief predicate
+    Predicate predicate;
+    //! \brief kernel used at the elastic integration points
+    Kernel kernel;
+  };  // end of struct ElasticPredictor
+
+  /*!
+   * \return a kernel updating the thermodynamic forces of an elastic
+   * integration point using a cached elastic stiffness:
+   *
+   * \f[
+   * \underline{\sigma}_{1} = \underline{\sigma}_{0} +
+   * \underline{\underline{D}}\,\colon\,
+   * \left(\underline{\varepsilon}_{1}-\underline{\varepsilon}_{0}\right)
+   * \f]
+   *
+   * The elastic stiffness is computed once by calling the behaviour with the
+   * `PREDICTION_ELASTIC_OPERATOR` integration type at the first integration
+   * point. The internal state variables at the end of the time step are set
+   * equal to their values at the beginning of the time step, except the
+   * elastic strain, if given, which is incremented by the increment of the
+   * gradient. If required, the tangent operator is set equal to the elastic
+   * stiffness.
+   *
+   * \param[in,out] m: material data manager
+   * \param[in] eel: name of the internal state variable associated with the
+   * elastic strain, if any
+   *
+   * \note this kernel is only meaningful for behaviours with one gradient
+   * and one thermodynamic force, a uniform and constant elastic stiffness and
+   * no thermal strain, such as small strain plastic behaviours in isothermal
+   * conditions.
+   * \note the stored energy, if computed by the behaviour, is updated
+   * assuming a linear elastic response. The dissipated energy is left
+   * unchanged.
+   * \note the computation of the speed of sound is not supported.
+   * \note the tangent operator blocks of the first integration point are
+   * used to compute the elastic stiffness. They are allocated if required.
+   */
+  MGIS_EXPORT ElasticPredictor::Kernel makeLinearElasticKernel(
+      MaterialDataManager&, const std::string_view = "");
+
+}  // end of namespace mgis::behaviour
+
+#endif /* LIB_MGIS_BEHAVIOUR_ELASTICPREDICTOR_HXX */
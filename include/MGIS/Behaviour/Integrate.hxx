@@ -15,16 +15,19 @@
 #define LIB_MGIS_BEHAVIOUR_INTEGRATE_HXX
 
 #include <limits>
+#include <string>
 #include <thread>
 #include <vector>
+#include <functional>
 #include "MGIS/Config.hxx"
 #include "MGIS/Span.hxx"
 #include "MGIS/Behaviour/BehaviourDataView.hxx"
 
 namespace mgis {
 
-  // forward declaration
+  // forward declarations
   struct ThreadPool;
+  struct Executor;
 
 }  // namespace mgis
 
@@ -58,8 +61,81 @@ namespace mgis::behaviour {
         IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
     //! \brief if true, the speed of sound shall be computed
     bool compute_speed_of_sound = false;
+    /*!
+     * \brief if true, the wall time spent in the integration of the behaviour
+     * at each integration point is stored in the `integration_costs` array of
+     * the material data manager, which is allocated if required. Those costs
+     * are used by the next calls to the multi-threaded versions of the
+     * `integrate` function to build ranges of integration points with balanced
+     * costs.
+     */
+    bool measure_integration_costs = false;
   };  // end of BehaviourIntegrationOptions
 
+  /*!
+   * \brief structure describing a post-processing to be executed right after
+   * the behaviour integration at each integration point.
+   */
+  struct PostProcessingRequest {
+    //! \brief name of the post-processing
+    std::string name;
+    /*!
+     * \brief view to the memory where the results of the post-processing are
+     * stored. The size of this array must be equal to the number of
+     * integration points times the size of the outputs of the post-processing.
+     */
+    mgis::span<mgis::real> outputs;
+  };  // end of struct PostProcessingRequest
+
+  //! \brief reduction operations
+  enum struct ReductionOperation {
+    MIN,
+    MAX,
+    SUM
+  };  // end of enum ReductionOperation
+
+  //! \brief quantities that can be reduced during the behaviour integration
+  enum struct ReducedQuantity {
+    //! \brief speed of sound, which requires its computation
+    SPEED_OF_SOUND,
+    //! \brief stored energy at the end of the time step
+    STORED_ENERGY,
+    //! \brief dissipated energy at the end of the time step
+    DISSIPATED_ENERGY,
+    /*!
+     * \brief stable time step of an explicit scheme, i.e. the ratio of the
+     * characteristic length associated with the integration point and the
+     * speed of sound, which requires its computation.
+     */
+    STABLE_TIME_STEP
+  };  // end of enum ReducedQuantity
+
+  /*!
+   * \brief structure describing a reduction computed during the behaviour
+   * integration, which avoids an additional pass over the integration
+   * points.
+   */
+  struct ReductionRequest {
+    //! \brief reduction operation
+    ReductionOperation operation;
+    //! \brief reduced quantity
+    ReducedQuantity quantity;
+    /*!
+     * \brief weights of the integration points, typically the quadrature
+     * weights. The value of the quantity at an integration point is multiplied
+     * by its weight. If empty, the weights are assumed equal to one.
+     * Otherwise, the size of this array must be equal to the number of
+     * integration points.
+     */
+    mgis::span<const mgis::real> weights = {};
+    /*!
+     * \brief characteristic lengths associated with the integration points.
+     * This array is required by the `STABLE_TIME_STEP` quantity, and only by
+     * it. Its size must be equal to the number of integration points.
+     */
+    mgis::span<const mgis::real> characteristic_lengths = {};
+  };  // end of struct ReductionRequest
+
   /*!
    * \brief structure in charge of reporting the result of a behaviour
    * integration.
@@ -95,6 +171,8 @@ namespace mgis::behaviour {
     mgis::size_type n = std::numeric_limits<mgis::size_type>::max();
     //! \brief error message, if any
     std::string error_message;
+    //! \brief values of the requested reductions, if any
+    std::vector<mgis::real> reductions;
   };  // end of struct BehaviourIntegrationResult
 
   /*!
@@ -129,7 +207,20 @@ namespace mgis::behaviour {
     int exit_status = 1;
     //! \brief integration results per threads
     std::vector<BehaviourIntegrationResult> results;
+    //! \brief values of the requested reductions, if any
+    std::vector<mgis::real> reductions;
   };  // end of struct MultiThreadedBehaviourIntegrationResult
+  /*!
+   * \brief a function called by a worker thread as soon as the integration
+   * of a chunk of integration points is finished.
+   *
+   * The arguments are the index of the first integration point of the
+   * chunk, the index past the last integration point of the chunk and the
+   * result of the integration of the chunk. Chunks are processed
+   * concurrently, so this function must be thread-safe.
+   */
+  using IntegrationChunkCallback = std::function<void(
+      const size_type, const size_type, const BehaviourIntegrationResult&)>;
   /*!
    * \brief execute the given initialize function.
    * \param[in,out] d: behaviour data view
@@ -232,6 +323,69 @@ namespace mgis::behaviour {
                             MaterialDataManager&,
                             const std::string_view,
                             mgis::span<const real>);
+  /*!
+   * \brief execute the given initialize function over a list of integration
+   * points
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the initialize function
+   * \param[in] indices: indices of the integration points
+   */
+  MGIS_EXPORT BehaviourIntegrationResult
+  executeInitializeFunction(MaterialDataManager&,
+                            const std::string_view,
+                            mgis::span<const size_type>);
+  /*!
+   * \brief execute the given initialize function over a list of integration
+   * points
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the initialize function
+   * \param[in] inputs: initialize function inputs
+   * \param[in] indices: indices of the integration points
+   *
+   * \note the inputs can be uniform or not. If not uniform, the inputs are
+   * indexed by the indices of the integration points, not by their positions
+   * in the list.
+   */
+  MGIS_EXPORT BehaviourIntegrationResult
+  executeInitializeFunction(MaterialDataManager&,
+                            const std::string_view,
+                            mgis::span<const real>,
+                            mgis::span<const size_type>);
+  /*!
+   * \brief execute the given initialize function over a list of integration
+   * points using a thread pool to parallelize the computations. Each thread
+   * treats the same number of integration points.
+   * \param[in,out] p: thread pool
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the initialize function
+   * \param[in] indices: indices of the integration points
+   *
+   * \note the list of integration points shall not contain duplicates.
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  executeInitializeFunction(ThreadPool&,
+                            MaterialDataManager&,
+                            const std::string_view,
+                            mgis::span<const size_type>);
+  /*!
+   * \brief execute the given initialize function over a list of integration
+   * points using a thread pool to parallelize the computations. Each thread
+   * treats the same number of integration points.
+   * \param[in,out] p: thread pool
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the initialize function
+   * \param[in] inputs: initialize function inputs
+   * \param[in] indices: indices of the integration points
+   *
+   * \note the inputs can be uniform or not.
+   * \note the list of integration points shall not contain duplicates.
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  executeInitializeFunction(ThreadPool&,
+                            MaterialDataManager&,
+                            const std::string_view,
+                            mgis::span<const real>,
+                            mgis::span<const size_type>);
   /*!
    * \brief integrate the behaviour. The returned value has the following
    * meaning:
@@ -330,6 +484,63 @@ namespace mgis::behaviour {
                             MaterialDataManager&,
                             const IntegrationType it,
                             const real);
+  /*!
+   * \brief integrate the behaviour over all integration points using a thread
+   * pool and call the given function as soon as a chunk of integration points
+   * is treated. This allows to pipeline the behaviour integration with the
+   * assembly of the contributions of the integration points already treated.
+   * \return the result of the behaviour integration.
+   * \param[in,out] p: thread pool
+   * \param[in,out] m: material data manager
+   * \param[in] opts: integration options
+   * \param[in] dt: time step
+   * \param[in] c: callback, called by the worker threads
+   * \param[in] nchunks: number of chunks. If null, the number of threads of
+   * the pool is used.
+   *
+   * \note the callback is called even if the integration failed for some
+   * integration points of the chunk. An exception thrown by the callback is
+   * reported as the failure of the whole integration.
+   * \note if required, the memory associated with the tangent operator blocks
+   * is automatically allocated.
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  integrate(mgis::ThreadPool&,
+            MaterialDataManager&,
+            const BehaviourIntegrationOptions&,
+            const real,
+            const IntegrationChunkCallback&,
+            const size_type = 0);
+  /*!
+   * \brief integrate the behaviour over all integration points using the
+   * given executor to parallelize the integration.
+   * \return the result of the behaviour integration.
+   * \param[in,out] e: executor
+   * \param[in,out] m: material data manager
+   * \param[in] c: description of the operation to be performed
+   * \param[in] dt: time step
+   *
+   * \note if required, the memory associated with the tangent operator blocks
+   * is automatically allocated.
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  integrate(mgis::Executor&,
+            MaterialDataManager&,
+            const BehaviourIntegrationOptions&,
+            const real);
+  /*!
+   * \brief integrate the behaviour over all integration points using the
+   * given executor to parallelize the integration.
+   * \return an exit status (see the `ThreadPool` overload).
+   * \param[in,out] e: executor
+   * \param[in,out] m: material data manager
+   * \param[in] it: integration type
+   * \param[in] dt: time step
+   */
+  MGIS_EXPORT int integrate(mgis::Executor&,
+                            MaterialDataManager&,
+                            const IntegrationType,
+                            const real);
   /*!
    * \brief integrate the behaviour for a range of integration points.
    * \return an exit status. The returned value has the following meaning:
@@ -351,6 +562,178 @@ namespace mgis::behaviour {
                             const real,
                             const size_type,
                             const size_type);
+  /*!
+   * \brief integrate the behaviour for a range of integration points and
+   * execute the given post-processings at each integration point right after
+   * a successful integration.
+   * \return the result of the behaviour integration.
+   * \param[in,out] m: material data manager
+   * \param[in] c: description of the operation to be performed
+   * \param[in] dt: time step
+   * \param[in] pp: post-processings to be executed
+   * \param[in] b: first index of the range
+   * \param[in] e: last index of the range
+   *
+   * \note if one post-processing fails, the integration is stopped and
+   * reported as failed.
+   * \note if required, the memory associated with the tangent operator blocks
+   * is automatically allocated.
+   */
+  MGIS_EXPORT BehaviourIntegrationResult
+  integrate(MaterialDataManager&,
+            const BehaviourIntegrationOptions&,
+            const real,
+            const std::vector<PostProcessingRequest>&,
+            const size_type,
+            const size_type);
+  /*!
+   * \brief integrate the behaviour over all integration points using a thread
+   * pool to parallelize the integration and execute the given post-processings
+   * at each integration point right after a successful integration.
+   * \return the result of the behaviour integration.
+   * \param[in,out] p: thread pool
+   * \param[in,out] m: material data manager
+   * \param[in] c: description of the operation to be performed
+   * \param[in] dt: time step
+   * \param[in] pp: post-processings to be executed
+   *
+   * \note if required, the memory associated with the tangent operator blocks
+   * is automatically allocated.
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  integrate(mgis::ThreadPool&,
+            MaterialDataManager&,
+            const BehaviourIntegrationOptions&,
+            const real,
+            const std::vector<PostProcessingRequest>&);
+  /*!
+   * \brief integrate the behaviour for a range of integration points and
+   * compute the given reductions over the successfully integrated
+   * integration points.
+   * \return the result of the behaviour integration. The values of the
+   * reductions are stored in the `reductions` member, in the order of the
+   * requests.
+   * \param[in,out] m: material data manager
+   * \param[in] c: description of the operation to be performed
+   * \param[in] dt: time step
+   * \param[in] rr: reductions to be computed
+   * \param[in] b: first index of the range
+   * \param[in] e: last index of the range
+   *
+   * \note the values of the reductions are meaningless if the integration
+   * failed.
+   * \note if required, the memory associated with the tangent operator blocks
+   * is automatically allocated.
+   */
+  MGIS_EXPORT BehaviourIntegrationResult
+  integrate(MaterialDataManager&,
+            const BehaviourIntegrationOptions&,
+            const real,
+            const std::vector<ReductionRequest>&,
+            const size_type,
+            const size_type);
+  /*!
+   * \brief integrate the behaviour over all integration points using a thread
+   * pool to parallelize the integration and compute the given reductions.
+   * Each thread computes the reductions over its range of integration
+   * points. The partial results are then combined in the order of the
+   * ranges, so that the result does not depend on the order in which the
+   * threads finish.
+   * \return the result of the behaviour integration. The values of the
+   * reductions are stored in the `reductions` member, in the order of the
+   * requests.
+   * \param[in,out] p: thread pool
+   * \param[in,out] m: material data manager
+   * \param[in] c: description of the operation to be performed
+   * \param[in] dt: time step
+   * \param[in] rr: reductions to be computed
+   *
+   * \note if required, the memory associated with the tangent operator blocks
+   * is automatically allocated.
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  integrate(mgis::ThreadPool&,
+            MaterialDataManager&,
+            const BehaviourIntegrationOptions&,
+            const real,
+            const std::vector<ReductionRequest>&);
+  /*!
+   * \brief integrate the behaviour over a list of integration points.
+   * \return the result of the behaviour integration.
+   * \param[in,out] m: material data manager
+   * \param[in] c: description of the operation to be performed
+   * \param[in] dt: time step
+   * \param[in] indices: indices of the integration points
+   *
+   * \note if required, the memory associated with the tangent operator blocks
+   * is automatically allocated.
+   */
+  MGIS_EXPORT BehaviourIntegrationResult
+  integrate(MaterialDataManager&,
+            const BehaviourIntegrationOptions&,
+            const real,
+            mgis::span<const size_type>);
+  /*!
+   * \brief integrate the behaviour over a list of integration points using a
+   * thread pool to parallelize the integration. The list is split in
+   * sub-lists with the same number of integration points or, if the
+   * integration costs are available, with balanced costs.
+   * \return the result of the behaviour integration.
+   * \param[in,out] p: thread pool
+   * \param[in,out] m: material data manager
+   * \param[in] c: description of the operation to be performed
+   * \param[in] dt: time step
+   * \param[in] indices: indices of the integration points
+   *
+   * \note the list of integration points shall not contain duplicates.
+   * \note if required, the memory associated with the tangent operator blocks
+   * is automatically allocated.
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  integrate(mgis::ThreadPool&,
+            MaterialDataManager&,
+            const BehaviourIntegrationOptions&,
+            const real,
+            mgis::span<const size_type>);
+  /*!
+   * \brief structure describing the integration of the behaviour over all
+   * the integration points of a material data manager. This structure is
+   * used by the multi-material version of the `integrate` function.
+   */
+  struct MaterialIntegrationRequest {
+    //! \brief material data manager
+    MaterialDataManager& material;
+    //! \brief integration options
+    BehaviourIntegrationOptions options;
+    //! \brief time step
+    real dt;
+  };  // end of struct MaterialIntegrationRequest
+  /*!
+   * \brief integrate the behaviours of several materials in a single
+   * parallel pass.
+   *
+   * The integration points of each material are split in chunks, balanced
+   * using the integration costs if available. The chunks of the different
+   * materials are interleaved and dynamically distributed to the threads of
+   * the pool, which avoids the synchronisation of the threads after each
+   * material and keeps all the threads busy when some materials are small.
+   *
+   * \return the results of the integration of each material, the `results`
+   * member holding the results of each chunk.
+   * \param[in,out] p: thread pool
+   * \param[in] requests: list of integrations to be performed
+   * \param[in] chunk_size: maximal number of integration points treated by a
+   * chunk. If null, the chunk size is chosen so that each thread treats
+   * about four chunks.
+   *
+   * \note a material data manager shall appear only once in the list.
+   * \note if required, the memory associated with the tangent operator blocks
+   * is automatically allocated.
+   */
+  MGIS_EXPORT std::vector<MultiThreadedBehaviourIntegrationResult> integrate(
+      mgis::ThreadPool&,
+      const std::vector<MaterialIntegrationRequest>&,
+      const size_type = 0);
   /*!
    * \brief execute the given post-processing
    * \param[out] outputs: post-processing results
@@ -397,6 +780,58 @@ namespace mgis::behaviour {
                         ThreadPool&,
                         MaterialDataManager&,
                         const std::string_view);
+  /*!
+   * \brief execute the given post-processing over all integration points using
+   * the given executor to parallelize the computations.
+   * \param[out] outputs: post-processing results
+   * \param[in,out] e: executor
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the post-processing
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  executePostProcessing(mgis::span<real>,
+                        Executor&,
+                        MaterialDataManager&,
+                        const std::string_view);
+  /*!
+   * \brief execute the given post-processing over a list of integration
+   * points
+   * \param[out] outputs: post-processing results, stored for all the
+   * integration points
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the post-processing
+   * \param[in] indices: indices of the integration points
+   */
+  MGIS_EXPORT BehaviourIntegrationResult
+  executePostProcessing(mgis::span<real>,
+                        MaterialDataManager&,
+                        const std::string_view,
+                        mgis::span<const size_type>);
+  /*!
+   * \brief execute the given post-processing over a list of integration
+   * points using a thread pool to parallelize the computations. Each thread
+   * treats the same number of integration points.
+   * \param[out] outputs: post-processing results, stored for all the
+   * integration points
+   * \param[in,out] p: thread pool
+   * \param[in,out] d: material data manager
+   * \param[in] n: name of the post-processing
+   * \param[in] indices: indices of the integration points
+   *
+   * \note the list of integration points shall not contain duplicates.
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  executePostProcessing(mgis::span<real>,
+                        ThreadPool&,
+                        MaterialDataManager&,
+                        const std::string_view,
+                        mgis::span<const size_type>);
+  /*!
+   * \return the indices of the integration points selected by the given mask
+   * \param[in] mask: mask
+   */
+  MGIS_EXPORT std::vector<size_type> getActiveIntegrationPoints(
+      mgis::span<const bool>);
 
 }  // end of namespace mgis::behaviour
 
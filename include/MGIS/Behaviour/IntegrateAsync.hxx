@@ -0,0 +1,144 @@
+/*!
+ * \file   include/MGIS/Behaviour/IntegrateAsync.hxx
+ * \brief  This file declares functions launching the integration of a
+ * behaviour, or the execution of a post-processing, on a thread pool
+ * without waiting for the completion of the computations.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_BEHAVIOUR_INTEGRATEASYNC_HXX
+#define LIB_MGIS_BEHAVIOUR_INTEGRATEASYNC_HXX
+
+#include <future>
+#include <vector>
+#include <string_view>
+#include "MGIS/Config.hxx"
+#include "MGIS/Span.hxx"
+#include "MGIS/ThreadedTaskResult.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+namespace mgis::behaviour {
+
+  /*!
+   * \brief a handle to computations launched on a thread pool by the
+   * `integrateAsync` and `executePostProcessingAsync` functions.
+   *
+   * The computations are running while the handle is alive. The caller may
+   * perform other tasks and poll the state of the computations using the
+   * `isReady` method, or block until their completion using the `wait` or
+   * `get` methods.
+   *
+   * \note the destructor waits for the completion of the computations, so
+   * that the data used by the computations are never released while the
+   * computations are running.
+   */
+  struct MGIS_EXPORT AsyncBehaviourIntegrationResult {
+    //! \brief a simple alias
+    using Task = std::future<ThreadedTaskResult<BehaviourIntegrationResult>>;
+    //! \brief default constructor
+    AsyncBehaviourIntegrationResult();
+    /*!
+     * \brief constructor from a list of tasks
+     * \param[in] t: tasks
+     */
+    AsyncBehaviourIntegrationResult(std::vector<Task>&&);
+    //! \brief move constructor
+    AsyncBehaviourIntegrationResult(AsyncBehaviourIntegrationResult&&);
+    //! \brief move assignement
+    AsyncBehaviourIntegrationResult& operator=(
+        AsyncBehaviourIntegrationResult&&);
+    //! \return if the handle is associated with some computations
+    bool valid() const;
+    //! \return if all the computations are finished
+    bool isReady() const;
+    //! \brief wait for the completion of the computations
+    void wait() const;
+    /*!
+     * \brief wait for the completion of the computations and return their
+     * results. After this call, the handle is no more valid.
+     *
+     * \note if an exception was thrown by one of the computations, the
+     * first exception is rethrown once all the computations are finished.
+     */
+    MultiThreadedBehaviourIntegrationResult get();
+    //! \brief destructor
+    ~AsyncBehaviourIntegrationResult();
+
+   private:
+    AsyncBehaviourIntegrationResult(const AsyncBehaviourIntegrationResult&) =
+        delete;
+    AsyncBehaviourIntegrationResult& operator=(
+        const AsyncBehaviourIntegrationResult&) = delete;
+    //! \brief tasks
+    std::vector<Task> tasks;
+  };  // end of struct AsyncBehaviourIntegrationResult
+
+  /*!
+   * \brief launch the integration of the behaviour over all integration
+   * points on a thread pool and return immediately.
+   * \return a handle to the computations.
+   * \param[in,out] p: thread pool
+   * \param[in,out] m: material data manager
+   * \param[in] opts: integration options
+   * \param[in] dt: time step
+   *
+   * \note if required, the memory associated with the tangent operator blocks
+   * is allocated before this function returns.
+   * \note the material data manager must not be modified, nor destroyed,
+   * before the end of the computations. The integration options are copied.
+   */
+  MGIS_EXPORT AsyncBehaviourIntegrationResult
+  integrateAsync(mgis::ThreadPool&,
+                 MaterialDataManager&,
+                 const BehaviourIntegrationOptions&,
+                 const real);
+  /*!
+   * \brief launch the integration of the behaviour over all integration
+   * points on a thread pool and return immediately. The given function is
+   * called by the worker threads as soon as a chunk of integration points is
+   * treated.
+   * \return a handle to the computations.
+   * \param[in,out] p: thread pool
+   * \param[in,out] m: material data manager
+   * \param[in] opts: integration options
+   * \param[in] dt: time step
+   * \param[in] c: callback, copied by this function
+   * \param[in] nchunks: number of chunks. If null, the number of threads of
+   * the pool is used.
+   */
+  MGIS_EXPORT AsyncBehaviourIntegrationResult
+  integrateAsync(mgis::ThreadPool&,
+                 MaterialDataManager&,
+                 const BehaviourIntegrationOptions&,
+                 const real,
+                 const IntegrationChunkCallback&,
+                 const size_type = 0);
+  /*!
+   * \brief launch the execution of the given post-processing over all
+   * integration points on a thread pool and return immediately.
+   * \return a handle to the computations.
+   * \param[out] outputs: post-processing results
+   * \param[in,out] p: thread pool
+   * \param[in,out] m: material data manager
+   * \param[in] n: name of the post-processing
+   *
+   * \note the outputs and the material data manager must not be modified,
+   * nor destroyed, before the end of the computations.
+   */
+  MGIS_EXPORT AsyncBehaviourIntegrationResult
+  executePostProcessingAsync(mgis::span<real>,
+                             mgis::ThreadPool&,
+                             MaterialDataManager&,
+                             const std::string_view);
+
+}  // end of namespace mgis::behaviour
+
+#endif /* LIB_MGIS_BEHAVIOUR_INTEGRATEASYNC_HXX */
@@ -20,7 +20,10 @@
 #include <memory>
 #include <vector>
 #include "MGIS/Config.hxx"
+#include "MGIS/Allocator.hxx"
 #include "MGIS/Behaviour/MaterialStateManager.hxx"
+#include "MGIS/Behaviour/ElasticPredictor.hxx"
+#include "MGIS/Behaviour/TangentOperatorStorage.hxx"
 
 namespace mgis::behaviour {
 
@@ -34,6 +37,12 @@ namespace mgis::behaviour {
      * \param[in] b: behaviour
      */
     BehaviourIntegrationWorkSpace(const Behaviour&);
+    /*!
+     * \brief constructor
+     * \param[in] b: behaviour
+     * \param[in] r: memory resource
+     */
+    BehaviourIntegrationWorkSpace(const Behaviour&, mgis::MemoryResource&);
     //! \brief move constructor
     BehaviourIntegrationWorkSpace(BehaviourIntegrationWorkSpace&&);
     //! \brief copye constructor
@@ -47,14 +56,22 @@ namespace mgis::behaviour {
     ~BehaviourIntegrationWorkSpace();
     //! \brief a buffer to hold error messages
     std::vector<char> error_message;
+    //! \brief a simple alias
+    using Storage = std::vector<mgis::real, mgis::Allocator<mgis::real>>;
     //! material properties at the beginning of the time step
-    std::vector<mgis::real> mps0;
+    Storage mps0;
     //! material properties at the end of the time step
-    std::vector<mgis::real> mps1;
+    Storage mps1;
     //! external state variables at the beginning of the time step
-    std::vector<mgis::real> esvs0;
+    Storage esvs0;
     //! external state variables at the end of the time step
-    std::vector<mgis::real> esvs1;
+    Storage esvs1;
+    /*!
+     * \brief dense tangent operator blocks, used when the material data
+     * manager uses a compact storage of the tangent operator blocks (see the
+     * `TangentOperatorStorage` structure)
+     */
+    Storage K;
   };  // end of struct BehaviourIntegrationWorkSpace
 
   /*!
@@ -70,6 +87,9 @@ namespace mgis::behaviour {
      * \brief view to an externally allocated memory used to store the
      * tangent operator. If empty, the material data manager will
      * initialize the required memory internally if required.
+     *
+     * \note external memory can't be used if the tangent operator blocks are
+     * stored in single precision.
      */
     mgis::span<mgis::real> K;
     /*!
@@ -78,6 +98,12 @@ namespace mgis::behaviour {
      * initialize the required memory internally if required.
      */
     mgis::span<mgis::real> speed_of_sound;
+    /*!
+     * \brief view to an externally allocated memory used to store the
+     * integration costs. If empty, the material data manager will
+     * initialize the required memory internally if required.
+     */
+    mgis::span<mgis::real> integration_costs;
     /*!
      * \brief object used to initalize the state manager associated with the
      * beginning of the time step.
@@ -88,6 +114,32 @@ namespace mgis::behaviour {
      * end of the time step.
      */
     MaterialStateManagerInitializer s1;
+    /*!
+     * \brief thread pool used to initialize the memory allocated internally
+     * (first-touch policy). This thread pool is used to initialize the
+     * state managers, unless their initializers specify another one, and
+     * the tangent operator blocks, the speed of sound and the integration
+     * costs, when allocated (see the `initializeValuesInParallel` function).
+     *
+     * \note the thread pool is stored by the material data manager and must
+     * outlive it.
+     */
+    mgis::ThreadPool* thread_pool = nullptr;
+    /*!
+     * \brief memory resource used to allocate the memory handled internally.
+     * This memory resource is used by the state managers, unless their
+     * initializers specify another one, for the tangent operator blocks, the
+     * speed of sound, the integration costs and the integration workspaces.
+     * If null, the default memory resource is used.
+     *
+     * \note the memory resource must outlive the material data manager.
+     */
+    mgis::MemoryResource* memory_resource = nullptr;
+    /*!
+     * \brief storage of the tangent operator blocks. By default, the tangent
+     * operator blocks are stored as dense matrices in double precision.
+     */
+    TangentOperatorStorage tangent_operator_storage;
   };  // end of MaterialDataManagerInitializer
 
   /*!
@@ -186,6 +238,38 @@ namespace mgis::behaviour {
      * removed.
      */
     void releaseArrayOfSpeedOfSounds();
+    /*!
+     * \brief allocate the memory associated with the integration costs if
+     * required.
+     *
+     * This method is useless if the memory associated with the integration
+     * costs had previously been allocated or assigned to external memory (see
+     * the `MaterialDataManagerInitializer` structure).
+     *
+     * \note This method is thread-safe if the `thread_safe` is `true`.
+     * In this case, the memory allocation is guarded by a mutex.
+     * See the `setThreadSafe` method for details
+     */
+    void allocateArrayOfIntegrationCosts();
+    /*!
+     * \brief use an externally allocated memory to store the integration
+     * costs.
+     *
+     * \param[in] m: memory view
+     *
+     * \note this method calls `releaseArrayOfIntegrationCosts` before
+     * allocating the memory.
+     */
+    void useExternalArrayOfIntegrationCosts(mgis::span<real>);
+    /*!
+     * \brief release the memory associated with the integration costs.
+     *
+     * If the memory associated with the integration costs was handled
+     * internally, this memory is freed.
+     * If an external memory buffer was used, reference to this buffer is
+     * removed.
+     */
+    void releaseArrayOfIntegrationCosts();
     /*!
      * \brief return a workspace associated with the given behaviour.
      *
@@ -206,19 +290,46 @@ namespace mgis::behaviour {
     MaterialStateManager s0;
     //! \brief state at the end of the time step
     MaterialStateManager s1;
-    //! \brief view of the stiffness matrices, if required.
+    /*!
+     * \brief view of the stiffness matrices, if required. This view is empty
+     * if the tangent operator blocks are stored in single precision.
+     */
     mgis::span<real> K;
+    /*!
+     * \brief view of the stiffness matrices stored in single precision, if
+     * required (see the `TangentOperatorStorage` structure).
+     */
+    mgis::span<float> K_single_precision;
     //! \brief proposed time step increment increase factor
     real rdt;
     //! \brief view on the speed of sound.
     mgis::span<real> speed_of_sound;
+    /*!
+     * \brief view on the integration costs, i.e. the wall time, in seconds,
+     * spent in the last integration of the behaviour at each integration
+     * point. If not empty, those costs are used to balance the ranges of
+     * integration points treated by each thread in the multi-threaded
+     * versions of the `integrate` function. See the
+     * `measure_integration_costs` member of the `BehaviourIntegrationOptions`
+     * structure.
+     */
+    mgis::span<real> integration_costs;
+    /*!
+     * \brief fast path used at the integration points known to stay elastic.
+     * This fast path is disabled by default.
+     */
+    ElasticPredictor elastic_predictor;
     //! \brief number of integration points
     const size_type n;
     /*!
-     * \brief the size of the stiffness matrix for one integration point (the
-     * size of K is K_stride times the number of integration points)
+     * \brief the number of values of the stiffness matrix stored for one
+     * integration point (the size of K is K_stride times the number of
+     * integration points). This number is smaller than the size of the dense
+     * stiffness matrix if the tangent operator blocks are packed.
      */
     const size_type K_stride;
+    //! \brief storage of the tangent operator blocks
+    const TangentOperatorStorage K_storage;
     //! \brief underlying behaviour
     const Behaviour& b;
 
@@ -231,10 +342,20 @@ namespace mgis::behaviour {
     MaterialDataManager& operator=(MaterialDataManager&&) = delete;
     //! copy assignement
     MaterialDataManager& operator=(const MaterialDataManager&) = delete;
+    //! \brief a simple alias
+    using Storage = std::vector<real, mgis::Allocator<real>>;
     //! \brief values of the stiffness matrices, if hold internally.
-    std::vector<real> K_values;
+    Storage K_values;
+    //! \brief values of the stiffness matrices stored in single precision
+    std::vector<float, mgis::Allocator<float>> K_single_precision_values;
     //! \brief values of the speed of sound, if hold internally.
-    std::vector<real> speed_of_sound_values;
+    Storage speed_of_sound_values;
+    //! \brief values of the integration costs, if hold internally.
+    Storage integration_costs_values;
+    //! \brief thread pool used to initialize the memory, if any
+    mgis::ThreadPool* thread_pool = nullptr;
+    //! \brief memory resource
+    mgis::MemoryResource& memory_resource;
     //! \brief integration workspace for individual threads.
     std::map<std::thread::id, std::unique_ptr<BehaviourIntegrationWorkSpace>>
         iwks;
@@ -0,0 +1,161 @@
+/*!
+ * \file   include/MGIS/Behaviour/MaterialDataManagerArena.hxx
+ * \brief  This file declares the `MaterialDataManagerArena` class which
+ * handles a set of material data managers whose arrays are carved out of a
+ * single contiguous allocation.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_BEHAVIOUR_MATERIALDATAMANAGERARENA_HXX
+#define LIB_MGIS_BEHAVIOUR_MATERIALDATAMANAGERARENA_HXX
+
+#include <memory>
+#include <vector>
+#include "MGIS/Config.hxx"
+#include "MGIS/Span.hxx"
+#include "MGIS/Allocator.hxx"
+#include "MGIS/MemoryResource.hxx"
+
+namespace mgis::behaviour {
+
+  // forward declaration
+  struct Behaviour;
+  // forward declaration
+  struct MaterialDataManager;
+
+  //! \brief options describing the arrays allocated for a material
+  struct MaterialDataManagerArenaOptions {
+    //! \brief allocate the tangent operator blocks
+    bool tangent_operator = true;
+    //! \brief allocate the speed of sound
+    bool speed_of_sound = false;
+    //! \brief allocate the integration costs
+    bool integration_costs = false;
+  };  // end of struct MaterialDataManagerArenaOptions
+
+  /*!
+   * \brief a class handling a set of material data managers whose arrays
+   * (gradients, thermodynamic forces, internal state variables, stored and
+   * dissipated energies of the states at the beginning and at the end of the
+   * time step, tangent operator blocks, speed of sound and integration
+   * costs) are carved out of a single contiguous allocation.
+   *
+   * The materials are first declared using the `addMaterial` method. The
+   * `build` method then allocates the memory and creates the material data
+   * managers. The arrays of the `i`-th material are stored contiguously,
+   * before the ones of the `i+1`-th material, each array being aligned on a
+   * cache line (64 bytes), whatever the alignment guaranteed by the memory
+   * resource.
+   *
+   * The `clear` method destroys the material data managers but keeps the
+   * memory, which is reused by the next call to `build` if it is large
+   * enough. Rebuilding a set of material data managers of similar sizes is
+   * thus cheap.
+   *
+   * \note the behaviours must outlive the arena.
+   * \note the spatially variable material properties and external state
+   * variables and the integration workspaces are not handled by the arena.
+   */
+  struct MGIS_EXPORT MaterialDataManagerArena {
+    //! \brief default constructor
+    MaterialDataManagerArena();
+    /*!
+     * \brief constructor
+     * \param[in] r: memory resource used to allocate the arena
+     */
+    MaterialDataManagerArena(mgis::MemoryResource&);
+    /*!
+     * \brief declare a new material
+     * \return the index of the material
+     * \param[in] b: behaviour
+     * \param[in] n: number of integration points
+     * \param[in] o: options
+     */
+    size_type addMaterial(const Behaviour&,
+                          const size_type,
+                          const MaterialDataManagerArenaOptions& =
+                              MaterialDataManagerArenaOptions{});
+    /*!
+     * \brief allocate the memory and create the material data managers of
+     * the declared materials. All values are set to zero, except the
+     * deformation gradients of finite strain behaviours, which are set to
+     * the identity.
+     */
+    void build();
+    //! \return if the material data managers have been built
+    bool isBuilt() const;
+    //! \return the number of materials
+    size_type getNumberOfMaterials() const;
+    /*!
+     * \return the material data manager associated with the given material
+     * \param[in] i: index of the material
+     */
+    MaterialDataManager& getMaterialDataManager(const size_type);
+    /*!
+     * \return the material data manager associated with the given material
+     * \param[in] i: index of the material
+     */
+    const MaterialDataManager& getMaterialDataManager(const size_type) const;
+    //! \return a view to the memory handled by the arena
+    mgis::span<mgis::real> getMemory();
+    /*!
+     * \brief reset the values of all the arrays handled by the arena, as done
+     * by the `build` method.
+     */
+    void reset();
+    /*!
+     * \brief destroy the material data managers and remove all the declared
+     * materials. The memory is kept to be reused by the next call to `build`.
+     */
+    void clear();
+    //! \brief release the memory handled by the arena
+    void release();
+    //! \brief destructor
+    ~MaterialDataManagerArena();
+
+   private:
+    //! \brief description of a material
+    struct MaterialDescription {
+      //! \brief behaviour
+      const Behaviour* behaviour;
+      //! \brief number of integration points
+      size_type n;
+      //! \brief options
+      MaterialDataManagerArenaOptions options;
+    };
+    //! \brief declared materials
+    std::vector<MaterialDescription> materials;
+    //! \brief material data managers
+    std::vector<std::unique_ptr<MaterialDataManager>> managers;
+    /*!
+     * \brief memory handled by the arena. This memory is slightly larger
+     * than required, so that the first array can be aligned on a cache line
+     * whatever the alignment guaranteed by the memory resource.
+     */
+    std::vector<mgis::real, mgis::Allocator<mgis::real>> memory;
+    //! \brief offset of the first array, aligned on a cache line
+    size_type memory_offset = 0;
+    //! \brief number of values used by the material data managers
+    size_type memory_size = 0;
+    //! \brief move constructor
+    MaterialDataManagerArena(MaterialDataManagerArena&&) = delete;
+    //! \brief copy constructor
+    MaterialDataManagerArena(const MaterialDataManagerArena&) = delete;
+    //! \brief move assignement
+    MaterialDataManagerArena& operator=(MaterialDataManagerArena&&) = delete;
+    //! \brief copy assignement
+    MaterialDataManagerArena& operator=(const MaterialDataManagerArena&) =
+        delete;
+  };  // end of struct MaterialDataManagerArena
+
+}  // end of namespace mgis::behaviour
+
+#endif /* LIB_MGIS_BEHAVIOUR_MATERIALDATAMANAGERARENA_HXX */
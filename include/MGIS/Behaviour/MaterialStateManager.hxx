@@ -23,6 +23,14 @@
 #include "MGIS/Span.hxx"
 #include "MGIS/StorageMode.hxx"
 #include "MGIS/StringView.hxx"
+#include "MGIS/Allocator.hxx"
+
+namespace mgis {
+
+  // forward declaration
+  struct ThreadPool;
+
+}  // namespace mgis
 
 namespace mgis::behaviour {
 
@@ -78,6 +86,28 @@ namespace mgis::behaviour {
      * energy.
      */
     mgis::span<mgis::real> dissipated_energies;
+    /*!
+     * \brief thread pool used to initialize the memory allocated internally.
+     * If not null, the values associated with the integration points of the
+     * `i`-th range of the uniform partition used by the `integrate` function
+     * are initialized by the `i`-th thread of the pool (see the
+     * `initializeValuesInParallel` function). On NUMA machines, if the
+     * threads of the pool are bound to processing units (see the
+     * `ThreadAffinityPolicy` enumeration), the memory pages are thus placed
+     * on the NUMA node of the thread which will integrate them.
+     *
+     * \note the thread pool is not stored by the material state manager.
+     */
+    mgis::ThreadPool* thread_pool = nullptr;
+    /*!
+     * \brief memory resource used to allocate the memory handled internally
+     * (see the `getMemoryResource` function to select an aligned or huge
+     * pages based memory resource). If null, the default memory resource is
+     * used.
+     *
+     * \note the memory resource must outlive the material state manager.
+     */
+    mgis::MemoryResource* memory_resource = nullptr;
   };  // end of MaterialStateManagerInitializer
 
   /*!
@@ -164,16 +194,18 @@ namespace mgis::behaviour {
     const Behaviour& b;
 
    private:
+    //! \brief a simple alias
+    using Storage = std::vector<mgis::real, mgis::Allocator<mgis::real>>;
     //! \brief value of the gradients, if hold internally
-    std::vector<mgis::real> gradients_values;
+    Storage gradients_values;
     //! \brief value of the thermodynamic forces, if hold internally
-    std::vector<mgis::real> thermodynamic_forces_values;
+    Storage thermodynamic_forces_values;
     //! \brief value of the internal state variables, if hold internally
-    std::vector<mgis::real> internal_state_variables_values;
+    Storage internal_state_variables_values;
     //! \brief value of the stored energies, if hold internally
-    std::vector<mgis::real> stored_energies_values;
+    Storage stored_energies_values;
     //! \brief value of the dissipated energies, if hold internally
-    std::vector<mgis::real> dissipated_energies_values;
+    Storage dissipated_energies_values;
     //! \brief move constructor
     MaterialStateManager(MaterialStateManager&&) = delete;
     //! \brief copy constructor
@@ -284,6 +316,238 @@ namespace mgis::behaviour {
       mgis::span<mgis::real>,
       const mgis::behaviour::MaterialStateManager&,
       const mgis::string_view);
+  /*!
+   * \brief extract the values of a gradient
+   *
+   * \param[out] o: buffer in which the values of the given gradient are
+   * stored
+   * \param[in] s: material state manager
+   * \param[in] n: name of the gradient
+   * \param[in] ordering: indices of the integration points. The `i`-th block
+   * of the output buffer is associated with the `ordering[i]`-th integration
+   * point. If empty, the integration points are treated in their natural
+   * order.
+   *
+   * \note the output buffer must be allocated properly
+   */
+  MGIS_EXPORT void extractGradient(
+      mgis::span<mgis::real>,
+      const MaterialStateManager&,
+      const mgis::string_view,
+      const mgis::span<const mgis::size_type> = {});
+  /*!
+   * \brief extract the values of a thermodynamic force
+   *
+   * \param[out] o: buffer in which the values of the given thermodynamic
+   * force are stored
+   * \param[in] s: material state manager
+   * \param[in] n: name of the thermodynamic force
+   * \param[in] ordering: indices of the integration points
+   *
+   * \note the output buffer must be allocated properly
+   */
+  MGIS_EXPORT void extractThermodynamicForce(
+      mgis::span<mgis::real>,
+      const MaterialStateManager&,
+      const mgis::string_view,
+      const mgis::span<const mgis::size_type> = {});
+  /*!
+   * \brief extract an internal state variable using a given ordering of the
+   * integration points
+   *
+   * \param[out] o: buffer in which the values of the given internal state
+   * variable is stored
+   * \param[in] s: material state manager
+   * \param[in] n: name of the internal state variables
+   * \param[in] ordering: indices of the integration points
+   *
+   * \note the output buffer must be allocated properly
+   */
+  MGIS_EXPORT void extractInternalStateVariable(
+      mgis::span<mgis::real>,
+      const MaterialStateManager&,
+      const mgis::string_view,
+      const mgis::span<const mgis::size_type>);
+  /*!
+   * \brief set the values of a gradient
+   *
+   * \param[out] s: material state manager
+   * \param[in] n: name of the gradient
+   * \param[in] v: values
+   * \param[in] ordering: indices of the integration points. The `i`-th block
+   * of the input buffer is associated with the `ordering[i]`-th integration
+   * point. If empty, the integration points are treated in their natural
+   * order.
+   */
+  MGIS_EXPORT void setGradient(MaterialStateManager&,
+                               const mgis::string_view,
+                               const mgis::span<const mgis::real>,
+                               const mgis::span<const mgis::size_type> = {});
+  /*!
+   * \brief set the values of a thermodynamic force
+   *
+   * \param[out] s: material state manager
+   * \param[in] n: name of the thermodynamic force
+   * \param[in] v: values
+   * \param[in] ordering: indices of the integration points
+   */
+  MGIS_EXPORT void setThermodynamicForce(
+      MaterialStateManager&,
+      const mgis::string_view,
+      const mgis::span<const mgis::real>,
+      const mgis::span<const mgis::size_type> = {});
+  /*!
+   * \brief set the values of an internal state variable
+   *
+   * \param[out] s: material state manager
+   * \param[in] n: name of the internal state variable
+   * \param[in] v: values
+   * \param[in] ordering: indices of the integration points
+   */
+  MGIS_EXPORT void setInternalStateVariable(
+      MaterialStateManager&,
+      const mgis::string_view,
+      const mgis::span<const mgis::real>,
+      const mgis::span<const mgis::size_type> = {});
+  /*!
+   * \brief extract the values of a gradient using a thread pool
+   *
+   * \param[in] p: thread pool
+   * \param[out] o: output buffer
+   * \param[in] s: material state manager
+   * \param[in] n: name of the gradient
+   * \param[in] ordering: indices of the integration points
+   */
+  MGIS_EXPORT void extractGradient(
+      mgis::ThreadPool&,
+      mgis::span<mgis::real>,
+      const MaterialStateManager&,
+      const mgis::string_view,
+      const mgis::span<const mgis::size_type> = {});
+  /*!
+   * \brief extract the values of a thermodynamic force using a thread pool
+   *
+   * \param[in] p: thread pool
+   * \param[out] o: output buffer
+   * \param[in] s: material state manager
+   * \param[in] n: name of the thermodynamic force
+   * \param[in] ordering: indices of the integration points
+   */
+  MGIS_EXPORT void extractThermodynamicForce(
+      mgis::ThreadPool&,
+      mgis::span<mgis::real>,
+      const MaterialStateManager&,
+      const mgis::string_view,
+      const mgis::span<const mgis::size_type> = {});
+  /*!
+   * \brief extract the values of an internal state variable using a thread
+   * pool
+   *
+   * \param[in] p: thread pool
+   * \param[out] o: output buffer
+   * \param[in] s: material state manager
+   * \param[in] n: name of the internal state variable
+   * \param[in] ordering: indices of the integration points
+   */
+  MGIS_EXPORT void extractInternalStateVariable(
+      mgis::ThreadPool&,
+      mgis::span<mgis::real>,
+      const MaterialStateManager&,
+      const mgis::string_view,
+      const mgis::span<const mgis::size_type> = {});
+  /*!
+   * \brief set the values of a gradient using a thread pool
+   *
+   * \param[in] p: thread pool
+   * \param[out] s: material state manager
+   * \param[in] n: name of the gradient
+   * \param[in] v: values
+   * \param[in] ordering: indices of the integration points
+   */
+  MGIS_EXPORT void setGradient(mgis::ThreadPool&,
+                               MaterialStateManager&,
+                               const mgis::string_view,
+                               const mgis::span<const mgis::real>,
+                               const mgis::span<const mgis::size_type> = {});
+  /*!
+   * \brief set the values of a thermodynamic force using a thread pool
+   *
+   * \param[in] p: thread pool
+   * \param[out] s: material state manager
+   * \param[in] n: name of the thermodynamic force
+   * \param[in] v: values
+   * \param[in] ordering: indices of the integration points
+   */
+  MGIS_EXPORT void setThermodynamicForce(
+      mgis::ThreadPool&,
+      MaterialStateManager&,
+      const mgis::string_view,
+      const mgis::span<const mgis::real>,
+      const mgis::span<const mgis::size_type> = {});
+  /*!
+   * \brief set the values of an internal state variable using a thread pool
+   *
+   * \param[in] p: thread pool
+   * \param[out] s: material state manager
+   * \param[in] n: name of the internal state variable
+   * \param[in] v: values
+   * \param[in] ordering: indices of the integration points
+   */
+  MGIS_EXPORT void setInternalStateVariable(
+      mgis::ThreadPool&,
+      MaterialStateManager&,
+      const mgis::string_view,
+      const mgis::span<const mgis::real>,
+      const mgis::span<const mgis::size_type> = {});
+  /*!
+   * \brief set to zero the values of an array of blocks associated with
+   * integration points. The integration points are split using the uniform
+   * partition used by the `integrate` function and the values associated
+   * with the `i`-th range are written by the `i`-th thread of the pool.
+   *
+   * Called on freshly allocated memory, this function ensures that each
+   * memory page is placed, on NUMA machines, on the node of the thread that
+   * will process it (first-touch policy).
+   *
+   * \param[in] p: thread pool
+   * \param[out] v: values
+   * \param[in] n: number of integration points
+   *
+   * \note if called from one of the threads of the pool, the values are set
+   * to zero by the calling thread.
+   */
+  MGIS_EXPORT void initializeValuesInParallel(mgis::ThreadPool&,
+                                              mgis::span<mgis::real>,
+                                              const size_type);
+  /*!
+   * \brief set the given values stored in single precision to zero in
+   * parallel (see the previous overload)
+   * \param[in] p: thread pool
+   * \param[out] v: values
+   * \param[in] n: number of integration points
+   */
+  MGIS_EXPORT void initializeValuesInParallel(mgis::ThreadPool&,
+                                              mgis::span<float>,
+                                              const size_type);
+
+  namespace internals {
+
+    /*!
+     * \return the given offset rounded up to a cache line boundary
+     * \param[in] o: offset, in number of reals
+     *
+     * \note this function is used to lay out the arrays of material data
+     * managers in a single block of memory.
+     */
+    MGIS_EXPORT size_type alignOffsetOnCacheLine(const size_type);
+    /*!
+     * \brief set the deformation gradients to the identity for finite
+     * strain behaviours. Nothing is done for other behaviours.
+     * \param[in,out] s: state manager
+     */
+    MGIS_EXPORT void initializeDeformationGradients(MaterialStateManager&);
+
+  }  // end of namespace internals
 
 }  // end of namespace mgis::behaviour
 
@@ -0,0 +1,80 @@
+/*!
+ * \file   include/MGIS/Behaviour/Reordering.hxx
+ * \brief  This file declares functions to reorder the integration points
+ * handled by a `MaterialDataManager` to improve data locality.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_BEHAVIOUR_REORDERING_HXX
+#define LIB_MGIS_BEHAVIOUR_REORDERING_HXX
+
+#include <vector>
+#include "MGIS/Config.hxx"
+#include "MGIS/Span.hxx"
+
+namespace mgis::behaviour {
+
+  // forward declaration
+  struct MaterialDataManager;
+
+  /*!
+   * \return a permutation sorting the given points along a Morton (Z-order)
+   * curve. The `k`-th point in the new order is the `p[k]`-th point in the
+   * original order.
+   * \param[in] coordinates: coordinates of the points, stored contiguously
+   * \param[in] d: space dimension (1, 2 or 3)
+   */
+  MGIS_EXPORT std::vector<size_type> getMortonOrdering(mgis::span<const real>,
+                                                       const size_type);
+  /*!
+   * \return a permutation sorting the given points along a Hilbert curve.
+   * The `k`-th point in the new order is the `p[k]`-th point in the original
+   * order.
+   * \param[in] coordinates: coordinates of the points, stored contiguously
+   * \param[in] d: space dimension (1, 2 or 3)
+   */
+  MGIS_EXPORT std::vector<size_type> getHilbertOrdering(mgis::span<const real>,
+                                                        const size_type);
+  /*!
+   * \return the inverse of the given permutation
+   * \param[in] p: permutation
+   */
+  MGIS_EXPORT std::vector<size_type> getInversePermutation(
+      mgis::span<const size_type>);
+  /*!
+   * \brief physically reorder the integration points of the given material
+   * data manager. After this call, the `k`-th integration point is the
+   * `p[k]`-th integration point before the call.
+   *
+   * The following arrays are reordered: the gradients, the thermodynamic
+   * forces, the internal state variables, the stored and dissipated energies
+   * and the spatially variable material properties and external state
+   * variables of the states at the beginning and at the end of the time
+   * step, the tangent operator blocks, the speed of sound and the integration
+   * costs.
+   *
+   * The inverse permutation, i.e. the new index of each integration point,
+   * is the ordering to be passed to functions such as `setGradient` or
+   * `extractInternalStateVariable` to scatter (gather) values from (to)
+   * buffers using the original numbering of the integration points.
+   *
+   * \param[in,out] m: material data manager
+   * \param[in] p: permutation
+   *
+   * \note the arrays stored in externally allocated memory are reordered in
+   * place.
+   */
+  MGIS_EXPORT void reorderIntegrationPoints(MaterialDataManager&,
+                                            mgis::span<const size_type>);
+
+}  // end of namespace mgis::behaviour
+
+#endif /* LIB_MGIS_BEHAVIOUR_REORDERING_HXX */
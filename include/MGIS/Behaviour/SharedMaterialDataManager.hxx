@@ -0,0 +1,175 @@
+/*!
+ * \file   include/MGIS/Behaviour/SharedMaterialDataManager.hxx
+ * \brief  This file declares the `SharedMaterialDataManager` class, which
+ * stores the arrays of a material data manager in a named shared memory
+ * segment.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_BEHAVIOUR_SHAREDMATERIALDATAMANAGER_HXX
+#define LIB_MGIS_BEHAVIOUR_SHAREDMATERIALDATAMANAGER_HXX
+
+#include <memory>
+#include <string>
+#include <cstddef>
+#include "MGIS/Config.hxx"
+
+namespace mgis::behaviour {
+
+  // forward declaration
+  struct Behaviour;
+  // forward declaration
+  struct MaterialDataManager;
+
+  //! \brief options describing the arrays stored in a shared memory segment
+  struct SharedMaterialDataManagerOptions {
+    //! \brief store the tangent operator blocks
+    bool tangent_operator = true;
+    //! \brief store the speed of sound
+    bool speed_of_sound = false;
+    //! \brief store the integration costs
+    bool integration_costs = false;
+    /*!
+     * \brief store the values of the scalar material properties at each
+     * integration point
+     */
+    bool material_properties = true;
+    /*!
+     * \brief store the values of the external state variables at each
+     * integration point
+     */
+    bool external_state_variables = true;
+  };  // end of struct SharedMaterialDataManagerOptions
+
+  /*!
+   * \brief a class handling a material data manager whose arrays are stored
+   * in a named `POSIX` shared memory segment (see `shm_open`).
+   *
+   * A first process creates the segment by giving the behaviour, the number
+   * of integration points and the name of the segment. Other processes
+   * attach to the segment using its name, either to all the integration
+   * points or to a range of integration points. The material data managers
+   * of those processes share the gradients, the thermodynamic forces, the
+   * internal state variables, the stored and dissipated energies of the
+   * states at the beginning and at the end of the time step, the tangent
+   * operator blocks, the speed of sound, the integration costs and, if
+   * requested, the values of the material properties and of the external
+   * state variables, which are declared with an external storage. Processes
+   * working on disjoint ranges of integration points may thus integrate the
+   * behaviour concurrently, without any copy or serialization.
+   *
+   * The values of the material properties and of the external state
+   * variables may still be set to uniform values: in this case, those values
+   * are not shared. The time step increase factor (`rdt`) is not shared.
+   *
+   * The segment is removed from the system when the object that created it
+   * is destroyed. Processes already attached to the segment can still use
+   * it.
+   *
+   * \note shared memory segments are only supported on `Linux`.
+   * \note the behaviour must outlive the object.
+   */
+  struct MGIS_EXPORT SharedMaterialDataManager {
+    /*!
+     * \brief create a new shared memory segment. All values are set to zero,
+     * except the deformation gradients of finite strain behaviours, which
+     * are set to the identity.
+     * \param[in] b: behaviour
+     * \param[in] n: number of integration points
+     * \param[in] name: name of the segment
+     * \param[in] o: options
+     */
+    SharedMaterialDataManager(const Behaviour&,
+                              const size_type,
+                              const std::string&,
+                              const SharedMaterialDataManagerOptions& =
+                                  SharedMaterialDataManagerOptions{});
+    /*!
+     * \brief attach to all the integration points of an existing shared
+     * memory segment
+     * \param[in] b: behaviour
+     * \param[in] name: name of the segment
+     */
+    SharedMaterialDataManager(const Behaviour&, const std::string&);
+    /*!
+     * \brief attach to a range of integration points of an existing shared
+     * memory segment. The `i`-th integration point of the material data
+     * manager is the `ib + i`-th integration point of the segment.
+     * \param[in] b: behaviour
+     * \param[in] name: name of the segment
+     * \param[in] ib: first integration point of the range
+     * \param[in] ie: integration point past the last one of the range
+     */
+    SharedMaterialDataManager(const Behaviour&,
+                              const std::string&,
+                              const size_type,
+                              const size_type);
+    //! \return the material data manager
+    MaterialDataManager& getMaterialDataManager();
+    //! \return the material data manager
+    const MaterialDataManager& getMaterialDataManager() const;
+    //! \return the name of the segment
+    const std::string& getName() const;
+    //! \return the number of integration points stored in the segment
+    size_type getNumberOfIntegrationPoints() const;
+    /*!
+     * \return the index, in the segment, of the first integration point of
+     * the material data manager
+     */
+    size_type getOffset() const;
+    //! \return if this object created the segment
+    bool isOwner() const;
+    //! \brief destructor
+    ~SharedMaterialDataManager();
+
+   private:
+    /*!
+     * \brief create the material data manager
+     * \param[in] b: behaviour
+     * \param[in] o: options
+     * \param[in] ib: first integration point of the range
+     * \param[in] ie: integration point past the last one of the range
+     */
+    void build(const Behaviour&,
+               const SharedMaterialDataManagerOptions&,
+               const size_type,
+               const size_type);
+    //! \brief unmap the segment and remove it if this object created it
+    void release() noexcept;
+    //! \brief name of the segment
+    std::string name;
+    //! \brief address of the mapping
+    void* address = nullptr;
+    //! \brief size of the mapping, in bytes
+    std::size_t size = 0;
+    //! \brief number of integration points stored in the segment
+    size_type n = 0;
+    //! \brief index of the first integration point of the material data
+    //! manager
+    size_type offset = 0;
+    //! \brief if true, this object created the segment
+    bool owner = false;
+    //! \brief material data manager
+    std::unique_ptr<MaterialDataManager> manager;
+    //! \brief move constructor
+    SharedMaterialDataManager(SharedMaterialDataManager&&) = delete;
+    //! \brief copy constructor
+    SharedMaterialDataManager(const SharedMaterialDataManager&) = delete;
+    //! \brief move assignement
+    SharedMaterialDataManager& operator=(SharedMaterialDataManager&&) = delete;
+    //! \brief copy assignement
+    SharedMaterialDataManager& operator=(const SharedMaterialDataManager&) =
+        delete;
+  };  // end of struct SharedMaterialDataManager
+
+}  // end of namespace mgis::behaviour
+
+#endif /* LIB_MGIS_BEHAVIOUR_SHAREDMATERIALDATAMANAGER_HXX */
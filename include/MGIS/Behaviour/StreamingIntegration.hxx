@@ -0,0 +1,88 @@
+/*!
+ * \file   include/MGIS/Behaviour/StreamingIntegration.hxx
+ * \brief  This file declares a variant of the `integrate` function
+ * processing the integration points by windows, which is meant to be used
+ * when the data of the material data manager do not fit in memory.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_BEHAVIOUR_STREAMINGINTEGRATION_HXX
+#define LIB_MGIS_BEHAVIOUR_STREAMINGINTEGRATION_HXX
+
+#include "MGIS/Config.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+namespace mgis::behaviour {
+
+  //! \brief options of the `integrateByWindows` function
+  struct StreamingIntegrationOptions {
+    /*!
+     * \brief number of integration points treated by a window. If null, the
+     * number of integration points is chosen so that the data associated
+     * with a window occupy about 64 MB.
+     */
+    size_type window_size = 0;
+    /*!
+     * \brief if true, the operating system is asked to read the data of the
+     * next window in advance (`madvise(MADV_WILLNEED)`) while the current
+     * window is treated.
+     */
+    bool prefetch = true;
+    /*!
+     * \brief if true, the operating system is asked to write back and
+     * reclaim the pages of a window once this window is treated
+     * (`madvise(MADV_PAGEOUT)`). This option is meant for file-backed
+     * memory (see the `FileBackedMemoryResource` class): for memory
+     * allocated by other memory resources, it would push the data to the
+     * swap.
+     */
+    bool writeback = false;
+    /*!
+     * \brief thread pool used to treat the integration points of a window.
+     * If null, the integration points are treated by the calling thread.
+     */
+    mgis::ThreadPool* thread_pool = nullptr;
+  };  // end of struct StreamingIntegrationOptions
+
+  /*!
+   * \brief integrate the behaviour over all integration points, window by
+   * window.
+   *
+   * This function is meant to be used with material data managers whose
+   * arrays are stored in memory-mapped files (see the
+   * `FileBackedMemoryResource` class and the `memory_resource` member of the
+   * `MaterialDataManagerInitializer` structure). The data of the next window
+   * are prefetched while the current window is treated and, if requested,
+   * the pages of a window are written back once the window is treated, so
+   * that the memory used is bounded by a few windows.
+   *
+   * \return the result of the behaviour integration, the `results` member
+   * holding the results of each window.
+   * \param[in,out] m: material data manager
+   * \param[in] opts: integration options
+   * \param[in] dt: time step
+   * \param[in] sopts: streaming options
+   *
+   * \note the integration is stopped after the first window in which the
+   * integration failed.
+   * \note if required, the memory associated with the tangent operator blocks
+   * is automatically allocated.
+   * \note the memory advices are only given on `Linux`.
+   */
+  MGIS_EXPORT MultiThreadedBehaviourIntegrationResult
+  integrateByWindows(MaterialDataManager&,
+                     const BehaviourIntegrationOptions&,
+                     const real,
+                     const StreamingIntegrationOptions& = {});
+
+}  // end of namespace mgis::behaviour
+
+#endif /* LIB_MGIS_BEHAVIOUR_STREAMINGINTEGRATION_HXX */
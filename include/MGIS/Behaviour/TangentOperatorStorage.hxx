@@ -0,0 +1,110 @@
+/*!
+ * \file   include/MGIS/Behaviour/TangentOperatorStorage.hxx
+ * \brief  This file declares the `TangentOperatorStorage` structure, which
+ * describes how the tangent operator blocks are stored by a material data
+ * manager, and functions to access those blocks.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_BEHAVIOUR_TANGENTOPERATORSTORAGE_HXX
+#define LIB_MGIS_BEHAVIOUR_TANGENTOPERATORSTORAGE_HXX
+
+#include "MGIS/Config.hxx"
+#include "MGIS/Span.hxx"
+
+namespace mgis::behaviour {
+
+  // forward declaration
+  struct Behaviour;
+  // forward declaration
+  struct MaterialDataManager;
+
+  /*!
+   * \brief description of the storage of the tangent operator blocks by a
+   * material data manager.
+   *
+   * By default, the tangent operator blocks are stored as dense row-major
+   * matrices in double precision, as computed by the behaviour. Compact
+   * storages reduce the memory footprint and the memory traffic associated
+   * with the tangent operator:
+   *
+   * - if `packed_symmetric` is true, only the upper triangular part
+   *   (including the diagonal) of the square blocks is stored, row by row.
+   *   For example, a \f$6\times 6\f$ block is stored using \f$21\f$ values
+   *   rather than \f$36\f$. Non square blocks are stored as dense matrices.
+   *   This option shall only be used for behaviours whose square tangent
+   *   operator blocks are symmetric.
+   * - if `single_precision` is true, the values are stored as `float`s.
+   *
+   * With a compact storage, the behaviour computes dense blocks in a
+   * temporary buffer which are converted to the compact storage in the
+   * integration loop.
+   */
+  struct TangentOperatorStorage {
+    //! \brief only store the upper triangular part of the square blocks
+    bool packed_symmetric = false;
+    //! \brief store the values in single precision
+    bool single_precision = false;
+  };  // end of struct TangentOperatorStorage
+
+  //! \return if the given storage differs from the dense storage
+  MGIS_EXPORT bool requiresConversion(const TangentOperatorStorage&);
+  /*!
+   * \return the number of values stored per integration point for the
+   * tangent operator blocks
+   * \param[in] b: behaviour
+   * \param[in] s: storage
+   */
+  MGIS_EXPORT size_type
+  getTangentOperatorArraySize(const Behaviour&, const TangentOperatorStorage&);
+  /*!
+   * \brief store the given dense tangent operator blocks at the given
+   * integration point, using the storage of the material data manager.
+   * \param[in,out] m: material data manager
+   * \param[in] i: integration point
+   * \param[in] K: dense tangent operator blocks
+   */
+  MGIS_EXPORT void setTangentOperatorBlocks(MaterialDataManager&,
+                                            const size_type,
+                                            mgis::span<const real>);
+  /*!
+   * \brief retrieve the dense tangent operator blocks of the given
+   * integration point
+   * \param[out] K: dense tangent operator blocks
+   * \param[in] m: material data manager
+   * \param[in] i: integration point
+   */
+  MGIS_EXPORT void getTangentOperatorBlocks(mgis::span<real>,
+                                            const MaterialDataManager&,
+                                            const size_type);
+  /*!
+   * \brief retrieve the dense tangent operator blocks of all the integration
+   * points
+   * \param[out] K: dense tangent operator blocks
+   * \param[in] m: material data manager
+   */
+  MGIS_EXPORT void getTangentOperatorBlocks(mgis::span<real>,
+                                            const MaterialDataManager&);
+  /*!
+   * \brief rotate the tangent operator blocks stored by the material data
+   * manager from the material frame to the global frame, whatever their
+   * storage.
+   * \param[in,out] m: material data manager
+   * \param[in] r: rotation matrix from the global frame to the material
+   * frame (an array of size 9 or 9*n where n is the number of integration
+   * points).
+   */
+  MGIS_EXPORT void rotateTangentOperatorBlocks(MaterialDataManager&,
+                                               const mgis::span<const real>&);
+
+}  // end of namespace mgis::behaviour
+
+#endif /* LIB_MGIS_BEHAVIOUR_TANGENTOPERATORSTORAGE_HXX */
@@ -0,0 +1,162 @@
+/*!
+ * \file   include/MGIS/EventRecorder.hxx
+ * \brief   This file declares the `EventRecorder` class which can be used to
+ * record the timeline of the tasks executed by a thread pool.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_EVENTRECORDER_HXX
+#define LIB_MGIS_EVENTRECORDER_HXX
+
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <iosfwd>
+#include <cstdint>
+#include "MGIS/Config.hxx"
+
+namespace mgis {
+
+  /*!
+   * \brief a structure recording timestamped events in per-thread ring
+   * buffers.
+   *
+   * Each thread writes in its own buffer, so that recording an event does
+   * not require any lock once the buffer of the thread has been allocated.
+   * If a buffer is full, the oldest events are overwritten.
+   *
+   * \note the events must be retrieved (see `getEvents`) or cleared when no
+   * thread is recording events.
+   */
+  struct MGIS_EXPORT EventRecorder {
+    //! \brief type of an event
+    enum EventType {
+      TASK_ENQUEUE,
+      TASK_BEGIN,
+      TASK_END,
+      REGION_BEGIN,
+      REGION_END
+    };  // end of enum EventType
+    //! \brief an event
+    struct Event {
+      //! \brief type of the event
+      EventType type;
+      /*!
+       * \brief name of the event. This name must be a string with static
+       * storage duration.
+       */
+      const char* name;
+      //! \brief identifier of the task associated with the event, if any
+      std::uint64_t id;
+      //! \brief time, in nanoseconds since the creation of the recorder
+      std::int64_t time;
+    };  // end of struct Event
+    //! \brief events recorded by a thread
+    struct ThreadEvents {
+      //! \brief index of the thread, in order of first record
+      size_type thread;
+      //! \brief events, in chronological order
+      std::vector<Event> events;
+      //! \brief number of events overwritten
+      size_type lost;
+    };  // end of struct ThreadEvents
+    /*!
+     * \brief constructor
+     * \param[in] n: capacity of the buffer of each thread
+     */
+    EventRecorder(const size_type = 65536);
+    /*!
+     * \brief record a new event
+     * \param[in] t: type of the event
+     * \param[in] n: name of the event
+     * \param[in] i: identifier of the task, if any
+     */
+    void record(const EventType, const char* const, const std::uint64_t = 0);
+    //! \return a new task identifier
+    std::uint64_t getNewTaskIdentifier();
+    //! \return the events recorded by all threads
+    std::vector<ThreadEvents> getEvents() const;
+    //! \brief remove all the recorded events
+    void clear();
+    //! \brief destructor
+    ~EventRecorder();
+
+   private:
+    //! \brief ring buffer associated with a thread
+    struct Buffer;
+    //! \return the buffer associated with the calling thread
+    Buffer& getBuffer();
+    EventRecorder(EventRecorder&&) = delete;
+    EventRecorder(const EventRecorder&) = delete;
+    EventRecorder& operator=(EventRecorder&&) = delete;
+    EventRecorder& operator=(const EventRecorder&) = delete;
+    //! \brief buffers of the threads
+    std::vector<std::unique_ptr<Buffer>> buffers;
+    //! \brief mutex protecting the list of buffers
+    mutable std::mutex m;
+    //! \brief creation time of the recorder
+    const std::chrono::steady_clock::time_point start;
+    //! \brief unique identifier of the recorder
+    const std::uint64_t identifier;
+    //! \brief capacity of the buffers
+    const size_type capacity;
+    //! \brief counter used to generate task identifiers
+    std::atomic<std::uint64_t> tasks_counter;
+  };  // end of struct EventRecorder
+
+  /*!
+   * \brief set the event recorder used by the calling thread to record named
+   * regions. The threads of a thread pool to which an event recorder is
+   * attached automatically use this recorder while executing a task.
+   * \param[in] r: recorder. May be null.
+   */
+  MGIS_EXPORT void setThreadEventRecorder(EventRecorder* const);
+  //! \return the event recorder used by the calling thread, if any
+  MGIS_EXPORT EventRecorder* getThreadEventRecorder();
+
+  /*!
+   * \brief a scoped object recording the beginning and the end of a named
+   * region using the event recorder of the calling thread, if any.
+   */
+  struct MGIS_EXPORT EventRegion {
+    /*!
+     * \brief constructor
+     * \param[in] n: name of the region. This name must be a string with
+     * static storage duration.
+     */
+    EventRegion(const char* const);
+    //! \brief destructor
+    ~EventRegion();
+
+   private:
+    EventRegion(EventRegion&&) = delete;
+    EventRegion(const EventRegion&) = delete;
+    EventRegion& operator=(EventRegion&&) = delete;
+    EventRegion& operator=(const EventRegion&) = delete;
+    //! \brief recorder
+    EventRecorder* const recorder;
+    //! \brief name of the region
+    const char* const name;
+  };  // end of struct EventRegion
+
+  /*!
+   * \brief print the events recorded using the `JSON` trace event format
+   * used by `Chrome` (`chrome://tracing`) and `Perfetto`.
+   * \param[in] os: output stream
+   * \param[in] r: recorder
+   */
+  MGIS_EXPORT void print_chrome_trace(std::ostream&, const EventRecorder&);
+
+}  // end of namespace mgis
+
+#endif /* LIB_MGIS_EVENTRECORDER_HXX */
@@ -0,0 +1,175 @@
+/*!
+ * \file   Executor.hxx
+ * \brief  This file declares the `Executor` class, an abstraction of the
+ * parallel runtime used to split a work over a set of chunks, and its
+ * adapters.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_EXECUTOR_HXX
+#define LIB_MGIS_EXECUTOR_HXX
+
+#include <vector>
+#include <functional>
+#include <type_traits>
+#include "MGIS/Config.hxx"
+#include "MGIS/Partition.hxx"
+#include "MGIS/ThreadedTaskResult.hxx"
+
+namespace mgis {
+
+  // forward declaration
+  struct ThreadPool;
+
+  /*!
+   * \brief an abstract class describing a parallel runtime able to execute
+   * a given number of independent chunks of work.
+   */
+  struct MGIS_EXPORT Executor {
+    //! \return the number of chunks in which a work shall be split
+    virtual size_type getNumberOfChunks() const = 0;
+    /*!
+     * \brief execute the given function for each chunk index in the range
+     * `[0, n)` and return when all the chunks have been treated.
+     * \param[in] n: number of chunks
+     * \param[in] f: function called for each chunk
+     * \note the function `f` does not throw.
+     */
+    virtual void execute(const size_type,
+                         const std::function<void(size_type)>&) = 0;
+    //! \brief destructor
+    virtual ~Executor();
+  };  // end of struct Executor
+
+  //! \brief an executor relying on a thread pool
+  struct MGIS_EXPORT ThreadPoolExecutor final : Executor {
+    /*!
+     * \brief constructor
+     * \param[in] p: thread pool
+     */
+    ThreadPoolExecutor(ThreadPool&);
+    size_type getNumberOfChunks() const override;
+    void execute(const size_type,
+                 const std::function<void(size_type)>&) override;
+    //! \brief destructor
+    ~ThreadPoolExecutor() override;
+
+   private:
+    //! \brief underlying thread pool
+    ThreadPool& pool;
+  };  // end of struct ThreadPoolExecutor
+
+  /*!
+   * \brief an executor relying on the `OpenMP` runtime of the caller.
+   *
+   * If called outside a parallel region, the chunks are treated in a
+   * new parallel region. If called inside a parallel region (typically by
+   * one thread in a `single` construct), the chunks are treated as tasks
+   * executed by the threads of the current team.
+   *
+   * \note this executor is only available if `MGIS` has been compiled with
+   * the `enable-openmp-executor` option. Otherwise, the constructor throws.
+   */
+  struct MGIS_EXPORT OpenMPExecutor final : Executor {
+    //! \return if the `OpenMP` executor is available
+    static bool isAvailable();
+    /*!
+     * \brief constructor
+     * \param[in] n: number of chunks. If null, the maximum number of
+     * threads returned by `omp_get_max_threads` is used.
+     */
+    OpenMPExecutor(const size_type = 0);
+    size_type getNumberOfChunks() const override;
+    void execute(const size_type,
+                 const std::function<void(size_type)>&) override;
+    //! \brief destructor
+    ~OpenMPExecutor() override;
+
+   private:
+    //! \brief number of chunks
+    size_type nchunks;
+  };  // end of struct OpenMPExecutor
+
+  /*!
+   * \brief a function treating one chunk.
+   * \param[in] ctx: opaque context given to the callback
+   * \param[in] i: chunk index
+   */
+  using ExecutorChunkFunction = void (*)(void*, size_type);
+  /*!
+   * \brief a callback which must call `f(ctx, i)` for each `i` in `[0, n)`,
+   * possibly in parallel, and return when all chunks have been treated.
+   * \param[in] data: user data given to the `CallbackExecutor`
+   * \param[in] n: number of chunks
+   * \param[in] f: function treating one chunk
+   * \param[in] ctx: opaque context to be passed to `f`
+   */
+  using ExecutorCallback =
+      void (*)(void*, size_type, ExecutorChunkFunction, void*);
+
+  //! \brief an executor relying on a callback provided by the caller
+  struct MGIS_EXPORT CallbackExecutor final : Executor {
+    /*!
+     * \brief constructor
+     * \param[in] c: callback
+     * \param[in] d: user data passed to the callback
+     * \param[in] n: number of chunks
+     */
+    CallbackExecutor(ExecutorCallback, void* const, const size_type);
+    size_type getNumberOfChunks() const override;
+    void execute(const size_type,
+                 const std::function<void(size_type)>&) override;
+    //! \brief destructor
+    ~CallbackExecutor() override;
+
+   private:
+    //! \brief callback
+    ExecutorCallback callback;
+    //! \brief user data
+    void* data;
+    //! \brief number of chunks
+    size_type nchunks;
+  };  // end of struct CallbackExecutor
+
+  /*!
+   * \brief split the range `[0, n)` in at most `e.getNumberOfChunks()`
+   * contiguous sub-ranges and call `f(b, e)` on each of them using the given
+   * executor.
+   * \return the results of each call. The exceptions thrown by `f` are
+   * stored in the results.
+   * \param[in] e: executor
+   * \param[in] n: size of the range
+   * \param[in] f: function
+   */
+  template <typename F>
+  std::vector<
+      ThreadedTaskResult<std::invoke_result_t<F, size_type, size_type>>>
+  executeOverRange(Executor&, const size_type, const F&);
+  /*!
+   * \brief call `f(bounds[i], bounds[i + 1])` for each sub-range defined by
+   * the given bounds using the given executor.
+   * \return the results of each call. The exceptions thrown by `f` are
+   * stored in the results.
+   * \param[in] e: executor
+   * \param[in] bounds: bounds of the sub-ranges (see `getUniformPartition` and
+   * `getBalancedPartition`)
+   * \param[in] f: function
+   */
+  template <typename F>
+  std::vector<
+      ThreadedTaskResult<std::invoke_result_t<F, size_type, size_type>>>
+  executeOverRanges(Executor&, const std::vector<size_type>&, const F&);
+
+}  // end of namespace mgis
+
+#include "MGIS/Executor.ixx"
+
+#endif /* LIB_MGIS_EXECUTOR_HXX */
@@ -0,0 +1,65 @@
+/*!
+ * \file   Executor.ixx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_EXECUTOR_IXX
+#define LIB_MGIS_EXECUTOR_IXX
+
+#include <algorithm>
+#include <exception>
+
+namespace mgis {
+
+  template <typename F>
+  std::vector<
+      ThreadedTaskResult<std::invoke_result_t<F, size_type, size_type>>>
+  executeOverRange(Executor& e, const size_type n, const F& f) {
+    const auto nchunks = std::min(e.getNumberOfChunks(), n);
+    if (nchunks == 0) {
+      using result_type = std::invoke_result_t<F, size_type, size_type>;
+      return std::vector<ThreadedTaskResult<result_type>>{};
+    }
+    return executeOverRanges(e, getUniformPartition(n, nchunks), f);
+  }  // end of executeOverRange
+
+  template <typename F>
+  std::vector<
+      ThreadedTaskResult<std::invoke_result_t<F, size_type, size_type>>>
+  executeOverRanges(Executor& e,
+                    const std::vector<size_type>& bounds,
+                    const F& f) {
+    using result_type = std::invoke_result_t<F, size_type, size_type>;
+    const auto nchunks = bounds.empty() ? size_type{} : bounds.size() - 1;
+    auto results = std::vector<ThreadedTaskResult<result_type>>(nchunks);
+    if (nchunks == 0) {
+      return results;
+    }
+    e.execute(nchunks, [&results, &bounds, &f](const size_type i) {
+      const auto b = bounds[i];
+      const auto ie = bounds[i + 1];
+      try {
+        if constexpr (std::is_void_v<result_type>) {
+          f(b, ie);
+        } else {
+          results[i] = f(b, ie);
+        }
+      } catch (...) {
+        results[i].setException(std::current_exception());
+      }
+    });
+    return results;
+  }  // end of executeOverRanges
+
+}  // end of namespace mgis
+
+#endif /* LIB_MGIS_EXECUTOR_IXX */
@@ -0,0 +1,128 @@
+/*!
+ * \file   include/MGIS/MemoryResource.hxx
+ * \brief  This file declares the `MemoryResource` class and the memory
+ * resources provided by `MGIS`.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_MEMORYRESOURCE_HXX
+#define LIB_MGIS_MEMORYRESOURCE_HXX
+
+#include <string>
+#include <cstddef>
+#include "MGIS/Config.hxx"
+
+namespace mgis {
+
+  /*!
+   * \brief an abstract class in charge of allocating raw memory.
+   *
+   * Memory resources are used by the `Allocator` class to allocate the
+   * arrays of the `MaterialStateManager` and `MaterialDataManager` classes.
+   * Users may provide their own memory resources, which must outlive all the
+   * objects using them.
+   */
+  struct MGIS_EXPORT MemoryResource {
+    /*!
+     * \return a pointer to a memory block of at least the given size
+     * \param[in] s: size in bytes
+     * \param[in] a: minimal alignment
+     */
+    virtual void* allocate(const std::size_t, const std::size_t) = 0;
+    /*!
+     * \brief release a memory block previously returned by `allocate`
+     * \param[in] p: pointer to the memory block
+     * \param[in] s: size in bytes
+     * \param[in] a: minimal alignment
+     */
+    virtual void deallocate(void* const,
+                            const std::size_t,
+                            const std::size_t) noexcept = 0;
+    //! \brief destructor
+    virtual ~MemoryResource();
+  };  // end of struct MemoryResource
+
+  //! \brief policies of the memory resources provided by `MGIS`
+  enum struct AllocationPolicy {
+    //! \brief memory is allocated using the global `operator new`
+    DEFAULT,
+    //! \brief memory blocks are aligned on cache lines (64 bytes)
+    ALIGNED,
+    /*!
+     * \brief large memory blocks are aligned on 2MB boundaries and backed by
+     * transparent huge pages when available (`madvise(MADV_HUGEPAGE)`).
+     * Small memory blocks are aligned on cache lines.
+     */
+    TRANSPARENT_HUGE_PAGES,
+    /*!
+     * \brief large memory blocks are allocated from the pool of explicit huge
+     * pages of the system (`mmap(MAP_HUGETLB)`). If the pool is exhausted,
+     * the `TRANSPARENT_HUGE_PAGES` policy is used.
+     */
+    HUGETLB
+  };  // end of enum struct AllocationPolicy
+
+  /*!
+   * \return the memory resource associated with the given policy
+   * \param[in] p: allocation policy
+   *
+   * \note huge pages are only supported on `Linux`. On other systems, the
+   * `TRANSPARENT_HUGE_PAGES` and `HUGETLB` policies are equivalent to the
+   * `ALIGNED` policy.
+   */
+  MGIS_EXPORT MemoryResource& getMemoryResource(const AllocationPolicy);
+  //! \return the default memory resource
+  MGIS_EXPORT MemoryResource& getDefaultMemoryResource();
+
+  /*!
+   * \brief a memory resource backing large memory blocks by temporary files
+   * mapped in memory (`mmap(MAP_SHARED)`). This memory resource allows to
+   * handle more data than the available physical memory: the operating
+   * system writes the modified pages to the files and reads them back on
+   * demand.
+   *
+   * Each large memory block is associated with a file created in the given
+   * directory. This file is removed from the directory as soon as it is
+   * mapped, so that it is automatically deleted when the memory block is
+   * released or when the process ends. Small memory blocks are allocated
+   * in memory.
+   *
+   * \note file-backed memory is only supported on `Linux`. On other systems,
+   * all memory blocks are allocated in memory.
+   */
+  struct MGIS_EXPORT FileBackedMemoryResource final : MemoryResource {
+    /*!
+     * \brief constructor
+     * \param[in] d: directory in which the files are created
+     * \param[in] s: minimal size, in bytes, of the memory blocks backed by a
+     * file
+     */
+    FileBackedMemoryResource(const std::string&,
+                             const std::size_t = std::size_t{1} << 20);
+    void* allocate(const std::size_t, const std::size_t) override;
+    void deallocate(void* const,
+                    const std::size_t,
+                    const std::size_t) noexcept override;
+    //! \brief destructor
+    ~FileBackedMemoryResource() override;
+
+   private:
+    //! \return if the given memory block is backed by a file
+    bool isFileBacked(const std::size_t, const std::size_t) const;
+    //! \brief directory in which the files are created
+    const std::string directory;
+    //! \brief minimal size of the memory blocks backed by a file
+    const std::size_t minimal_size;
+  };  // end of struct FileBackedMemoryResource
+
+}  // end of namespace mgis
+
+#endif /* LIB_MGIS_MEMORYRESOURCE_HXX */
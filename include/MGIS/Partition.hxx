@@ -0,0 +1,51 @@
+/*!
+ * \file   include/MGIS/Partition.hxx
+ * \brief   This file declares functions splitting a range of integration
+ * points in contiguous sub-ranges.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_PARTITION_HXX
+#define LIB_MGIS_PARTITION_HXX
+
+#include <vector>
+#include "MGIS/Config.hxx"
+#include "MGIS/Span.hxx"
+
+namespace mgis {
+
+  /*!
+   * \brief split the range `[0, n)` in `nchunks` contiguous sub-ranges whose
+   * sizes differ by at most one.
+   * \return the bounds of the sub-ranges: the `i`-th sub-range is
+   * `[bounds[i], bounds[i + 1])`.
+   * \param[in] n: size of the range
+   * \param[in] nchunks: number of sub-ranges
+   */
+  MGIS_EXPORT std::vector<size_type> getUniformPartition(const size_type,
+                                                         const size_type);
+  /*!
+   * \brief split the range `[0, costs.size())` in `nchunks` contiguous
+   * sub-ranges with approximately equal total costs, using the prefix sum of
+   * the costs. Each element is assigned to the sub-range containing the
+   * middle of its cost. Negative costs are treated as null costs. If the
+   * total cost is null, a uniform partition is returned.
+   * \return the bounds of the sub-ranges: the `i`-th sub-range is
+   * `[bounds[i], bounds[i + 1])`.
+   * \param[in] costs: cost of each element
+   * \param[in] nchunks: number of sub-ranges
+   */
+  MGIS_EXPORT std::vector<size_type> getBalancedPartition(
+      mgis::span<const real>, const size_type);
+
+}  // end of namespace mgis
+
+#endif /* LIB_MGIS_PARTITION_HXX */
@@ -0,0 +1,214 @@
+/*!
+ * \file   include/MGIS/Profiling.hxx
+ * \brief   This file declares the profiling layer used to measure the time
+ * spent in the main kernels of MGIS.
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#ifndef LIB_MGIS_PROFILING_HXX
+#define LIB_MGIS_PROFILING_HXX
+
+#include <array>
+#include <chrono>
+#include <vector>
+#include <iosfwd>
+#include <string_view>
+#include "MGIS/Config.hxx"
+
+namespace mgis::profiling {
+
+  //! \brief list of the instrumented regions
+  enum struct Region {
+    //! \brief integration of the behaviour over a range of integration points
+    INTEGRATE,
+    //! \brief execution of a post-processing over a range of integration points
+    POST_PROCESSING,
+    //! \brief execution of an initialize function over a range of integration
+    //! points
+    INITIALIZE_FUNCTION,
+    //! \brief build of the evaluators of the material properties and external
+    //! state variables
+    BUILD_EVALUATORS,
+    //! \brief update of the view of the behaviour data at one integration point
+    UPDATE_VIEW,
+    //! \brief rotation of the gradients
+    ROTATE_GRADIENTS,
+    //! \brief rotation of the thermodynamic forces
+    ROTATE_THERMODYNAMIC_FORCES,
+    //! \brief rotation of the tangent operator blocks
+    ROTATE_TANGENT_OPERATOR_BLOCKS,
+    //! \brief conversion of the stress of a finite strain behaviour
+    CONVERT_FINITE_STRAIN_STRESS,
+    //! \brief conversion of the tangent operator of a finite strain behaviour
+    CONVERT_FINITE_STRAIN_TANGENT_OPERATOR,
+    //! \brief execution of a task by a thread of a thread pool
+    THREAD_POOL_TASK,
+    //! \brief time spent by a task in the queue of a thread pool
+    THREAD_POOL_QUEUE,
+    //! \brief time spent waiting for the tasks of a thread pool
+    THREAD_POOL_WAIT
+  };  // end of enum struct Region
+
+  //! \brief number of instrumented regions
+  inline constexpr size_type number_of_regions =
+      static_cast<size_type>(Region::THREAD_POOL_WAIT) + 1;
+
+  /*!
+   * \return the name of the given region
+   * \param[in] r: region
+   */
+  MGIS_EXPORT const char* getRegionName(const Region);
+  /*!
+   * \return the region associated with the given name
+   * \param[in] n: name
+   */
+  MGIS_EXPORT Region getRegion(const std::string_view);
+
+  //! \brief statistics associated with a region
+  struct RegionStatistics {
+    //! \brief number of calls
+    size_type calls = 0;
+    //! \brief number of integration points treated
+    size_type points = 0;
+    //! \brief number of failures
+    size_type failures = 0;
+    //! \brief total wall time, in seconds
+    real total_time = 0;
+    //! \brief minimal wall time of a call, in seconds
+    real min_time = 0;
+    //! \brief maximal wall time of a call, in seconds
+    real max_time = 0;
+  };  // end of struct RegionStatistics
+
+  /*!
+   * \brief merge the statistics `s2` into `s1`
+   * \param[in,out] s1: statistics
+   * \param[in] s2: statistics
+   */
+  MGIS_EXPORT void merge(RegionStatistics&, const RegionStatistics&);
+
+  //! \brief statistics gathered by one thread
+  struct ThreadProfile {
+    //! \brief index of the thread, in order of first use of the profiling layer
+    size_type thread = 0;
+    //! \brief statistics of the regions
+    std::array<RegionStatistics, number_of_regions> regions;
+  };  // end of struct ThreadProfile
+
+  //! \brief a snapshot of the profiling data gathered by all threads
+  struct MGIS_EXPORT ProfilingReport {
+    /*!
+     * \return the statistics of the given region, cumulated over all threads
+     * \param[in] r: region
+     */
+    RegionStatistics getTotal(const Region) const;
+    /*!
+     * \return the load imbalance of the given region, defined as the ratio of
+     * the maximal time spent in this region by a thread over the mean time
+     * spent by the threads in this region, minus one. Only the threads having
+     * entered the region are considered.
+     * \param[in] r: region
+     */
+    real getLoadImbalance(const Region) const;
+    //! \brief profiles of the threads
+    std::vector<ThreadProfile> threads;
+  };  // end of struct ProfilingReport
+
+  /*!
+   * \return if the profiling layer has been compiled in the library. See
+   * the `enable-profiling` option of `cmake`.
+   */
+  MGIS_EXPORT bool isProfilingAvailable();
+  /*!
+   * \brief enable or disable the profiling at runtime. The profiling is
+   * disabled by default.
+   * \param[in] b: boolean
+   *
+   * \note this call has no effect if the profiling layer is not available.
+   */
+  MGIS_EXPORT void enableProfiling(const bool = true);
+  //! \return if the profiling is enabled
+  MGIS_EXPORT bool isProfilingEnabled();
+  //! \brief reset all the profiling data
+  MGIS_EXPORT void resetProfiling();
+  //! \return a snapshot of the profiling data
+  MGIS_EXPORT ProfilingReport getProfilingReport();
+  /*!
+   * \brief record a measure
+   * \param[in] r: region
+   * \param[in] t: wall time, in seconds
+   * \param[in] n: number of integration points treated
+   * \param[in] f: if the call failed
+   */
+  MGIS_EXPORT void record(const Region,
+                          const real,
+                          const size_type = 0,
+                          const bool = false);
+  /*!
+   * \brief print the profiling report in the `JSON` format
+   * \param[in] os: output stream
+   * \param[in] r: report
+   */
+  MGIS_EXPORT void print_json(std::ostream&, const ProfilingReport&);
+
+  /*!
+   * \brief a scoped timer recording the wall time spent between its
+   * construction and its destruction.
+   */
+  struct MGIS_EXPORT ProfilingTimer {
+    /*!
+     * \brief constructor
+     * \param[in] r: region
+     * \param[in] n: number of integration points treated
+     */
+    ProfilingTimer(const Region, const size_type = 0);
+    //! \brief set the number of integration points treated
+    void setNumberOfPoints(const size_type);
+    //! \brief mark the call as failed
+    void setFailure();
+    //! \brief destructor
+    ~ProfilingTimer();
+
+   private:
+    ProfilingTimer(ProfilingTimer&&) = delete;
+    ProfilingTimer(const ProfilingTimer&) = delete;
+    ProfilingTimer& operator=(ProfilingTimer&&) = delete;
+    ProfilingTimer& operator=(const ProfilingTimer&) = delete;
+    //! \brief start of the measure
+    std::chrono::steady_clock::time_point start;
+    //! \brief region
+    const Region region;
+    //! \brief number of integration points
+    size_type points;
+    //! \brief failure flag
+    bool failure = false;
+    //! \brief if the profiling was enabled at construction
+    const bool active;
+  };  // end of struct ProfilingTimer
+
+}  // end of namespace mgis::profiling
+
+/*!
+ * The following macros are used to instrument the library. They expand to
+ * nothing unless the library is compiled with the `MGIS_HAVE_PROFILING` flag.
+ */
+#ifdef MGIS_HAVE_PROFILING
+#define MGIS_PROFILING_TIMER(t, r, n) \
+  ::mgis::profiling::ProfilingTimer t(::mgis::profiling::Region::r, n)
+#define MGIS_PROFILING_SET_NUMBER_OF_POINTS(t, n) t.setNumberOfPoints(n)
+#define MGIS_PROFILING_SET_FAILURE(t) t.setFailure()
+#else /* MGIS_HAVE_PROFILING */
+#define MGIS_PROFILING_TIMER(t, r, n) static_cast<void>(0)
+#define MGIS_PROFILING_SET_NUMBER_OF_POINTS(t, n) static_cast<void>(0)
+#define MGIS_PROFILING_SET_FAILURE(t) static_cast<void>(0)
+#endif /* MGIS_HAVE_PROFILING */
+
+#endif /* LIB_MGIS_PROFILING_HXX */
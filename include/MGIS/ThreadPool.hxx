@@ -22,6 +22,7 @@
 #define MGIS_THREAD_POOL_HXX
 
 #include <queue>
+#include <atomic>
 #include <mutex>
 #include <vector>
 #include <thread>
@@ -33,6 +34,35 @@
 
 namespace mgis {
 
+  // forward declaration
+  struct EventRecorder;
+
+  /*!
+   * \brief policy used to bind the threads of a pool to the processing units
+   * of the machine.
+   *
+   * The processing units available to the process are grouped by NUMA node.
+   * If more threads than processing units are requested, the processing
+   * units are reused cyclically.
+   *
+   * \note thread affinity is only supported on Linux. On other systems, the
+   * threads are never bound.
+   */
+  enum struct ThreadAffinityPolicy {
+    //! \brief the threads are not bound
+    NONE,
+    /*!
+     * \brief consecutive threads are bound to consecutive processing units,
+     * filling the first NUMA node before the next one
+     */
+    COMPACT,
+    /*!
+     * \brief consecutive threads are distributed in a round-robin manner over
+     * the NUMA nodes
+     */
+    SCATTER
+  };  // end of enum struct ThreadAffinityPolicy
+
   /*!
    * \brief structure handling a fixed-size pool of threads
    */
@@ -42,6 +72,12 @@ namespace mgis {
      * \param[in] n: number of thread to be created
      */
     ThreadPool(const size_type);
+    /*!
+     * \brief constructor
+     * \param[in] n: number of thread to be created
+     * \param[in] a: thread affinity policy
+     */
+    ThreadPool(const size_type, const ThreadAffinityPolicy);
     /*!
      * \brief add a new task
      * \param[in] f: task
@@ -50,8 +86,43 @@ namespace mgis {
     template <typename F, typename... Args>
     std::future<ThreadedTaskResult<typename std::result_of<F(Args...)>::type>>
     addTask(F&&, Args&&...);
+    /*!
+     * \brief add a new task which will be executed by the given thread.
+     *
+     * Combined with a thread affinity policy, this allows to always process
+     * the same range of data on the same processing unit, which is required
+     * to benefit from the first-touch placement of memory pages on NUMA
+     * machines.
+     *
+     * \param[in] i: index of the thread
+     * \param[in] f: task
+     * \param[in] a: arguments passed to the the task
+     */
+    template <typename F, typename... Args>
+    std::future<ThreadedTaskResult<typename std::result_of<F(Args...)>::type>>
+    addTaskToThread(const size_type, F&&, Args&&...);
     //! \return the number of threads managed by the ppol
     size_type getNumberOfThreads() const;
+    //! \return the thread affinity policy
+    ThreadAffinityPolicy getThreadAffinityPolicy() const;
+    /*!
+     * \return the processing unit to which the given thread is bound, or -1
+     * if the thread is not bound.
+     * \param[in] i: index of the thread
+     */
+    int getThreadProcessingUnit(const size_type) const;
+    //! \return if the calling thread belongs to this pool
+    bool isWorkerThread() const;
+    /*!
+     * \brief attach an event recorder to the thread pool. The enqueue, the
+     * beginning and the end of each task are recorded. While executing a task,
+     * the recorder is also used by the threads of the pool to record named
+     * regions (see `EventRegion`).
+     * \param[in] r: recorder. If null, the current recorder is detached.
+     *
+     * \note the recorder must outlive the tasks added while it is attached.
+     */
+    void setEventRecorder(EventRecorder* const);
     //! \brief wait for all tasks to be finished
     void wait();
     //! destructor
@@ -61,16 +132,42 @@ namespace mgis {
     //! wrapper around the given task
     template <typename F>
     struct Wrapper;
+    /*!
+     * \brief add a task to the queue
+     * \param[in] t: task
+     */
+    void push(std::function<void()>);
+    /*!
+     * \brief add a task to the queue of the given thread
+     * \param[in] i: index of the thread
+     * \param[in] t: task
+     */
+    void push(const size_type, std::function<void()>);
+    /*!
+     * \brief wrap the given task for profiling and event recording
+     * \param[in] t: task
+     */
+    std::function<void()> wrap(std::function<void()>);
+    //! \return if all the task queues are empty
+    bool areTaskQueuesEmpty() const;
     enum Status { WORKING, IDLE };  // end of enum Status
     std::vector<Status> statuses;
     //! list of threads
     std::vector<std::thread> workers;
     // the task queue
     std::queue<std::function<void()>> tasks;
+    //! \brief the task queues dedicated to each thread
+    std::vector<std::queue<std::function<void()>>> thread_tasks;
+    //! \brief processing units to which the threads are bound
+    std::vector<int> processing_units;
+    //! \brief thread affinity policy
+    ThreadAffinityPolicy affinity = ThreadAffinityPolicy::NONE;
     // synchronization
     std::mutex m;
     std::condition_variable c;
     bool stop = false;
+    //! \brief event recorder, if any
+    std::atomic<EventRecorder*> recorder = nullptr;
   };
 
 }  // end of namespace mgis
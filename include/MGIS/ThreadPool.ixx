@@ -69,17 +69,20 @@ namespace mgis {
     auto t = std::make_shared<task>(
         std::bind(Wrapper<F>(std::forward<F>(f)), std::forward<Args>(a)...));
     auto res = t->get_future();
-    {
-      std::unique_lock<std::mutex> lock(this->m);
-      // don't allow enqueueing after stopping the pool
-      if (this->stop) {
-        throw std::runtime_error(
-            "ThreadPool::addTask: "
-            "enqueue on stopped ThreadPool");
-      }
-      this->tasks.emplace([t] { (*t)(); });
-    }
-    this->c.notify_one();
+    this->push([t] { (*t)(); });
+    return res;
+  }
+
+  template <typename F, typename... Args>
+  std::future<ThreadedTaskResult<typename std::result_of<F(Args...)>::type>>
+  ThreadPool::addTaskToThread(const size_type i, F&& f, Args&&... a) {
+    using return_type =
+        ThreadedTaskResult<typename std::result_of<F(Args...)>::type>;
+    using task = std::packaged_task<return_type()>;
+    auto t = std::make_shared<task>(
+        std::bind(Wrapper<F>(std::forward<F>(f)), std::forward<Args>(a)...));
+    auto res = t->get_future();
+    this->push(i, [t] { (*t)(); });
     return res;
   }
 
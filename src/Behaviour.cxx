@@ -16,6 +16,9 @@
 #include <iterator>
 
 #include "MGIS/Raise.hxx"
+#include "MGIS/Profiling.hxx"
+#include "MGIS/EventRecorder.hxx"
+#include "MGIS/Executor.hxx"
 #include "MGIS/LibrariesManager.hxx"
 #include "MGIS/Behaviour/Hypothesis.hxx"
 #include "MGIS/Behaviour/Behaviour.hxx"
@@ -605,6 +608,8 @@ namespace mgis::behaviour {
     const auto gsize = getArraySize(b.gradients, b.hypothesis);
     const auto nipts =
         checkRotateFunctionInputs("rotateGradients", mg, gg, gsize);
+    MGIS_PROFILING_TIMER(timer, ROTATE_GRADIENTS, nipts);
+    EventRegion region("rotate_gradients");
     if (r.size() == 0) {
       mgis::raise("rotateGradients: no values given for the rotation matrices");
     }
@@ -638,6 +643,8 @@ namespace mgis::behaviour {
     const auto gsize = getArraySize(b.gradients, b.hypothesis);
     const auto nipts =
         checkRotateFunctionInputs("rotateGradients", mg, gg, gsize);
+    MGIS_PROFILING_TIMER(timer, ROTATE_GRADIENTS, nipts);
+    EventRegion region("rotate_gradients");
     checkRotationMatrix2D("rotateGradients", r, b, nipts);
     if (r.a.size() == 2u) {
       const auto m = buildRotationMatrix(r.a.data());
@@ -659,6 +666,8 @@ namespace mgis::behaviour {
     const auto gsize = getArraySize(b.gradients, b.hypothesis);
     const auto nipts =
         checkRotateFunctionInputs("rotateGradients", mg, gg, gsize);
+    MGIS_PROFILING_TIMER(timer, ROTATE_GRADIENTS, nipts);
+    EventRegion region("rotate_gradients");
     checkRotationMatrix3D("rotateGradients", r, b, nipts);
     if ((r.a1.a.size() == 3u) && ((r.a2.a.size() == 3u))) {
       const auto m = buildRotationMatrix(r.a1.a.data(), r.a2.a.data());
@@ -710,6 +719,8 @@ namespace mgis::behaviour {
     const auto tfsize = getArraySize(b.thermodynamic_forces, b.hypothesis);
     const auto nipts = checkRotateFunctionInputs("rotateThermodynamicForces",
                                                  mtf, gtf, tfsize);
+    MGIS_PROFILING_TIMER(timer, ROTATE_THERMODYNAMIC_FORCES, nipts);
+    EventRegion region("rotate_thermodynamic_forces");
     if (r.size() == 0) {
       mgis::raise(
           "rotateThermodynamicForces: "
@@ -749,6 +760,8 @@ namespace mgis::behaviour {
     const auto tfsize = getArraySize(b.thermodynamic_forces, b.hypothesis);
     const auto nipts = checkRotateFunctionInputs("rotateThermodynamicForces",
                                                  gtf, mtf, tfsize);
+    MGIS_PROFILING_TIMER(timer, ROTATE_THERMODYNAMIC_FORCES, nipts);
+    EventRegion region("rotate_thermodynamic_forces");
     checkRotationMatrix2D("rotateThermodynamicForces", r, b, nipts);
     if (r.a.size() == 2u) {
       const auto m = buildRotationMatrix(r.a.data());
@@ -772,6 +785,8 @@ namespace mgis::behaviour {
     const auto tfsize = getArraySize(b.thermodynamic_forces, b.hypothesis);
     const auto nipts = checkRotateFunctionInputs("rotateThermodynamicForces",
                                                  gtf, mtf, tfsize);
+    MGIS_PROFILING_TIMER(timer, ROTATE_THERMODYNAMIC_FORCES, nipts);
+    EventRegion region("rotate_thermodynamic_forces");
     checkRotationMatrix3D("rotateThermodynamicForces", r, b, nipts);
     if ((r.a1.a.size() == 3u) && ((r.a2.a.size() == 3u))) {
       const auto m = buildRotationMatrix(r.a1.a.data(), r.a2.a.data());
@@ -825,6 +840,8 @@ namespace mgis::behaviour {
     const auto Ksize = getTangentOperatorArraySize(b);
     const auto nipts =
         checkRotateFunctionInputs("rotateTangentOperatorBlocks", mK, gK, Ksize);
+    MGIS_PROFILING_TIMER(timer, ROTATE_TANGENT_OPERATOR_BLOCKS, nipts);
+    EventRegion region("rotate_tangent_operator_blocks");
     if (r.size() == 0) {
       mgis::raise(
           "rotateTangentOperatorBlocks: "
@@ -866,6 +883,8 @@ namespace mgis::behaviour {
     const auto Ksize = getTangentOperatorArraySize(b);
     const auto nipts =
         checkRotateFunctionInputs("rotateTangentOperatorBlocks", gK, mK, Ksize);
+    MGIS_PROFILING_TIMER(timer, ROTATE_TANGENT_OPERATOR_BLOCKS, nipts);
+    EventRegion region("rotate_tangent_operator_blocks");
     checkRotationMatrix2D("rotateTangentOperatorBlocks", r, b, nipts);
     if (r.a.size() == 2u) {
       const auto m = buildRotationMatrix(r.a.data());
@@ -889,6 +908,8 @@ namespace mgis::behaviour {
     const auto Ksize = getTangentOperatorArraySize(b);
     const auto nipts =
         checkRotateFunctionInputs("rotateTangentOperatorBlocks", gK, mK, Ksize);
+    MGIS_PROFILING_TIMER(timer, ROTATE_TANGENT_OPERATOR_BLOCKS, nipts);
+    EventRegion region("rotate_tangent_operator_blocks");
     checkRotationMatrix3D("rotateTangentOperatorBlocks", r, b, nipts);
     if ((r.a1.a.size() == 3u) && ((r.a2.a.size() == 3u))) {
       const auto m = buildRotationMatrix(r.a1.a.data(), r.a2.a.data());
@@ -907,6 +928,86 @@ namespace mgis::behaviour {
     }
   }  // end of rotateTangentOperatorBlocks
 
+  /*!
+   * \brief split the rotation of an array of values using an executor
+   * \param[in,out] e: executor
+   * \param[in] m: calling function name
+   * \param[out] o: rotated values
+   * \param[in] i: values to be rotated
+   * \param[in] r: rotation matrices
+   * \param[in] vsize: size of the values per integration point
+   * \param[in] f: function rotating a sub-array
+   */
+  template <typename RotateFunction>
+  static void rotateWithExecutor(Executor &e,
+                                 const char *const m,
+                                 mgis::span<real> o,
+                                 const mgis::span<const real> &i,
+                                 const mgis::span<const real> &r,
+                                 const mgis::size_type vsize,
+                                 const RotateFunction &f) {
+    const auto nipts = checkRotateFunctionInputs(m, o, i, vsize);
+    if ((r.size() != 9) && (r.size() != 9 * nipts)) {
+      mgis::raise(std::string(m) +
+                  ": invalid size for the rotation matrix array");
+    }
+    auto results = executeOverRange(
+        e, nipts, [&o, &i, &r, &f, vsize](const size_type b,
+                                          const size_type ie) {
+          const auto ob = b * vsize;
+          const auto os = (ie - b) * vsize;
+          const auto rb = (r.size() == 9) ? r : r.subspan(9 * b, 9 * (ie - b));
+          f(o.subspan(ob, os), i.subspan(ob, os), rb);
+        });
+    for (auto &res : results) {
+      if (!res) {
+        res.rethrow();
+      }
+    }
+  }  // end of rotateWithExecutor
+
+  void rotateGradients(Executor &e,
+                       mgis::span<real> mg,
+                       const Behaviour &b,
+                       const mgis::span<const real> &gg,
+                       const mgis::span<const real> &r) {
+    checkBehaviourRotateGradients(b);
+    const auto gsize = getArraySize(b.gradients, b.hypothesis);
+    rotateWithExecutor(e, "rotateGradients", mg, gg, r, gsize,
+                       [&b](mgis::span<real> o, mgis::span<const real> i,
+                            mgis::span<const real> ri) {
+                         rotateGradients(o, b, i, ri);
+                       });
+  }  // end of rotateGradients
+
+  void rotateThermodynamicForces(Executor &e,
+                                 mgis::span<real> gtf,
+                                 const Behaviour &b,
+                                 const mgis::span<const real> &mtf,
+                                 const mgis::span<const real> &r) {
+    checkBehaviourRotateThermodynamicForces(b);
+    const auto tfsize = getArraySize(b.thermodynamic_forces, b.hypothesis);
+    rotateWithExecutor(e, "rotateThermodynamicForces", gtf, mtf, r, tfsize,
+                       [&b](mgis::span<real> o, mgis::span<const real> i,
+                            mgis::span<const real> ri) {
+                         rotateThermodynamicForces(o, b, i, ri);
+                       });
+  }  // end of rotateThermodynamicForces
+
+  void rotateTangentOperatorBlocks(Executor &e,
+                                   mgis::span<real> gK,
+                                   const Behaviour &b,
+                                   const mgis::span<const real> &mK,
+                                   const mgis::span<const real> &r) {
+    checkBehaviourRotateTangentOperatorBlocks(b);
+    const auto Ksize = getTangentOperatorArraySize(b);
+    rotateWithExecutor(e, "rotateTangentOperatorBlocks", gK, mK, r, Ksize,
+                       [&b](mgis::span<real> o, mgis::span<const real> i,
+                            mgis::span<const real> ri) {
+                         rotateTangentOperatorBlocks(o, b, i, ri);
+                       });
+  }  // end of rotateTangentOperatorBlocks
+
   void setParameter(const Behaviour &b, const std::string &n, const double v) {
     auto &lm = mgis::LibrariesManager::get();
     lm.setParameter(b.library, b.behaviour, b.hypothesis, n, v);
@@ -0,0 +1,932 @@
+/*!
+ * \file   Checkpoint.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <map>
+#include <future>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <fstream>
+#include <exception>
+#include <algorithm>
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif /* __linux__ */
+#include "MGIS/Raise.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Partition.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Checkpoint.hxx"
+
+namespace mgis::behaviour {
+
+  //! \brief magic string starting a checkpoint file
+  static constexpr char checkpoint_magic[8] = {'M', 'G', 'I', 'S',
+                                               'C', 'K', 'P', 'T'};
+  //! \brief value used to detect a change of endianness
+  static constexpr std::uint32_t checkpoint_endianness = 0x01020304;
+  //! \brief size of the header of a checkpoint file
+  static constexpr std::uint64_t checkpoint_header_size = 64;
+  //! \brief alignment of the arrays in a checkpoint file
+  static constexpr std::uint64_t checkpoint_alignment = 4096;
+
+  //! \brief description of an array or of an uniform value
+  struct CheckpointRecord {
+    //! \brief name
+    std::string name;
+    //! \brief if true, the record holds a uniform value
+    bool uniform = false;
+    //! \brief uniform value
+    real value = 0;
+    //! \brief values of the array (only used when saving)
+    const real* values = nullptr;
+    //! \brief number of values
+    std::uint64_t size = 0;
+    //! \brief offset of the array in the file, in bytes
+    std::uint64_t offset = 0;
+    //! \brief checksum of the array
+    std::uint64_t checksum = 0;
+  };  // end of struct CheckpointRecord
+
+  //! \brief metadata stored in a checkpoint file
+  struct CheckpointMetadata {
+    //! \brief general information
+    CheckpointInformation information;
+    //! \brief size of the gradients
+    std::uint64_t gradients_stride = 0;
+    //! \brief size of the thermodynamic forces
+    std::uint64_t thermodynamic_forces_stride = 0;
+    //! \brief size of the internal state variables
+    std::uint64_t isvs_stride = 0;
+    //! \brief size of the tangent operator blocks
+    std::uint64_t K_stride = 0;
+    //! \brief storage of the tangent operator blocks
+    TangentOperatorStorage K_storage;
+    //! \brief proposed time step increase factor
+    real rdt = 1;
+    //! \brief arrays and uniform values
+    std::vector<CheckpointRecord> records;
+  };  // end of struct CheckpointMetadata
+
+  //! \brief a chunk of an array
+  struct CheckpointChunk {
+    //! \brief index of the record
+    size_type record;
+    //! \brief first byte of the chunk, relative to the start of the array
+    std::uint64_t begin;
+    //! \brief byte past the end of the chunk
+    std::uint64_t end;
+  };  // end of struct CheckpointChunk
+
+  /*!
+   * \return the checksum of the given bytes. This checksum is a variant of
+   * the 64 bits Fowler-Noll-Vo (FNV-1a) hash treating the data by words of
+   * 8 bytes.
+   * \param[in] p: bytes
+   * \param[in] s: number of bytes
+   */
+  static std::uint64_t computeChecksum(const char* const p,
+                                       const std::uint64_t s) {
+    constexpr auto prime = std::uint64_t{1099511628211u};
+    auto h = std::uint64_t{14695981039346656037u};
+    auto i = std::uint64_t{};
+    for (; i + 8 <= s; i += 8) {
+      auto w = std::uint64_t{};
+      std::memcpy(&w, p + i, 8);
+      h = (h ^ w) * prime;
+    }
+    for (; i != s; ++i) {
+      h = (h ^ static_cast<unsigned char>(p[i])) * prime;
+    }
+    return h;
+  }  // end of computeChecksum
+
+  //! \return the given value rounded to the next multiple of the alignment
+  static std::uint64_t align(const std::uint64_t v) {
+    return ((v + checkpoint_alignment - 1) / checkpoint_alignment) *
+           checkpoint_alignment;
+  }  // end of align
+
+  //! \brief a simple class used to serialize the metadata
+  struct CheckpointWriter {
+    template <typename T>
+    void write(const T& v) {
+      const auto* const p = reinterpret_cast<const char*>(&v);
+      this->buffer.insert(this->buffer.end(), p, p + sizeof(T));
+    }
+    void write(const std::string& s) {
+      this->write(static_cast<std::uint64_t>(s.size()));
+      this->buffer.insert(this->buffer.end(), s.begin(), s.end());
+    }
+    //! \brief serialized data
+    std::vector<char> buffer;
+  };  // end of struct CheckpointWriter
+
+  //! \brief a simple class used to read the metadata
+  struct CheckpointReader {
+    template <typename T>
+    T read() {
+      this->check(sizeof(T));
+      auto v = T{};
+      std::memcpy(&v, this->p, sizeof(T));
+      this->p += sizeof(T);
+      return v;
+    }
+    std::string readString() {
+      const auto s = this->read<std::uint64_t>();
+      this->check(s);
+      auto r = std::string(this->p, this->p + s);
+      this->p += s;
+      return r;
+    }
+    void check(const std::uint64_t s) const {
+      if (static_cast<std::uint64_t>(this->e - this->p) < s) {
+        mgis::raise("readCheckpoint: truncated metadata");
+      }
+    }
+    //! \brief current position
+    const char* p;
+    //! \brief end of the metadata
+    const char* const e;
+  };  // end of struct CheckpointReader
+
+  /*!
+   * \brief call `f(i)` for each `i` in `[0, n[`, using the given thread pool
+   * if not null. All the calls are completed before the first exception
+   * thrown, if any, is rethrown.
+   * \param[in] p: thread pool
+   * \param[in] n: number of calls
+   * \param[in] f: function
+   */
+  template <typename Functor>
+  static void forEachChunk(mgis::ThreadPool* const p,
+                           const size_type n,
+                           const Functor& f) {
+    if ((p == nullptr) || (n < 2) || (p->isWorkerThread())) {
+      for (size_type i = 0; i != n; ++i) {
+        f(i);
+      }
+      return;
+    }
+    const auto bounds =
+        getUniformPartition(n, std::min(n, p->getNumberOfThreads()));
+    auto tasks = std::vector<std::future<ThreadedTaskResult<void>>>{};
+    tasks.reserve(bounds.size() - 1);
+    for (size_type i = 0; i + 1 < bounds.size(); ++i) {
+      tasks.push_back(p->addTask([&f, b = bounds[i], e = bounds[i + 1]] {
+        for (auto j = b; j != e; ++j) {
+          f(j);
+        }
+      }));
+    }
+    auto error = std::exception_ptr{};
+    for (auto& t : tasks) {
+      try {
+        auto r = t.get();
+        if (!r) {
+          r.rethrow();
+        }
+      } catch (...) {
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }  // end of forEachChunk
+
+  /*!
+   * \return the chunks of the arrays
+   * \param[in] records: records
+   * \param[in] chunk_size: size of the chunks in bytes
+   */
+  static std::vector<CheckpointChunk> getChunks(
+      const std::vector<CheckpointRecord>& records,
+      const std::uint64_t chunk_size) {
+    auto chunks = std::vector<CheckpointChunk>{};
+    for (size_type i = 0; i != records.size(); ++i) {
+      const auto& r = records[i];
+      if (r.uniform) {
+        continue;
+      }
+      const auto s = r.size * sizeof(real);
+      for (auto b = std::uint64_t{}; b < s; b += chunk_size) {
+        chunks.push_back({i, b, std::min(b + chunk_size, s)});
+      }
+    }
+    return chunks;
+  }  // end of getChunks
+
+  /*!
+   * \brief compute the checksum of each array from the checksums of its
+   * chunks.
+   * \return the checksums of the arrays
+   * \param[in] records: records
+   * \param[in] chunks: chunks
+   * \param[in] checksums: checksums of the chunks
+   */
+  static std::vector<std::uint64_t> combineChecksums(
+      const std::vector<CheckpointRecord>& records,
+      const std::vector<CheckpointChunk>& chunks,
+      const std::vector<std::uint64_t>& checksums) {
+    auto values = std::vector<std::vector<std::uint64_t>>(records.size());
+    for (size_type i = 0; i != chunks.size(); ++i) {
+      values[chunks[i].record].push_back(checksums[i]);
+    }
+    auto r = std::vector<std::uint64_t>(records.size());
+    for (size_type i = 0; i != records.size(); ++i) {
+      r[i] = computeChecksum(reinterpret_cast<const char*>(values[i].data()),
+                             values[i].size() * sizeof(std::uint64_t));
+    }
+    return r;
+  }  // end of combineChecksums
+
+  //! \brief add an array to the list of records
+  static void addRecord(std::vector<CheckpointRecord>& records,
+                        std::string n,
+                        mgis::span<const real> values) {
+    auto r = CheckpointRecord{};
+    r.name = std::move(n);
+    r.values = values.data();
+    r.size = static_cast<std::uint64_t>(values.size());
+    records.push_back(std::move(r));
+  }  // end of addRecord
+
+  //! \brief add the given fields to the list of records
+  static void addRecords(
+      std::vector<CheckpointRecord>& records,
+      const std::string& prefix,
+      const std::map<std::string, MaterialStateManager::FieldHolder>& fields) {
+    for (const auto& f : fields) {
+      if (std::holds_alternative<real>(f.second)) {
+        auto r = CheckpointRecord{};
+        r.name = prefix + f.first;
+        r.uniform = true;
+        r.value = std::get<real>(f.second);
+        records.push_back(std::move(r));
+      } else if (std::holds_alternative<mgis::span<real>>(f.second)) {
+        addRecord(records, prefix + f.first,
+                  std::get<mgis::span<real>>(f.second));
+      } else {
+        addRecord(records, prefix + f.first,
+                  std::get<std::vector<real>>(f.second));
+      }
+    }
+  }  // end of addRecords
+
+  //! \brief add the arrays describing the given state
+  static void addRecords(std::vector<CheckpointRecord>& records,
+                         const std::string& prefix,
+                         const MaterialStateManager& s) {
+    addRecord(records, prefix + "gradients", s.gradients);
+    addRecord(records, prefix + "thermodynamic_forces",
+              s.thermodynamic_forces);
+    addRecord(records, prefix + "internal_state_variables",
+              s.internal_state_variables);
+    addRecord(records, prefix + "stored_energies", s.stored_energies);
+    addRecord(records, prefix + "dissipated_energies", s.dissipated_energies);
+    addRecords(records, prefix + "material_properties/",
+               s.material_properties);
+    addRecords(records, prefix + "external_state_variables/",
+               s.external_state_variables);
+  }  // end of addRecords
+
+  //! \return the serialized metadata
+  static std::vector<char> serialize(const CheckpointMetadata& d) {
+    auto w = CheckpointWriter{};
+    const auto& i = d.information;
+    w.write(i.behaviour);
+    w.write(i.hypothesis);
+    w.write(i.library);
+    w.write(i.tfel_version);
+    w.write(static_cast<std::uint64_t>(i.n));
+    w.write(d.gradients_stride);
+    w.write(d.thermodynamic_forces_stride);
+    w.write(d.isvs_stride);
+    w.write(d.K_stride);
+    w.write(static_cast<std::uint8_t>(d.K_storage.packed_symmetric));
+    w.write(static_cast<std::uint8_t>(d.K_storage.single_precision));
+    w.write(d.rdt);
+    w.write(static_cast<std::uint64_t>(i.isvs.size()));
+    for (const auto& v : i.isvs) {
+      w.write(v.name);
+      w.write(static_cast<std::int32_t>(v.type_identifier));
+      w.write(static_cast<std::uint64_t>(v.size));
+    }
+    w.write(static_cast<std::uint64_t>(d.records.size()));
+    for (const auto& r : d.records) {
+      w.write(r.name);
+      w.write(static_cast<std::uint8_t>(r.uniform ? 1 : 0));
+      w.write(r.value);
+      w.write(r.size);
+      w.write(r.offset);
+      w.write(r.checksum);
+    }
+    return std::move(w.buffer);
+  }  // end of serialize
+
+  //! \return the serialized header
+  static std::vector<char> serializeHeader(const std::vector<char>& metadata,
+                                           const std::uint64_t chunk_size,
+                                           const std::uint64_t file_size) {
+    auto w = CheckpointWriter{};
+    w.write(checkpoint_magic);
+    w.write(checkpoint_format_version);
+    w.write(checkpoint_endianness);
+    w.write(static_cast<std::uint32_t>(sizeof(real)));
+    w.write(std::uint32_t{0});
+    w.write(static_cast<std::uint64_t>(metadata.size()));
+    w.write(computeChecksum(metadata.data(), metadata.size()));
+    w.write(chunk_size);
+    w.write(file_size);
+    w.buffer.resize(checkpoint_header_size, '\0');
+    return std::move(w.buffer);
+  }  // end of serializeHeader
+
+  //! \brief an output file supporting concurrent writes at given offsets
+  struct CheckpointOutputFile {
+    CheckpointOutputFile(const std::string& f, const std::uint64_t s)
+        : name(f) {
+#ifdef __linux__
+      this->fd = ::open(f.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+      if (this->fd == -1) {
+        mgis::raise("saveCheckpoint: can't open file '" + f + "'");
+      }
+      if (::ftruncate(this->fd, static_cast<off_t>(s)) != 0) {
+        ::close(this->fd);
+        mgis::raise("saveCheckpoint: can't resize file '" + f + "'");
+      }
+#else  /* __linux__ */
+      static_cast<void>(s);
+      this->out.open(f, std::ios::binary | std::ios::trunc);
+      if (!this->out) {
+        mgis::raise("saveCheckpoint: can't open file '" + f + "'");
+      }
+#endif /* __linux__ */
+    }
+    //! \return if this file can be written concurrently
+    bool supportsConcurrentWrites() const {
+#ifdef __linux__
+      return true;
+#else  /* __linux__ */
+      return false;
+#endif /* __linux__ */
+    }
+    void write(const char* p, std::uint64_t s, std::uint64_t o) {
+#ifdef __linux__
+      while (s != 0) {
+        const auto r = ::pwrite(this->fd, p, s, static_cast<off_t>(o));
+        if (r <= 0) {
+          mgis::raise("saveCheckpoint: can't write file '" + this->name +
+                      "'");
+        }
+        p += r;
+        o += static_cast<std::uint64_t>(r);
+        s -= static_cast<std::uint64_t>(r);
+      }
+#else  /* __linux__ */
+      this->out.seekp(static_cast<std::streamoff>(o));
+      this->out.write(p, static_cast<std::streamsize>(s));
+      if (!this->out) {
+        mgis::raise("saveCheckpoint: can't write file '" + this->name + "'");
+      }
+#endif /* __linux__ */
+    }
+    ~CheckpointOutputFile() {
+#ifdef __linux__
+      ::close(this->fd);
+#endif /* __linux__ */
+    }
+
+   private:
+    //! \brief file name
+    const std::string name;
+#ifdef __linux__
+    //! \brief file descriptor
+    int fd = -1;
+#else  /* __linux__ */
+    //! \brief output stream
+    std::ofstream out;
+#endif /* __linux__ */
+  };  // end of struct CheckpointOutputFile
+
+  /*!
+   * \brief a read-only view of a checkpoint file. On `Linux`, the file is
+   * memory-mapped. Otherwise, the file is read in memory.
+   */
+  struct CheckpointInputFile {
+    CheckpointInputFile(const std::string& f) {
+#ifdef __linux__
+      const auto fd = ::open(f.c_str(), O_RDONLY);
+      if (fd == -1) {
+        mgis::raise("readCheckpoint: can't open file '" + f + "'");
+      }
+      struct stat st;
+      if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        mgis::raise("readCheckpoint: can't read file '" + f + "'");
+      }
+      this->size = static_cast<std::uint64_t>(st.st_size);
+      if (this->size != 0) {
+        auto* const p =
+            ::mmap(nullptr, this->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+          ::close(fd);
+          mgis::raise("readCheckpoint: can't map file '" + f + "'");
+        }
+        this->data = static_cast<const char*>(p);
+      }
+      ::close(fd);
+#else  /* __linux__ */
+      auto in = std::ifstream(f, std::ios::binary | std::ios::ate);
+      if (!in) {
+        mgis::raise("readCheckpoint: can't open file '" + f + "'");
+      }
+      this->size = static_cast<std::uint64_t>(in.tellg());
+      this->buffer.resize(this->size);
+      in.seekg(0);
+      in.read(this->buffer.data(), static_cast<std::streamsize>(this->size));
+      if (!in) {
+        mgis::raise("readCheckpoint: can't read file '" + f + "'");
+      }
+      this->data = this->buffer.data();
+#endif /* __linux__ */
+    }
+    ~CheckpointInputFile() {
+#ifdef __linux__
+      if (this->data != nullptr) {
+        ::munmap(const_cast<char*>(this->data), this->size);
+      }
+#endif /* __linux__ */
+    }
+    //! \brief content of the file
+    const char* data = nullptr;
+    //! \brief size of the file
+    std::uint64_t size = 0;
+
+   private:
+#ifndef __linux__
+    //! \brief content of the file
+    std::vector<char> buffer;
+#endif /* __linux__ */
+  };  // end of struct CheckpointInputFile
+
+  /*!
+   * \brief read the header and the metadata of a checkpoint file
+   * \param[out] chunk_size: size of the chunks
+   * \param[in] f: file
+   * \param[in] verify_checksum: if true, the checksum of the metadata is
+   * verified
+   */
+  static CheckpointMetadata readMetadata(std::uint64_t& chunk_size,
+                                         const CheckpointInputFile& f,
+                                         const bool verify_checksum) {
+    if (f.size < checkpoint_header_size) {
+      mgis::raise("readCheckpoint: invalid file (truncated header)");
+    }
+    auto h = CheckpointReader{f.data, f.data + checkpoint_header_size};
+    if (std::memcmp(f.data, checkpoint_magic, sizeof(checkpoint_magic)) !=
+        0) {
+      mgis::raise("readCheckpoint: invalid file (not a checkpoint file)");
+    }
+    h.p += sizeof(checkpoint_magic);
+    auto d = CheckpointMetadata{};
+    auto& i = d.information;
+    i.version = h.read<std::uint32_t>();
+    if ((i.version == 0) || (i.version > checkpoint_format_version)) {
+      mgis::raise("readCheckpoint: unsupported version of the format (" +
+                  std::to_string(i.version) + ")");
+    }
+    if (h.read<std::uint32_t>() != checkpoint_endianness) {
+      mgis::raise("readCheckpoint: unsupported endianness");
+    }
+    if (h.read<std::uint32_t>() != sizeof(real)) {
+      mgis::raise("readCheckpoint: unsupported size of floating point values");
+    }
+    h.read<std::uint32_t>();
+    const auto msize = h.read<std::uint64_t>();
+    const auto mchecksum = h.read<std::uint64_t>();
+    chunk_size = h.read<std::uint64_t>();
+    const auto fsize = h.read<std::uint64_t>();
+    if ((fsize != f.size) || (msize > f.size - checkpoint_header_size) ||
+        (chunk_size == 0)) {
+      mgis::raise("readCheckpoint: invalid file (inconsistent header)");
+    }
+    const auto* const mdata = f.data + checkpoint_header_size;
+    if ((verify_checksum) && (computeChecksum(mdata, msize) != mchecksum)) {
+      mgis::raise("readCheckpoint: invalid checksum of the metadata");
+    }
+    auto r = CheckpointReader{mdata, mdata + msize};
+    i.behaviour = r.readString();
+    i.hypothesis = r.readString();
+    i.library = r.readString();
+    i.tfel_version = r.readString();
+    i.n = static_cast<size_type>(r.read<std::uint64_t>());
+    d.gradients_stride = r.read<std::uint64_t>();
+    d.thermodynamic_forces_stride = r.read<std::uint64_t>();
+    d.isvs_stride = r.read<std::uint64_t>();
+    d.K_stride = r.read<std::uint64_t>();
+    if (i.version >= 2) {
+      // the storage of the tangent operator blocks is only stored since
+      // the second version of the format. Previous files use the dense
+      // storage.
+      d.K_storage.packed_symmetric = r.read<std::uint8_t>() != 0;
+      d.K_storage.single_precision = r.read<std::uint8_t>() != 0;
+    }
+    d.rdt = r.read<real>();
+    const auto nisvs = r.read<std::uint64_t>();
+    for (std::uint64_t k = 0; k != nisvs; ++k) {
+      auto v = CheckpointVariable{};
+      v.name = r.readString();
+      v.type_identifier = static_cast<int>(r.read<std::int32_t>());
+      v.size = static_cast<size_type>(r.read<std::uint64_t>());
+      i.isvs.push_back(std::move(v));
+    }
+    const auto nrecords = r.read<std::uint64_t>();
+    for (std::uint64_t k = 0; k != nrecords; ++k) {
+      auto rc = CheckpointRecord{};
+      rc.name = r.readString();
+      rc.uniform = r.read<std::uint8_t>() != 0;
+      rc.value = r.read<real>();
+      rc.size = r.read<std::uint64_t>();
+      rc.offset = r.read<std::uint64_t>();
+      rc.checksum = r.read<std::uint64_t>();
+      if ((!rc.uniform) &&
+          ((rc.size > f.size / sizeof(real)) || (rc.offset > f.size) ||
+           (rc.size * sizeof(real) > f.size - rc.offset))) {
+        mgis::raise("readCheckpoint: invalid file (array '" + rc.name +
+                    "' is out of bounds)");
+      }
+      i.fields.push_back(rc.name);
+      d.records.push_back(std::move(rc));
+    }
+    return d;
+  }  // end of readMetadata
+
+  void saveCheckpoint(const std::string& f,
+                      const MaterialDataManager& m,
+                      const CheckpointOptions& opts) {
+    if (!m.K_single_precision.empty()) {
+      mgis::raise("saveCheckpoint: tangent operator blocks stored "
+                  "in single precision are not supported");
+    }
+    auto d = CheckpointMetadata{};
+    auto& i = d.information;
+    i.version = checkpoint_format_version;
+    i.behaviour = m.b.behaviour;
+    i.hypothesis = toString(m.b.hypothesis);
+    i.library = m.b.library;
+    i.tfel_version = m.b.tfel_version;
+    i.n = m.n;
+    for (const auto& v : m.b.isvs) {
+      i.isvs.push_back(
+          {v.name, v.type_identifier, getVariableSize(v, m.b.hypothesis)});
+    }
+    d.gradients_stride = m.s1.gradients_stride;
+    d.thermodynamic_forces_stride = m.s1.thermodynamic_forces_stride;
+    d.isvs_stride = m.s1.internal_state_variables_stride;
+    d.K_stride = m.K_stride;
+    d.K_storage = m.K_storage;
+    d.rdt = m.rdt;
+    addRecords(d.records, "s0/", m.s0);
+    addRecords(d.records, "s1/", m.s1);
+    addRecord(d.records, "K", m.K);
+    addRecord(d.records, "speed_of_sound", m.speed_of_sound);
+    addRecord(d.records, "integration_costs", m.integration_costs);
+    // the size of the metadata does not depend on the offsets and checksums
+    auto file_size = checkpoint_header_size + serialize(d).size();
+    for (auto& r : d.records) {
+      if ((r.uniform) || (r.size == 0)) {
+        continue;
+      }
+      r.offset = align(file_size);
+      file_size = r.offset + r.size * sizeof(real);
+    }
+    const auto chunk_size = std::max(
+        static_cast<std::uint64_t>(opts.chunk_size / sizeof(real)) *
+            sizeof(real),
+        static_cast<std::uint64_t>(sizeof(real)));
+    auto file = CheckpointOutputFile(f, file_size);
+    const auto chunks = getChunks(d.records, chunk_size);
+    auto checksums = std::vector<std::uint64_t>(chunks.size());
+    auto* const p =
+        file.supportsConcurrentWrites() ? opts.thread_pool : nullptr;
+    forEachChunk(p, chunks.size(), [&](const size_type c) {
+      const auto& chunk = chunks[c];
+      const auto& r = d.records[chunk.record];
+      const auto* const values =
+          reinterpret_cast<const char*>(r.values) + chunk.begin;
+      const auto s = chunk.end - chunk.begin;
+      checksums[c] = computeChecksum(values, s);
+      file.write(values, s, r.offset + chunk.begin);
+    });
+    const auto rchecksums = combineChecksums(d.records, chunks, checksums);
+    for (size_type k = 0; k != d.records.size(); ++k) {
+      d.records[k].checksum = rchecksums[k];
+    }
+    const auto metadata = serialize(d);
+    const auto header = serializeHeader(metadata, chunk_size, file_size);
+    file.write(header.data(), header.size(), 0);
+    file.write(metadata.data(), metadata.size(), checkpoint_header_size);
+  }  // end of saveCheckpoint
+
+  CheckpointInformation readCheckpointInformation(const std::string& f) {
+    const auto file = CheckpointInputFile(f);
+    auto chunk_size = std::uint64_t{};
+    return readMetadata(chunk_size, file, true).information;
+  }  // end of readCheckpointInformation
+
+  /*!
+   * \return if the layout of the internal state variables stored in the
+   * checkpoint file matches the one of the behaviour
+   * \param[in] isvs: internal state variables stored in the file
+   * \param[in] b: behaviour
+   */
+  static bool hasSameLayout(const std::vector<CheckpointVariable>& isvs,
+                            const Behaviour& b) {
+    if (isvs.size() != b.isvs.size()) {
+      return false;
+    }
+    for (size_type k = 0; k != isvs.size(); ++k) {
+      const auto& v = b.isvs[k];
+      if ((isvs[k].name != v.name) ||
+          (isvs[k].type_identifier != v.type_identifier) ||
+          (isvs[k].size != getVariableSize(v, b.hypothesis))) {
+        return false;
+      }
+    }
+    return true;
+  }  // end of hasSameLayout
+
+  /*!
+   * \brief check that the internal state variables stored with a different
+   * layout can be copied in the given state
+   * \param[in] b: behaviour
+   * \param[in] isvs: internal state variables stored in the file
+   */
+  static void checkInternalStateVariablesRemapping(
+      const Behaviour& b, const std::vector<CheckpointVariable>& isvs) {
+    for (const auto& v : isvs) {
+      if ((contains(b.isvs, v.name)) &&
+          (getVariableSize(getVariable(b.isvs, v.name), b.hypothesis) !=
+           v.size)) {
+        mgis::raise("restoreCheckpoint: the size of the internal state "
+                    "variable '" + v.name + "' changed");
+      }
+    }
+  }  // end of checkInternalStateVariablesRemapping
+
+  /*!
+   * \brief copy the internal state variables stored with a different layout
+   * \param[out] s: state
+   * \param[in] isvs: internal state variables stored in the file
+   * \param[in] values: values stored in the file
+   */
+  static void remapInternalStateVariables(
+      MaterialStateManager& s,
+      const std::vector<CheckpointVariable>& isvs,
+      const real* const values) {
+    const auto& b = s.b;
+    auto stride = size_type{};
+    for (const auto& v : isvs) {
+      stride += v.size;
+    }
+    auto offset = size_type{};
+    for (const auto& v : isvs) {
+      if (contains(b.isvs, v.name)) {
+        const auto size = v.size;
+        const auto offset2 = getVariableOffset(b.isvs, v.name, b.hypothesis);
+        const auto stride2 = s.internal_state_variables_stride;
+        for (size_type i = 0; i != s.n; ++i) {
+          std::copy(values + i * stride + offset,
+                    values + i * stride + offset + size,
+                    s.internal_state_variables.begin() + i * stride2 +
+                        offset2);
+        }
+      }
+      offset += v.size;
+    }
+  }  // end of remapInternalStateVariables
+
+  void restoreCheckpoint(MaterialDataManager& m,
+                         const std::string& f,
+                         const CheckpointOptions& opts) {
+    const auto file = CheckpointInputFile(f);
+    auto chunk_size = std::uint64_t{};
+    auto d = readMetadata(chunk_size, file, opts.verify_checksums);
+    const auto& i = d.information;
+    if (i.behaviour != m.b.behaviour) {
+      mgis::raise("restoreCheckpoint: the behaviour '" + i.behaviour +
+                  "' stored in the file does not match the behaviour '" +
+                  m.b.behaviour + "' of the material data manager");
+    }
+    if (i.hypothesis != toString(m.b.hypothesis)) {
+      mgis::raise("restoreCheckpoint: unmatched modelling hypothesis");
+    }
+    if (i.n != m.n) {
+      mgis::raise("restoreCheckpoint: unmatched number of integration points");
+    }
+    if ((d.gradients_stride != m.s1.gradients_stride) ||
+        (d.thermodynamic_forces_stride != m.s1.thermodynamic_forces_stride)) {
+      mgis::raise(
+          "restoreCheckpoint: unmatched sizes of the gradients or of the "
+          "thermodynamic forces");
+    }
+    const auto same_layout = hasSameLayout(i.isvs, m.b);
+    if ((!same_layout) && (d.isvs_stride * m.n != 0)) {
+      auto stride = std::uint64_t{};
+      for (const auto& v : i.isvs) {
+        stride += v.size;
+      }
+      if (stride != d.isvs_stride) {
+        mgis::raise("restoreCheckpoint: inconsistent internal state variables");
+      }
+    }
+    // The file is fully checked before modifying the material data manager,
+    // so that a corrupted or truncated file leaves it unchanged.
+    //
+    // array of the material data manager in which each array of the file can
+    // be copied directly, if any
+    auto destinations = std::vector<mgis::span<real>*>(d.records.size(),
+                                                       nullptr);
+    auto getValues = [&file](const CheckpointRecord& r) {
+      return reinterpret_cast<const real*>(file.data + r.offset);
+    };
+    auto setDestination = [&d, &destinations](const size_type k,
+                                              mgis::span<real>& v,
+                                              const std::uint64_t size) {
+      if (d.records[k].size != size) {
+        mgis::raise("restoreCheckpoint: unmatched size of array '" +
+                    d.records[k].name + "'");
+      }
+      destinations[k] = &v;
+    };
+    auto setStateDestination = [&setDestination](const size_type k,
+                                                 mgis::span<real>& v) {
+      setDestination(k, v, static_cast<std::uint64_t>(v.size()));
+    };
+    auto getState = [&m](const std::string& n) -> MaterialStateManager* {
+      if (n.compare(0, 3, "s0/") == 0) {
+        return &(m.s0);
+      } else if (n.compare(0, 3, "s1/") == 0) {
+        return &(m.s1);
+      }
+      return nullptr;
+    };
+    for (size_type k = 0; k != d.records.size(); ++k) {
+      const auto& r = d.records[k];
+      if (r.uniform) {
+        continue;
+      }
+      auto* const s = getState(r.name);
+      if (s != nullptr) {
+        const auto n = r.name.substr(3);
+        if (n == "gradients") {
+          setStateDestination(k, s->gradients);
+        } else if (n == "thermodynamic_forces") {
+          setStateDestination(k, s->thermodynamic_forces);
+        } else if (n == "internal_state_variables") {
+          if (same_layout) {
+            setStateDestination(k, s->internal_state_variables);
+          } else {
+            if (r.size != d.isvs_stride * m.n) {
+              mgis::raise("restoreCheckpoint: unmatched size of array '" +
+                          r.name + "'");
+            }
+            checkInternalStateVariablesRemapping(m.b, i.isvs);
+          }
+        } else if (n == "stored_energies") {
+          setStateDestination(k, s->stored_energies);
+        } else if (n == "dissipated_energies") {
+          setStateDestination(k, s->dissipated_energies);
+        }
+      } else if (r.size != 0) {
+        if (r.name == "K") {
+          if (m.K_storage.single_precision) {
+            mgis::raise("restoreCheckpoint: tangent operator blocks stored "
+                        "in single precision are not supported");
+          }
+          if ((d.K_storage.packed_symmetric !=
+               m.K_storage.packed_symmetric) ||
+              (d.K_storage.single_precision)) {
+            mgis::raise("restoreCheckpoint: unmatched storage of the tangent "
+                        "operator blocks");
+          }
+          if (d.K_stride != m.K_stride) {
+            mgis::raise("restoreCheckpoint: unmatched size of the tangent "
+                        "operator blocks");
+          }
+          setDestination(k, m.K, m.n * m.K_stride);
+        } else if (r.name == "speed_of_sound") {
+          setDestination(k, m.speed_of_sound, m.n);
+        } else if (r.name == "integration_costs") {
+          setDestination(k, m.integration_costs, m.n);
+        }
+      }
+    }
+    const auto chunks = getChunks(d.records, chunk_size);
+    if (opts.verify_checksums) {
+      // the mapped pages read here are still resident when the arrays are
+      // copied afterwards
+      auto checksums = std::vector<std::uint64_t>(chunks.size());
+      forEachChunk(opts.thread_pool, chunks.size(), [&](const size_type c) {
+        const auto& chunk = chunks[c];
+        const auto& r = d.records[chunk.record];
+        checksums[c] = computeChecksum(file.data + r.offset + chunk.begin,
+                                       chunk.end - chunk.begin);
+      });
+      const auto rchecksums = combineChecksums(d.records, chunks, checksums);
+      for (size_type k = 0; k != d.records.size(); ++k) {
+        const auto& r = d.records[k];
+        if ((!r.uniform) && (rchecksums[k] != r.checksum)) {
+          mgis::raise("restoreCheckpoint: invalid checksum of array '" +
+                      r.name + "'");
+        }
+      }
+    }
+    // allocation of the auxiliary arrays
+    for (size_type k = 0; k != d.records.size(); ++k) {
+      if ((destinations[k] == nullptr) || (!destinations[k]->empty())) {
+        continue;
+      }
+      if (destinations[k] == &(m.K)) {
+        m.allocateArrayOfTangentOperatorBlocks();
+      } else if (destinations[k] == &(m.speed_of_sound)) {
+        m.allocateArrayOfSpeedOfSounds();
+      } else if (destinations[k] == &(m.integration_costs)) {
+        m.allocateArrayOfIntegrationCosts();
+      }
+    }
+    forEachChunk(opts.thread_pool, chunks.size(), [&](const size_type c) {
+      const auto& chunk = chunks[c];
+      auto* const v = destinations[chunk.record];
+      if (v == nullptr) {
+        return;
+      }
+      const auto& r = d.records[chunk.record];
+      std::memcpy(reinterpret_cast<char*>(v->data()) + chunk.begin,
+                  file.data + r.offset + chunk.begin, chunk.end - chunk.begin);
+    });
+    // remaining data
+    using Fields = std::map<std::string, MaterialStateManager::FieldHolder>;
+    for (const auto& r : d.records) {
+      auto* const s = getState(r.name);
+      if (s == nullptr) {
+        continue;
+      }
+      const auto n = r.name.substr(3);
+      if ((n == "internal_state_variables") && (!same_layout)) {
+        remapInternalStateVariables(*s, i.isvs, getValues(r));
+        continue;
+      }
+      const auto mp = std::string{"material_properties/"};
+      const auto esv = std::string{"external_state_variables/"};
+      auto* fields = static_cast<Fields*>(nullptr);
+      auto fn = std::string{};
+      if (n.compare(0, mp.size(), mp) == 0) {
+        fields = &(s->material_properties);
+        fn = n.substr(mp.size());
+      } else if (n.compare(0, esv.size(), esv) == 0) {
+        fields = &(s->external_state_variables);
+        fn = n.substr(esv.size());
+      } else {
+        continue;
+      }
+      if (r.uniform) {
+        (*fields)[fn] = r.value;
+        continue;
+      }
+      const auto* const values = getValues(r);
+      const auto pf = fields->find(fn);
+      if ((pf != fields->end()) &&
+          (std::holds_alternative<mgis::span<real>>(pf->second))) {
+        // externally allocated memory is updated in place
+        auto& v = std::get<mgis::span<real>>(pf->second);
+        if (static_cast<std::uint64_t>(v.size()) == r.size) {
+          std::copy(values, values + r.size, v.begin());
+          continue;
+        }
+      }
+      (*fields)[fn] = std::vector<real>(values, values + r.size);
+    }
+    m.rdt = d.rdt;
+  }  // end of restoreCheckpoint
+
+}  // end of namespace mgis::behaviour
@@ -0,0 +1,126 @@
+/*!
+ * \file   ElasticPredictor.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "MGIS/Raise.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+#include "MGIS/Behaviour/ElasticPredictor.hxx"
+
+namespace mgis::behaviour {
+
+  /*!
+   * \return the elastic stiffness computed by the behaviour at the first
+   * integration point
+   * \param[in,out] m: material data manager
+   */
+  static std::vector<real> computeElasticStiffness(MaterialDataManager& m) {
+    auto opts = BehaviourIntegrationOptions{};
+    opts.integration_type = IntegrationType::PREDICTION_ELASTIC_OPERATOR;
+    const auto r = integrate(m, opts, real{0}, 0, 1);
+    if (r.exit_status == -1) {
+      mgis::raise(
+          "makeLinearElasticKernel: "
+          "computation of the elastic stiffness failed (" +
+          r.error_message + ")");
+    }
+    auto D = std::vector<real>(getTangentOperatorArraySize(m.b));
+    getTangentOperatorBlocks(D, m, 0);
+    return D;
+  }  // end of computeElasticStiffness
+
+  ElasticPredictor::Kernel makeLinearElasticKernel(MaterialDataManager& m,
+                                                   const std::string_view eel) {
+    if ((m.b.gradients.size() != 1) || (m.b.thermodynamic_forces.size() != 1)) {
+      mgis::raise(
+          "makeLinearElasticKernel: "
+          "the behaviour must have exactly one gradient and one "
+          "thermodynamic force");
+    }
+    if (m.n == 0) {
+      mgis::raise("makeLinearElasticKernel: no integration point");
+    }
+    const auto gsize = m.s0.gradients_stride;
+    const auto tsize = m.s0.thermodynamic_forces_stride;
+    if (gsize != tsize) {
+      mgis::raise(
+          "makeLinearElasticKernel: "
+          "the sizes of the gradient and the thermodynamic force differ");
+    }
+    m.allocateArrayOfTangentOperatorBlocks();
+    if (getTangentOperatorArraySize(m.b) != gsize * tsize) {
+      mgis::raise("makeLinearElasticKernel: unsupported tangent operator");
+    }
+    auto eel_offset = size_type{};
+    const auto has_eel = !eel.empty();
+    if (has_eel) {
+      const auto n = std::string{eel};
+      const auto& v = getVariable(m.b.isvs, n);
+      if (getVariableSize(v, m.b.hypothesis) != gsize) {
+        mgis::raise("makeLinearElasticKernel: the size of variable '" +
+                    n + "' does not match the size of the gradient");
+      }
+      eel_offset = getVariableOffset(m.b.isvs, n, m.b.hypothesis);
+    }
+    auto D = computeElasticStiffness(m);
+    return [D = std::move(D), gsize, tsize, has_eel, eel_offset](
+               MaterialDataManager& d, const BehaviourIntegrationOptions& opts,
+               const real, const size_type i) {
+      if (opts.compute_speed_of_sound) {
+        mgis::raise(
+            "makeLinearElasticKernel: "
+            "computation of the speed of sound is not supported");
+      }
+      const auto* const g0 = d.s0.gradients.data() + gsize * i;
+      const auto* const g1 = d.s1.gradients.data() + gsize * i;
+      const auto* const t0 = d.s0.thermodynamic_forces.data() + tsize * i;
+      auto* const t1 = d.s1.thermodynamic_forces.data() + tsize * i;
+      auto w = real{};
+      for (size_type r = 0; r != tsize; ++r) {
+        auto v = t0[r];
+        for (size_type c = 0; c != gsize; ++c) {
+          v += D[r * gsize + c] * (g1[c] - g0[c]);
+        }
+        t1[r] = v;
+        w += (t0[r] + v) * (g1[r] - g0[r]) / 2;
+      }
+      const auto isvs_stride = d.s0.internal_state_variables_stride;
+      const auto* const isvs0 =
+          d.s0.internal_state_variables.data() + isvs_stride * i;
+      auto* const isvs1 = d.s1.internal_state_variables.data() + isvs_stride * i;
+      std::copy(isvs0, isvs0 + isvs_stride, isvs1);
+      if (has_eel) {
+        for (size_type c = 0; c != gsize; ++c) {
+          isvs1[eel_offset + c] += g1[c] - g0[c];
+        }
+      }
+      if (d.b.computesStoredEnergy) {
+        d.s1.stored_energies[i] = d.s0.stored_energies[i] + w;
+      }
+      if (d.b.computesDissipatedEnergy) {
+        d.s1.dissipated_energies[i] = d.s0.dissipated_energies[i];
+      }
+      if ((opts.integration_type !=
+           IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR) &&
+          (d.K_stride != 0)) {
+        setTangentOperatorBlocks(d, i, D);
+      }
+      return 1;
+    };
+  }  // end of makeLinearElasticKernel
+
+}  // end of namespace mgis::behaviour
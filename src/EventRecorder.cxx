@@ -0,0 +1,210 @@
+/*!
+ * \file   EventRecorder.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <thread>
+#include <ostream>
+#include <algorithm>
+#include "MGIS/Raise.hxx"
+#include "MGIS/EventRecorder.hxx"
+
+namespace mgis {
+
+  struct EventRecorder::Buffer {
+    /*!
+     * \brief constructor
+     * \param[in] i: index of the thread
+     * \param[in] n: capacity
+     */
+    Buffer(const size_type i, const size_type n)
+        : thread_id(std::this_thread::get_id()), index(i), events(n) {}
+    //! \brief identifier of the thread
+    const std::thread::id thread_id;
+    //! \brief index of the thread
+    const size_type index;
+    //! \brief events
+    std::vector<Event> events;
+    //! \brief total number of events recorded
+    std::atomic<size_type> head = 0;
+  };  // end of struct EventRecorder::Buffer
+
+  //! \return a new identifier for an event recorder
+  static std::uint64_t getNewEventRecorderIdentifier() {
+    static std::atomic<std::uint64_t> counter = 0;
+    return ++counter;
+  }  // end of getNewEventRecorderIdentifier
+
+  //! \brief the event recorder used by the current thread
+  static thread_local EventRecorder* thread_event_recorder = nullptr;
+
+  EventRecorder::EventRecorder(const size_type n)
+      : start(std::chrono::steady_clock::now()),
+        identifier(getNewEventRecorderIdentifier()),
+        capacity(n),
+        tasks_counter(0) {
+    if (n == 0) {
+      mgis::raise("EventRecorder::EventRecorder: invalid capacity");
+    }
+  }  // end of EventRecorder
+
+  EventRecorder::Buffer& EventRecorder::getBuffer() {
+    // cache of the buffer used by the last event recorder used by the thread
+    thread_local std::uint64_t cached_recorder = 0;
+    thread_local Buffer* cached_buffer = nullptr;
+    if (cached_recorder == this->identifier) {
+      return *cached_buffer;
+    }
+    const auto id = std::this_thread::get_id();
+    std::lock_guard<std::mutex> lock(this->m);
+    auto p = std::find_if(this->buffers.begin(), this->buffers.end(),
+                          [&id](const std::unique_ptr<Buffer>& b) {
+                            return b->thread_id == id;
+                          });
+    if (p == this->buffers.end()) {
+      this->buffers.push_back(
+          std::make_unique<Buffer>(this->buffers.size(), this->capacity));
+      p = std::prev(this->buffers.end());
+    }
+    cached_recorder = this->identifier;
+    cached_buffer = p->get();
+    return *cached_buffer;
+  }  // end of getBuffer
+
+  void EventRecorder::record(const EventType t,
+                             const char* const n,
+                             const std::uint64_t i) {
+    const auto now = std::chrono::steady_clock::now();
+    auto& b = this->getBuffer();
+    const auto pos = b.head.load(std::memory_order_relaxed);
+    auto& e = b.events[pos % this->capacity];
+    e.type = t;
+    e.name = n;
+    e.id = i;
+    e.time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 now - this->start)
+                 .count();
+    b.head.store(pos + 1, std::memory_order_release);
+  }  // end of record
+
+  std::uint64_t EventRecorder::getNewTaskIdentifier() {
+    return ++(this->tasks_counter);
+  }  // end of getNewTaskIdentifier
+
+  std::vector<EventRecorder::ThreadEvents> EventRecorder::getEvents() const {
+    auto r = std::vector<ThreadEvents>{};
+    std::lock_guard<std::mutex> lock(this->m);
+    r.reserve(this->buffers.size());
+    for (const auto& b : this->buffers) {
+      const auto n = b->head.load(std::memory_order_acquire);
+      const auto s = std::min(n, this->capacity);
+      auto te = ThreadEvents{};
+      te.thread = b->index;
+      te.lost = n - s;
+      te.events.reserve(s);
+      for (size_type i = n - s; i != n; ++i) {
+        te.events.push_back(b->events[i % this->capacity]);
+      }
+      r.push_back(std::move(te));
+    }
+    return r;
+  }  // end of getEvents
+
+  void EventRecorder::clear() {
+    std::lock_guard<std::mutex> lock(this->m);
+    for (auto& b : this->buffers) {
+      b->head.store(0, std::memory_order_release);
+    }
+  }  // end of clear
+
+  EventRecorder::~EventRecorder() = default;
+
+  void setThreadEventRecorder(EventRecorder* const r) {
+    thread_event_recorder = r;
+  }  // end of setThreadEventRecorder
+
+  EventRecorder* getThreadEventRecorder() {
+    return thread_event_recorder;
+  }  // end of getThreadEventRecorder
+
+  EventRegion::EventRegion(const char* const n)
+      : recorder(thread_event_recorder), name(n) {
+    if (this->recorder != nullptr) {
+      this->recorder->record(EventRecorder::REGION_BEGIN, this->name);
+    }
+  }  // end of EventRegion
+
+  EventRegion::~EventRegion() {
+    if (this->recorder != nullptr) {
+      this->recorder->record(EventRecorder::REGION_END, this->name);
+    }
+  }  // end of ~EventRegion
+
+  /*!
+   * \brief print an event using the `JSON` trace event format
+   * \param[in] os: output stream
+   * \param[in] e: event
+   * \param[in] t: index of the thread
+   */
+  static void print_chrome_trace_event(std::ostream& os,
+                                       const EventRecorder::Event& e,
+                                       const size_type t) {
+    const auto ts = static_cast<double>(e.time) / 1000;
+    auto print = [&os, &e, t, ts](const char* const ph, const char* const n,
+                                  const char* const extra) {
+      os << ",\n    {\"name\": \"" << n << "\", \"ph\": \"" << ph
+         << "\", \"ts\": " << ts << ", \"pid\": 0, \"tid\": " << t << extra;
+      if (e.id != 0) {
+        os << ", \"id\": " << e.id << ", \"args\": {\"task\": " << e.id << "}";
+      }
+      os << "}";
+    };
+    switch (e.type) {
+      case EventRecorder::TASK_ENQUEUE:
+        print("i", "enqueue", ", \"s\": \"t\"");
+        // flow event linking the enqueue and the execution of the task
+        print("s", "task", ", \"cat\": \"task\"");
+        break;
+      case EventRecorder::TASK_BEGIN:
+        print("B", e.name, "");
+        print("f", "task", ", \"cat\": \"task\", \"bp\": \"e\"");
+        break;
+      case EventRecorder::TASK_END:
+      case EventRecorder::REGION_END:
+        print("E", e.name, "");
+        break;
+      case EventRecorder::REGION_BEGIN:
+        print("B", e.name, "");
+        break;
+    }
+  }  // end of print_chrome_trace_event
+
+  void print_chrome_trace(std::ostream& os, const EventRecorder& r) {
+    const auto events = r.getEvents();
+    const auto prec = os.precision(15);
+    os << "{\n  \"displayTimeUnit\": \"ns\",\n"
+       << "  \"traceEvents\": [\n"
+       << "    {\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 0, "
+       << "\"args\": {\"name\": \"mgis\"}}";
+    for (const auto& te : events) {
+      os << ",\n    {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, "
+         << "\"tid\": " << te.thread << ", \"args\": {\"name\": \"thread "
+         << te.thread << "\"}}";
+      for (const auto& e : te.events) {
+        print_chrome_trace_event(os, e, te.thread);
+      }
+    }
+    os << "\n  ]\n}\n";
+    os.precision(prec);
+  }  // end of print_chrome_trace
+
+}  // end of namespace mgis
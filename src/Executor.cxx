@@ -0,0 +1,125 @@
+/*!
+ * \file   Executor.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <future>
+#ifdef MGIS_HAVE_OPENMP
+#include <omp.h>
+#endif /* MGIS_HAVE_OPENMP */
+#include "MGIS/Raise.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Executor.hxx"
+
+namespace mgis {
+
+  Executor::~Executor() = default;
+
+  ThreadPoolExecutor::ThreadPoolExecutor(ThreadPool& p) : pool(p) {}
+
+  size_type ThreadPoolExecutor::getNumberOfChunks() const {
+    return this->pool.getNumberOfThreads();
+  }  // end of ThreadPoolExecutor::getNumberOfChunks
+
+  void ThreadPoolExecutor::execute(
+      const size_type n, const std::function<void(size_type)>& f) {
+    std::vector<std::future<ThreadedTaskResult<void>>> tasks;
+    tasks.reserve(n);
+    for (size_type i = 0; i != n; ++i) {
+      tasks.push_back(this->pool.addTask([&f, i] { f(i); }));
+    }
+    for (auto& t : tasks) {
+      t.wait();
+    }
+  }  // end of ThreadPoolExecutor::execute
+
+  ThreadPoolExecutor::~ThreadPoolExecutor() = default;
+
+  bool OpenMPExecutor::isAvailable() {
+#ifdef MGIS_HAVE_OPENMP
+    return true;
+#else  /* MGIS_HAVE_OPENMP */
+    return false;
+#endif /* MGIS_HAVE_OPENMP */
+  }    // end of OpenMPExecutor::isAvailable
+
+  OpenMPExecutor::OpenMPExecutor(const size_type n) : nchunks(n) {
+#ifdef MGIS_HAVE_OPENMP
+    if (this->nchunks == 0) {
+      this->nchunks = static_cast<size_type>(omp_get_max_threads());
+    }
+#else  /* MGIS_HAVE_OPENMP */
+    mgis::raise(
+        "OpenMPExecutor::OpenMPExecutor: "
+        "MGIS was compiled without OpenMP support");
+#endif /* MGIS_HAVE_OPENMP */
+  }    // end of OpenMPExecutor::OpenMPExecutor
+
+  size_type OpenMPExecutor::getNumberOfChunks() const {
+    return this->nchunks;
+  }  // end of OpenMPExecutor::getNumberOfChunks
+
+  void OpenMPExecutor::execute(
+      const size_type n, const std::function<void(size_type)>& f) {
+#ifdef MGIS_HAVE_OPENMP
+    const auto ni = static_cast<long long>(n);
+    if (omp_in_parallel()) {
+#pragma omp taskgroup
+      {
+        for (long long i = 0; i < ni; ++i) {
+#pragma omp task firstprivate(i) shared(f)
+          f(static_cast<size_type>(i));
+        }
+      }
+    } else {
+#pragma omp parallel for schedule(dynamic, 1)
+      for (long long i = 0; i < ni; ++i) {
+        f(static_cast<size_type>(i));
+      }
+    }
+#else  /* MGIS_HAVE_OPENMP */
+    for (size_type i = 0; i != n; ++i) {
+      f(i);
+    }
+#endif /* MGIS_HAVE_OPENMP */
+  }    // end of OpenMPExecutor::execute
+
+  OpenMPExecutor::~OpenMPExecutor() = default;
+
+  CallbackExecutor::CallbackExecutor(ExecutorCallback c,
+                                     void* const d,
+                                     const size_type n)
+      : callback(c), data(d), nchunks(n) {
+    if (this->callback == nullptr) {
+      mgis::raise("CallbackExecutor::CallbackExecutor: invalid callback");
+    }
+    if (this->nchunks == 0) {
+      mgis::raise("CallbackExecutor::CallbackExecutor: invalid number of chunks");
+    }
+  }  // end of CallbackExecutor::CallbackExecutor
+
+  size_type CallbackExecutor::getNumberOfChunks() const {
+    return this->nchunks;
+  }  // end of CallbackExecutor::getNumberOfChunks
+
+  void CallbackExecutor::execute(
+      const size_type n, const std::function<void(size_type)>& f) {
+    auto chunk = [](void* const ctx, const size_type i) {
+      (*static_cast<const std::function<void(size_type)>*>(ctx))(i);
+    };
+    this->callback(this->data, n, chunk,
+                   const_cast<std::function<void(size_type)>*>(&f));
+  }  // end of CallbackExecutor::execute
+
+  CallbackExecutor::~CallbackExecutor() = default;
+
+}  // end of namespace mgis
@@ -12,7 +12,9 @@
  *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
  */
 
+#include <vector>
 #include "MGIS/Raise.hxx"
+#include "MGIS/Profiling.hxx"
 #include "MGIS/Behaviour/Hypothesis.hxx"
 #include "MGIS/Behaviour/Behaviour.hxx"
 #include "MGIS/Behaviour/BehaviourData.hxx"
@@ -154,6 +156,7 @@ namespace mgis::behaviour {
   void convertFiniteStrainStress(mgis::span<real>& s,
                                  const MaterialDataManager& m,
                                  const FiniteStrainStress t) {
+    MGIS_PROFILING_TIMER(timer, CONVERT_FINITE_STRAIN_STRESS, m.n);
     const auto h = m.b.hypothesis;
     if (t == FiniteStrainStress::PK1) {
       if (h == Hypothesis::TRIDIMENSIONAL) {
@@ -716,9 +719,16 @@ namespace mgis::behaviour {
     const auto dP_stride = ts * ts;
     // stride associated with m.K
     const auto ds_stride = ss * ts;
+    // buffer used if the tangent operator blocks are not stored densely
+    auto ds_buffer = std::vector<mgis::real>(
+        requiresConversion(m.K_storage) ? ds_stride : 0);
     for (auto i = b; i != e; ++i) {
       auto* const dP_l = dP + dP_stride * i;
-      const auto* const ds_l = ds + ds_stride * i;
+      if (!ds_buffer.empty()) {
+        getTangentOperatorBlocks(ds_buffer, m, i);
+      }
+      const auto* const ds_l =
+          ds_buffer.empty() ? ds + ds_stride * i : ds_buffer.data();
       const auto* const F_l = F + ts * i;
       const auto* const s_l = s + ss * i;
       convertFiniteStrainTangentOperator_PK1_2D(dP_l, ds_l, F_l, s_l);
@@ -742,9 +752,16 @@ namespace mgis::behaviour {
     const auto dP_stride = ts * ts;
     // stride associated with m.K
     const auto ds_stride = ss * ts;
+    // buffer used if the tangent operator blocks are not stored densely
+    auto ds_buffer = std::vector<mgis::real>(
+        requiresConversion(m.K_storage) ? ds_stride : 0);
     for (auto i = b; i != e; ++i) {
       auto* const dP_l = dP + dP_stride * i;
-      const auto* const ds_l = ds + ds_stride * i;
+      if (!ds_buffer.empty()) {
+        getTangentOperatorBlocks(ds_buffer, m, i);
+      }
+      const auto* const ds_l =
+          ds_buffer.empty() ? ds + ds_stride * i : ds_buffer.data();
       const auto* const F_l = F + ts * i;
       const auto* const s_l = s + ss * i;
       convertFiniteStrainTangentOperator_PK1_3D(dP_l, ds_l, F_l, s_l);
@@ -796,6 +813,7 @@ namespace mgis::behaviour {
   void convertFiniteStrainTangentOperator(mgis::span<mgis::real>& K,
                                           const MaterialDataManager& m,
                                           const FiniteStrainTangentOperator t) {
+    MGIS_PROFILING_TIMER(timer, CONVERT_FINITE_STRAIN_TANGENT_OPERATOR, m.n);
     const auto h = m.b.hypothesis;
     if (t == FiniteStrainTangentOperator::DPK1_DF) {
       if (h == Hypothesis::TRIDIMENSIONAL) {
@@ -12,15 +12,23 @@
  */
 
 #include <map>
+#include <limits>
 #include <tuple>
+#include <atomic>
+#include <chrono>
 #include <thread>
 #include <memory>
 #include <cstdlib>
 #include <cinttypes>
 #include "MGIS/Raise.hxx"
+#include "MGIS/Profiling.hxx"
+#include "MGIS/EventRecorder.hxx"
 #include "MGIS/ThreadPool.hxx"
+#include "MGIS/Executor.hxx"
+#include "MGIS/Partition.hxx"
 #include "MGIS/Behaviour/MaterialDataManager.hxx"
 #include "MGIS/Behaviour/Integrate.hxx"
+#include "MGIS/Behaviour/IntegrateAsync.hxx"
 
 namespace mgis::behaviour::internals {
 
@@ -33,6 +41,9 @@ namespace mgis::behaviour::internals {
     if (opts.compute_speed_of_sound) {
       m.allocateArrayOfSpeedOfSounds();
     }
+    if (opts.measure_integration_costs) {
+      m.allocateArrayOfIntegrationCosts();
+    }
   }  // end of allocate
 
   static mgis::real encodeBehaviourIntegrationOptions(
@@ -53,7 +64,7 @@ namespace mgis::behaviour::internals {
    * fields, we return the information needed to evaluate them
    */
   static inline std::vector<Evaluator> buildEvaluator(
-      std::vector<real>& v,
+      BehaviourIntegrationWorkSpace::Storage& v,
       std::map<std::string, MaterialStateManager::FieldHolder>& values,
       const MaterialDataManager& m,
       const std::vector<Variable>& ds) {
@@ -106,9 +117,10 @@ namespace mgis::behaviour::internals {
     return evaluators;
   }  // end of buildEvaluator
 
-  static inline void applyEvaluators(std::vector<real>& values,
-                                     const std::vector<Evaluator>& evs,
-                                     const size_type i) {
+  static inline void applyEvaluators(
+      BehaviourIntegrationWorkSpace::Storage& values,
+      const std::vector<Evaluator>& evs,
+      const size_type i) {
     for (const auto& ev : evs) {
       const auto o = std::get<0>(ev);
       const auto s = std::get<1>(ev);
@@ -151,7 +163,7 @@ namespace mgis::behaviour::internals {
 
   static inline BehaviourEvaluators buildBehaviourEvaluators(
       BehaviourIntegrationWorkSpace& ws, MaterialDataManager& m) {
-    //
+    MGIS_PROFILING_TIMER(timer, BUILD_EVALUATORS, 0);
     auto evaluators = BehaviourEvaluators{};
     // treating uniform values
     evaluators.mps0 = internals::buildEvaluator(
@@ -193,6 +205,7 @@ namespace mgis::behaviour::internals {
   static inline void updateView(mgis::behaviour::BehaviourDataView& v,
                                 const mgis::behaviour::MaterialDataManager& m,
                                 const size_type i) {
+    MGIS_PROFILING_TIMER(timer, UPDATE_VIEW, 1);
     // strides
     const auto g_stride = m.s0.gradients_stride;
     const auto t_stride = m.s0.thermodynamic_forces_stride;
@@ -235,15 +248,58 @@ namespace mgis::behaviour::internals {
     }
   }  // end of checkIntegrationPointsRange
 
+  static inline void checkIntegrationPoints(
+      const mgis::behaviour::MaterialDataManager& m,
+      mgis::span<const size_type> indices) {
+    for (const auto i : indices) {
+      if (i >= m.n) {
+        mgis::raise(
+            "checkIntegrationPoints: "
+            "invalid integration point index ('" +
+            std::to_string(i) + "')");
+      }
+    }
+  }  // end of checkIntegrationPoints
+
+  //! \brief a contiguous range of integration points
+  struct IntegrationPointsRange {
+    //! \return the number of integration points
+    size_type size() const { return this->e - this->b; }
+    //! \return the index of the k-th integration point
+    size_type operator[](const size_type k) const { return this->b + k; }
+    //! \brief first index of the range
+    const size_type b;
+    //! \brief last index of the range
+    const size_type e;
+  };  // end of struct IntegrationPointsRange
+
+  //! \brief an arbitrary list of integration points
+  struct IntegrationPointsList {
+    //! \return the number of integration points
+    size_type size() const { return this->e - this->b; }
+    //! \return the index of the k-th integration point
+    size_type operator[](const size_type k) const {
+      return this->indices[this->b + k];
+    }
+    //! \brief indices of the integration points
+    const size_type* const indices;
+    //! \brief first position in the list
+    const size_type b;
+    //! \brief last position in the list
+    const size_type e;
+  };  // end of struct IntegrationPointsList
+
   /*!
    * \brief execute the given initialize function over a range of integration
    * points.
    */
+  template <typename IntegrationPoints>
   static BehaviourIntegrationResult executeInitializeFunction(
       MaterialDataManager& m,
       const BehaviourInitializeFunction p,
-      const mgis::size_type b,
-      const mgis::size_type e) {
+      const IntegrationPoints& points) {
+    MGIS_PROFILING_TIMER(timer, INITIALIZE_FUNCTION, points.size());
+    EventRegion region("initialize_function");
     // workspace
     auto& ws = m.getBehaviourIntegrationWorkSpace();
     auto v = internals::initializeBehaviourDataView(ws);
@@ -251,15 +307,19 @@ namespace mgis::behaviour::internals {
     v.rdt = nullptr;
     // loop over integration points
     auto r = BehaviourIntegrationResult{};
-    for (auto i = b; i != e; ++i) {
+    for (size_type k = 0; k != points.size(); ++k) {
+      const auto i = points[k];
       internals::evaluate(ws, behaviour_evaluators, i);
       internals::updateView(v, m, i);
       v.dt = mgis::real{};
       const auto ri = (p.f)(&v, nullptr);
       if (ri != 0) {
+        r.exit_status = -1;
         r.n = i;
         v.error_message[511] = '\0';
         r.error_message = std::string(v.error_message);
+        MGIS_PROFILING_SET_NUMBER_OF_POINTS(timer, k + 1);
+        MGIS_PROFILING_SET_FAILURE(timer);
         return r;
       }
     }
@@ -270,13 +330,15 @@ namespace mgis::behaviour::internals {
    * \brief execute the given initialize function over a range of integration
    * points.
    */
+  template <typename IntegrationPoints>
   static BehaviourIntegrationResult executeInitializeFunction(
       MaterialDataManager& m,
       const BehaviourInitializeFunction p,
       mgis::span<const real> inputs,
       const mgis::size_type inputs_stride,
-      const mgis::size_type b,
-      const mgis::size_type e) {
+      const IntegrationPoints& points) {
+    MGIS_PROFILING_TIMER(timer, INITIALIZE_FUNCTION, points.size());
+    EventRegion region("initialize_function");
     // workspace
     auto& ws = m.getBehaviourIntegrationWorkSpace();
     auto v = internals::initializeBehaviourDataView(ws);
@@ -285,56 +347,254 @@ namespace mgis::behaviour::internals {
     // loop over integration points
     auto r = BehaviourIntegrationResult{};
     const auto* const inputs_values = inputs.data();
-    for (auto i = b; i != e; ++i) {
+    for (size_type k = 0; k != points.size(); ++k) {
+      const auto i = points[k];
       internals::evaluate(ws, behaviour_evaluators, i);
       internals::updateView(v, m, i);
       v.dt = mgis::real{};
       const auto ri = (p.f)(&v, inputs_values + inputs_stride * i);
       if (ri != 0) {
+        r.exit_status = -1;
         r.n = i;
         v.error_message[511] = '\0';
         r.error_message = std::string(v.error_message);
+        MGIS_PROFILING_SET_NUMBER_OF_POINTS(timer, k + 1);
+        MGIS_PROFILING_SET_FAILURE(timer);
         return r;
       }
     }
     return r;
   }  // end of executeInitializeFunction
 
+  //! \brief a simple alias
+  using PostProcessingCall = std::tuple<const BehaviourPostProcessing*,
+                                        real*,       // outputs
+                                        size_type>;  // outputs stride
+
+  /*!
+   * \brief execute the post-processings at the given integration point.
+   * \return true on success.
+   */
+  static inline bool executePostProcessings(
+      BehaviourDataView& v,
+      const std::vector<PostProcessingCall>& pcalls,
+      const size_type i) {
+    if (pcalls.empty()) {
+      return true;
+    }
+    const auto dt = v.dt;
+    v.dt = mgis::real{};
+    for (const auto& pcall : pcalls) {
+      const auto& p = *(std::get<0>(pcall));
+      auto* const outputs = std::get<1>(pcall) + std::get<2>(pcall) * i;
+      if ((p.f)(outputs, &v) != 0) {
+        v.dt = dt;
+        return false;
+      }
+    }
+    v.dt = dt;
+    return true;
+  }  // end of executePostProcessings
+
+  /*!
+   * \brief check that the given reductions can be computed
+   * \param[in] m: material data manager
+   * \param[in] opts: integration options
+   * \param[in] reductions: reductions
+   */
+  static void checkReductionRequests(
+      const MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const std::vector<ReductionRequest>& reductions) {
+    for (const auto& rr : reductions) {
+      if ((!rr.weights.empty()) &&
+          (static_cast<size_type>(rr.weights.size()) != m.n)) {
+        mgis::raise("integrate: invalid size of the weights of a reduction");
+      }
+      if (rr.quantity == ReducedQuantity::STABLE_TIME_STEP) {
+        if (static_cast<size_type>(rr.characteristic_lengths.size()) != m.n) {
+          mgis::raise(
+              "integrate: the reduction of the stable time step requires "
+              "the characteristic lengths of all the integration points");
+        }
+      } else if (!rr.characteristic_lengths.empty()) {
+        mgis::raise(
+            "integrate: characteristic lengths are only meaningful for the "
+            "reduction of the stable time step");
+      }
+      if (((rr.quantity == ReducedQuantity::SPEED_OF_SOUND) ||
+           (rr.quantity == ReducedQuantity::STABLE_TIME_STEP)) &&
+          (!opts.compute_speed_of_sound)) {
+        mgis::raise(
+            "integrate: the reduction of the speed of sound or of the stable "
+            "time step requires the computation of the speed of sound");
+      }
+      if ((rr.quantity == ReducedQuantity::STORED_ENERGY) &&
+          (!m.b.computesStoredEnergy)) {
+        mgis::raise("integrate: the behaviour does not compute the stored "
+                    "energy");
+      }
+      if ((rr.quantity == ReducedQuantity::DISSIPATED_ENERGY) &&
+          (!m.b.computesDissipatedEnergy)) {
+        mgis::raise("integrate: the behaviour does not compute the "
+                    "dissipated energy");
+      }
+    }
+  }  // end of checkReductionRequests
+
+  //! \return the neutral element of the given reduction operation
+  static real getNeutralElement(const ReductionOperation op) {
+    if (op == ReductionOperation::MIN) {
+      return std::numeric_limits<real>::max();
+    } else if (op == ReductionOperation::MAX) {
+      return std::numeric_limits<real>::lowest();
+    }
+    return real{0};
+  }  // end of getNeutralElement
+
+  //! \return the neutral elements of the given reductions
+  static std::vector<real> initializeReductions(
+      const std::vector<ReductionRequest>& reductions) {
+    auto values = std::vector<real>{};
+    values.reserve(reductions.size());
+    for (const auto& rr : reductions) {
+      values.push_back(getNeutralElement(rr.operation));
+    }
+    return values;
+  }  // end of initializeReductions
+
+  //! \brief combine two values using the given reduction operation
+  static real reduce(const ReductionOperation op, const real a, const real b) {
+    if (op == ReductionOperation::MIN) {
+      return std::min(a, b);
+    } else if (op == ReductionOperation::MAX) {
+      return std::max(a, b);
+    }
+    return a + b;
+  }  // end of reduce
+
+  /*!
+   * \return the weighted value of the reduced quantity at the given
+   * integration point
+   * \param[in] m: material data manager
+   * \param[in] rr: reduction
+   * \param[in] i: integration point
+   */
+  static real getReducedValue(const MaterialDataManager& m,
+                              const ReductionRequest& rr,
+                              const size_type i) {
+    const auto w = rr.weights.empty() ? real{1} : rr.weights[i];
+    switch (rr.quantity) {
+      case ReducedQuantity::SPEED_OF_SOUND:
+        return w * m.speed_of_sound[i];
+      case ReducedQuantity::STORED_ENERGY:
+        return w * m.s1.stored_energies[i];
+      case ReducedQuantity::DISSIPATED_ENERGY:
+        return w * m.s1.dissipated_energies[i];
+      case ReducedQuantity::STABLE_TIME_STEP:
+        break;
+    }
+    const auto c = m.speed_of_sound[i];
+    if (!(c > 0)) {
+      return std::numeric_limits<real>::max();
+    }
+    return w * rr.characteristic_lengths[i] / c;
+  }  // end of getReducedValue
+
+  /*!
+   * \brief combine the values of the reductions computed over the chunks,
+   * in the order of the chunks.
+   * \param[in,out] r: results
+   * \param[in] reductions: reductions
+   */
+  static void combineReductions(
+      MultiThreadedBehaviourIntegrationResult& r,
+      const std::vector<ReductionRequest>& reductions) {
+    r.reductions = initializeReductions(reductions);
+    for (const auto& rc : r.results) {
+      if (rc.reductions.size() != reductions.size()) {
+        continue;
+      }
+      for (size_type k = 0; k != reductions.size(); ++k) {
+        r.reductions[k] = reduce(reductions[k].operation, r.reductions[k],
+                                 rc.reductions[k]);
+      }
+    }
+  }  // end of combineReductions
+
   /*!
    * \brief perform the integration of the behaviour over a range of integration
-   * points.
+   * points, execute the given post-processings after each successful
+   * integration and compute the given reductions.
    */
+  template <typename IntegrationPoints>
   static BehaviourIntegrationResult integrate(
       MaterialDataManager& m,
       const BehaviourIntegrationOptions& opts,
       const real dt,
-      const size_type b,
-      const size_type e) {
+      const std::vector<PostProcessingCall>& pcalls,
+      const std::vector<ReductionRequest>& reductions,
+      const IntegrationPoints& points) {
+    MGIS_PROFILING_TIMER(timer, INTEGRATE, points.size());
+    EventRegion region("integrate");
     // workspace
     auto& ws = m.getBehaviourIntegrationWorkSpace();
     auto v = internals::initializeBehaviourDataView(ws);
     auto behaviour_evaluators = internals::buildBehaviourEvaluators(ws, m);
     // loop over integration points
     auto r = BehaviourIntegrationResult{};
+    r.reductions = initializeReductions(reductions);
     auto rdt0 = r.time_step_increase_factor;
     const real Ke = encodeBehaviourIntegrationOptions(opts);
     real bopts[Behaviour::nopts + 1];  // option passed to the behaviour
-    for (auto i = b; i != e; ++i) {
+    auto* const costs = opts.measure_integration_costs
+                            ? m.integration_costs.data()
+                            : nullptr;
+    const auto& ep = m.elastic_predictor;
+    const auto use_elastic_predictor =
+        ep.isEnabled() && (static_cast<int>(opts.integration_type) >= 0);
+    if ((use_elastic_predictor) && (!ep.kernel)) {
+      mgis::raise("integrate: no kernel defined for the elastic predictor");
+    }
+    const auto compute_tangent_operator =
+        (opts.integration_type !=
+         IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR) &&
+        (m.K_stride != 0);
+    const auto convert_tangent_operator = requiresConversion(m.K_storage);
+    for (size_type k = 0; k != points.size(); ++k) {
+      const auto i = points[k];
+      const auto start = (costs != nullptr)
+                             ? std::chrono::steady_clock::now()
+                             : std::chrono::steady_clock::time_point{};
       internals::evaluate(ws, behaviour_evaluators, i);
       internals::updateView(v, m, i);
       auto rdt = rdt0;
       v.error_message[0] = '\0';
       v.rdt = &rdt;
       v.dt = dt;
-      if ((opts.integration_type !=
-           IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR) &&
-          (m.K_stride != 0)) {
-        v.K = m.K.data() + m.K_stride * i;
+      if (compute_tangent_operator) {
+        // with a compact storage, the behaviour computes the dense tangent
+        // operator blocks in the workspace, which are converted afterwards
+        v.K = convert_tangent_operator ? ws.K.data()
+                                       : m.K.data() + m.K_stride * i;
       } else {
         v.K = &bopts[0];
       }
       v.K[0] = Ke;
-      const auto ri = integrate(v, m.b);
+      const auto use_kernel = use_elastic_predictor && ep.predicate(m, i);
+      auto ri = use_kernel ? ep.kernel(m, opts, dt, i) : integrate(v, m.b);
+      if ((ri != -1) && (compute_tangent_operator) &&
+          (convert_tangent_operator) && (!use_kernel)) {
+        setTangentOperatorBlocks(m, i, ws.K);
+      }
+      if ((ri != -1) && (!executePostProcessings(v, pcalls, i))) {
+        ri = -1;
+      }
+      if (costs != nullptr) {
+        costs[i] = std::chrono::duration<real>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+      }
       r.exit_status = std::min(ri, r.exit_status);
       r.time_step_increase_factor = std::min(rdt, r.time_step_increase_factor);
       if (ri == 0) {
@@ -343,23 +603,61 @@ namespace mgis::behaviour::internals {
         r.n = i;
         v.error_message[511] = '\0';
         r.error_message = std::string(v.error_message);
+        MGIS_PROFILING_SET_NUMBER_OF_POINTS(timer, k + 1);
+        MGIS_PROFILING_SET_FAILURE(timer);
         return r;
       }
+      for (size_type j = 0; j != reductions.size(); ++j) {
+        const auto& rr = reductions[j];
+        r.reductions[j] = reduce(rr.operation, r.reductions[j],
+                                 getReducedValue(m, rr, i));
+      }
     }
     return r;
   }  // end of integrate
 
+  /*!
+   * \brief perform the integration of the behaviour over a range of integration
+   * points and execute the given post-processings after each successful
+   * integration.
+   */
+  template <typename IntegrationPoints>
+  static BehaviourIntegrationResult integrate(
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt,
+      const std::vector<PostProcessingCall>& pcalls,
+      const IntegrationPoints& points) {
+    return integrate(m, opts, dt, pcalls, std::vector<ReductionRequest>{},
+                     points);
+  }  // end of integrate
+
+  /*!
+   * \brief perform the integration of the behaviour over a range of integration
+   * points.
+   */
+  template <typename IntegrationPoints>
+  static BehaviourIntegrationResult integrate(
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt,
+      const IntegrationPoints& points) {
+    return integrate(m, opts, dt, std::vector<PostProcessingCall>{}, points);
+  }  // end of integrate
+
   /*!
    * \brief execute the given post-processing over a range of integration
    * points.
    */
+  template <typename IntegrationPoints>
   static BehaviourIntegrationResult executePostProcessing(
       mgis::span<real> outputs,
       MaterialDataManager& m,
       const BehaviourPostProcessing p,
       const mgis::size_type outputs_stride,
-      const mgis::size_type b,
-      const mgis::size_type e) {
+      const IntegrationPoints& points) {
+    MGIS_PROFILING_TIMER(timer, POST_PROCESSING, points.size());
+    EventRegion region("post_processing");
     // workspace
     auto& ws = m.getBehaviourIntegrationWorkSpace();
     auto v = internals::initializeBehaviourDataView(ws);
@@ -368,21 +666,135 @@ namespace mgis::behaviour::internals {
     // loop over integration points
     auto r = BehaviourIntegrationResult{};
     auto* const outputs_values = outputs.data();
-    for (auto i = b; i != e; ++i) {
+    for (size_type k = 0; k != points.size(); ++k) {
+      const auto i = points[k];
       internals::evaluate(ws, behaviour_evaluators, i);
       internals::updateView(v, m, i);
       v.dt = mgis::real{};
       const auto ri = (p.f)(outputs_values + outputs_stride * i, &v);
       if (ri != 0) {
+        r.exit_status = -1;
         r.n = i;
         v.error_message[511] = '\0';
         r.error_message = std::string(v.error_message);
+        MGIS_PROFILING_SET_NUMBER_OF_POINTS(timer, k + 1);
+        MGIS_PROFILING_SET_FAILURE(timer);
         return r;
       }
     }
     return r;
   }  // end of executePostProcessing
 
+  /*!
+   * \brief gather the results of the chunks treated by an executor.
+   * \param[in] results: results of each chunk
+   */
+  static MultiThreadedBehaviourIntegrationResult gatherResults(
+      std::vector<ThreadedTaskResult<BehaviourIntegrationResult>>& results) {
+    auto res = MultiThreadedBehaviourIntegrationResult{};
+    res.results.reserve(results.size());
+    for (auto& r : results) {
+      const auto& ri = *r;
+      res.exit_status = std::min(res.exit_status, ri.exit_status);
+      res.results.push_back(ri);
+    }
+    return res;
+  }  // end of gatherResults
+
+  /*!
+   * \brief submit `f(bounds[i], bounds[i + 1])` for each sub-range defined by
+   * the given bounds to the given thread pool, without waiting for the
+   * completion of the tasks. If the threads of the pool are bound to
+   * processing units, the `i`-th sub-range is always processed by the same
+   * thread, so that the data placed on a NUMA node by a first-touch
+   * initialization are processed by a thread running on this node.
+   *
+   * \note if called from one of the threads of the pool, the tasks are added
+   * to the shared queue, since the task of the calling thread could only be
+   * processed once the calling thread returns.
+   * \return the submitted tasks
+   * \param[in] p: thread pool
+   * \param[in] bounds: bounds of the sub-ranges
+   * \param[in] f: function, shared by all the tasks
+   */
+  template <typename F>
+  static std::vector<AsyncBehaviourIntegrationResult::Task> submitOnThreadPool(
+      ThreadPool& p, const std::vector<size_type>& bounds, F&& f) {
+    auto tasks = std::vector<AsyncBehaviourIntegrationResult::Task>{};
+    tasks.reserve(bounds.size() - 1);
+    const auto pf = std::make_shared<std::decay_t<F>>(std::forward<F>(f));
+    const auto pinned =
+        (p.getThreadAffinityPolicy() != ThreadAffinityPolicy::NONE) &&
+        (!p.isWorkerThread());
+    const auto nth = p.getNumberOfThreads();
+    for (size_type i = 0; i + 1 < bounds.size(); ++i) {
+      auto t = [pf, b = bounds[i], ie = bounds[i + 1]] { return (*pf)(b, ie); };
+      // the task is moved in the pool, since passing an lvalue would only
+      // store a reference to this local variable
+      if (pinned) {
+        tasks.push_back(p.addTaskToThread(i % nth, std::move(t)));
+      } else {
+        tasks.push_back(p.addTask(std::move(t)));
+      }
+    }
+    return tasks;
+  }  // end of submitOnThreadPool
+
+  /*!
+   * \brief call `f(bounds[i], bounds[i + 1])` for each sub-range defined by
+   * the given bounds using the given thread pool and gather the results.
+   * \param[in] p: thread pool
+   * \param[in] bounds: bounds of the sub-ranges
+   * \param[in] f: function
+   */
+  template <typename F>
+  static MultiThreadedBehaviourIntegrationResult executeOnThreadPool(
+      ThreadPool& p, const std::vector<size_type>& bounds, F&& f) {
+    return AsyncBehaviourIntegrationResult{
+        submitOnThreadPool(p, bounds, std::forward<F>(f))}
+        .get();
+  }  // end of executeOnThreadPool
+
+  /*!
+   * \brief split the integration points in the given number of ranges. If
+   * the integration costs are available, the ranges are built so that their
+   * total costs are balanced.
+   * \param[in] m: material data manager
+   * \param[in] nchunks: number of ranges
+   */
+  static std::vector<size_type> getIntegrationRanges(
+      const MaterialDataManager& m, const size_type nchunks) {
+    if (m.integration_costs.empty()) {
+      return getUniformPartition(m.n, nchunks);
+    }
+    return getBalancedPartition(m.integration_costs, nchunks);
+  }  // end of getIntegrationRanges
+
+  /*!
+   * \brief split the given list of integration points in the given number of
+   * sub-lists. If the integration costs are available, the sub-lists are
+   * built so that their total costs are balanced. Otherwise, the sub-lists
+   * have the same number of integration points.
+   * \return the bounds of the sub-lists
+   * \param[in] m: material data manager
+   * \param[in] indices: list of integration points
+   * \param[in] nchunks: number of sub-lists
+   */
+  static std::vector<size_type> getIntegrationRanges(
+      const MaterialDataManager& m,
+      mgis::span<const size_type> indices,
+      const size_type nchunks) {
+    if (m.integration_costs.empty()) {
+      return getUniformPartition(indices.size(), nchunks);
+    }
+    auto costs = std::vector<real>{};
+    costs.reserve(indices.size());
+    for (const auto i : indices) {
+      costs.push_back(m.integration_costs[i]);
+    }
+    return getBalancedPartition(costs, nchunks);
+  }  // end of getIntegrationRanges
+
 }  // namespace mgis::behaviour::internals
 
 namespace mgis::behaviour {
@@ -425,6 +837,79 @@ namespace mgis::behaviour {
   MultiThreadedBehaviourIntegrationResult::
       ~MultiThreadedBehaviourIntegrationResult() = default;
 
+  AsyncBehaviourIntegrationResult::AsyncBehaviourIntegrationResult() =
+      default;
+
+  AsyncBehaviourIntegrationResult::AsyncBehaviourIntegrationResult(
+      std::vector<Task>&& t)
+      : tasks(std::move(t)) {}  // end of AsyncBehaviourIntegrationResult
+
+  AsyncBehaviourIntegrationResult::AsyncBehaviourIntegrationResult(
+      AsyncBehaviourIntegrationResult&&) = default;
+
+  AsyncBehaviourIntegrationResult& AsyncBehaviourIntegrationResult::operator=(
+      AsyncBehaviourIntegrationResult&& src) {
+    if (this != &src) {
+      this->wait();
+      this->tasks = std::move(src.tasks);
+      src.tasks.clear();
+    }
+    return *this;
+  }  // end of operator=
+
+  bool AsyncBehaviourIntegrationResult::valid() const {
+    return !this->tasks.empty();
+  }  // end of valid
+
+  bool AsyncBehaviourIntegrationResult::isReady() const {
+    for (const auto& t : this->tasks) {
+      if (t.valid() && (t.wait_for(std::chrono::seconds(0)) !=
+                        std::future_status::ready)) {
+        return false;
+      }
+    }
+    return true;
+  }  // end of isReady
+
+  void AsyncBehaviourIntegrationResult::wait() const {
+    MGIS_PROFILING_TIMER(timer, THREAD_POOL_WAIT, 0);
+    for (const auto& t : this->tasks) {
+      if (t.valid()) {
+        t.wait();
+      }
+    }
+  }  // end of wait
+
+  MultiThreadedBehaviourIntegrationResult
+  AsyncBehaviourIntegrationResult::get() {
+    auto ltasks = std::move(this->tasks);
+    this->tasks.clear();
+    MGIS_PROFILING_TIMER(timer, THREAD_POOL_WAIT, 0);
+    auto res = MultiThreadedBehaviourIntegrationResult{};
+    res.results.reserve(ltasks.size());
+    auto error = std::exception_ptr{};
+    for (auto& t : ltasks) {
+      try {
+        auto r = t.get();
+        const auto& ri = *r;
+        res.exit_status = std::min(res.exit_status, ri.exit_status);
+        res.results.push_back(ri);
+      } catch (...) {
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+    return res;
+  }  // end of get
+
+  AsyncBehaviourIntegrationResult::~AsyncBehaviourIntegrationResult() {
+    this->wait();
+  }  // end of ~AsyncBehaviourIntegrationResult
+
   static const BehaviourInitializeFunction& getBehaviourInitializeFunction(
       const Behaviour& b, const std::string_view n) {
     const auto p = b.initialize_functions.find(n);
@@ -479,7 +964,8 @@ namespace mgis::behaviour {
           "invalid size of the inputs '" +
           std::string{n} + "'");
     }
-    return internals::executeInitializeFunction(m, ifct, b, e);
+    const auto points = internals::IntegrationPointsRange{b, e};
+    return internals::executeInitializeFunction(m, ifct, points);
   }  // end of executeInitializeFunction
 
   BehaviourIntegrationResult executeInitializeFunction(
@@ -498,9 +984,12 @@ namespace mgis::behaviour {
           std::string{n} + "'");
     }
     if (inputs.size() == istride) {
-      return internals::executeInitializeFunction(m, ifct, inputs, 0, b, e);
+      const auto points = internals::IntegrationPointsRange{b, e};
+      return internals::executeInitializeFunction(m, ifct, inputs, 0, points);
     }
-    return internals::executeInitializeFunction(m, ifct, inputs, istride, b, e);
+    const auto points = internals::IntegrationPointsRange{b, e};
+    return internals::executeInitializeFunction(m, ifct, inputs, istride,
+                                                points);
   }  // end of executeInitializeFunction
 
   BehaviourIntegrationResult executeInitializeFunction(
@@ -528,33 +1017,12 @@ namespace mgis::behaviour {
           std::string{n} + "'");
     }
     m.setThreadSafe(true);
-    // get number of threads
-    const auto nth = p.getNumberOfThreads();
-    const auto d = m.n / nth;
-    const auto r = m.n % nth;
-    size_type b = 0;
-    std::vector<std::future<ThreadedTaskResult<BehaviourIntegrationResult>>>
-        tasks;
-    tasks.reserve(nth);
-    for (size_type i = 0; i != r; ++i) {
-      tasks.push_back(p.addTask([&m, &ifct, b, d] {
-        return internals::executeInitializeFunction(m, ifct, b, b + d + 1);
-      }));
-      b += d + 1;
-    }
-    for (size_type i = r; i != nth; ++i) {
-      tasks.push_back(p.addTask([&m, &ifct, b, d] {
-        return internals::executeInitializeFunction(m, ifct, b, b + d);
-      }));
-      b += d;
-    }
-    auto res = MultiThreadedBehaviourIntegrationResult{};
-    for (auto& t : tasks) {
-      const auto& ri = *(t.get());
-      res.exit_status = std::min(res.exit_status, ri.exit_status);
-      res.results.push_back(ri);
-    }
-    return res;
+    return internals::executeOnThreadPool(
+        p, getUniformPartition(m.n, p.getNumberOfThreads()),
+        [&m, &ifct](const size_type b, const size_type ie) {
+          const auto points = internals::IntegrationPointsRange{b, ie};
+          return internals::executeInitializeFunction(m, ifct, points);
+        });
   }  // end of executeInitializeFunction
 
   MultiThreadedBehaviourIntegrationResult executeInitializeFunction(
@@ -573,37 +1041,143 @@ namespace mgis::behaviour {
     // effective stride
     const auto estride = (inputs.size() == istride) ? 0 : istride;
     m.setThreadSafe(true);
-    // get number of threads
-    const auto nth = p.getNumberOfThreads();
-    const auto d = m.n / nth;
-    const auto r = m.n % nth;
-    size_type b = 0;
-    std::vector<std::future<ThreadedTaskResult<BehaviourIntegrationResult>>>
-        tasks;
-    tasks.reserve(nth);
-    for (size_type i = 0; i != r; ++i) {
-      tasks.push_back(p.addTask([&inputs, &m, &ifct, estride, b, d] {
-        return internals::executeInitializeFunction(m, ifct, inputs, estride, b,
-                                                    b + d + 1);
-      }));
-      b += d + 1;
-    }
-    for (size_type i = r; i != nth; ++i) {
-      tasks.push_back(p.addTask([&inputs, &m, &ifct, estride, b, d] {
-        return internals::executeInitializeFunction(m, ifct, inputs, estride, b,
-                                                    b + d);
-      }));
-      b += d;
+    return internals::executeOnThreadPool(
+        p, getUniformPartition(m.n, p.getNumberOfThreads()),
+        [&inputs, &m, &ifct, estride](const size_type b, const size_type ie) {
+          const auto points = internals::IntegrationPointsRange{b, ie};
+          return internals::executeInitializeFunction(m, ifct, inputs, estride,
+                                                      points);
+        });
+  }  // end of executeInitializeFunction
+
+  BehaviourIntegrationResult executeInitializeFunction(
+      MaterialDataManager& m,
+      const std::string_view n,
+      mgis::span<const size_type> indices) {
+    internals::checkIntegrationPoints(m, indices);
+    const auto& ifct = getBehaviourInitializeFunction(m.b, n);
+    if (!ifct.inputs.empty()) {
+      mgis::raise(
+          "executeInitializeFunction: "
+          "invalid size of the inputs '" +
+          std::string{n} + "'");
     }
-    auto res = MultiThreadedBehaviourIntegrationResult{};
-    for (auto& t : tasks) {
-      const auto& ri = *(t.get());
-      res.exit_status = std::min(res.exit_status, ri.exit_status);
-      res.results.push_back(ri);
+    const auto points = internals::IntegrationPointsList{
+        indices.data(), 0, static_cast<size_type>(indices.size())};
+    return internals::executeInitializeFunction(m, ifct, points);
+  }  // end of executeInitializeFunction
+
+  BehaviourIntegrationResult executeInitializeFunction(
+      MaterialDataManager& m,
+      const std::string_view n,
+      mgis::span<const real> inputs,
+      mgis::span<const size_type> indices) {
+    const auto& ifct = getBehaviourInitializeFunction(m.b, n);
+    const auto istride = getArraySize(ifct.inputs, m.b.hypothesis);
+    internals::checkIntegrationPoints(m, indices);
+    if ((inputs.size() != m.n * istride) && (inputs.size() != istride)) {
+      mgis::raise(
+          "executeInitializeFunction: "
+          "invalid size of the inputs '" +
+          std::string{n} + "'");
     }
-    return res;
+    // effective stride
+    const auto estride = (inputs.size() == istride) ? 0 : istride;
+    const auto points = internals::IntegrationPointsList{
+        indices.data(), 0, static_cast<size_type>(indices.size())};
+    return internals::executeInitializeFunction(m, ifct, inputs, estride,
+                                                points);
+  }  // end of executeInitializeFunction
+
+  MultiThreadedBehaviourIntegrationResult executeInitializeFunction(
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const std::string_view n,
+      mgis::span<const size_type> indices) {
+    internals::checkIntegrationPoints(m, indices);
+    const auto& ifct = getBehaviourInitializeFunction(m.b, n);
+    if (!ifct.inputs.empty()) {
+      mgis::raise(
+          "executeInitializeFunction: "
+          "invalid size of the inputs '" +
+          std::string{n} + "'");
+    }
+    m.setThreadSafe(true);
+    return internals::executeOnThreadPool(
+        p, getUniformPartition(indices.size(), p.getNumberOfThreads()),
+        [&m, &ifct, &indices](const size_type b, const size_type ie) {
+          const auto points =
+              internals::IntegrationPointsList{indices.data(), b, ie};
+          return internals::executeInitializeFunction(m, ifct, points);
+        });
   }  // end of executeInitializeFunction
 
+  MultiThreadedBehaviourIntegrationResult executeInitializeFunction(
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const std::string_view n,
+      mgis::span<const real> inputs,
+      mgis::span<const size_type> indices) {
+    const auto& ifct = getBehaviourInitializeFunction(m.b, n);
+    const auto istride = getArraySize(ifct.inputs, m.b.hypothesis);
+    internals::checkIntegrationPoints(m, indices);
+    if ((inputs.size() != m.n * istride) && (inputs.size() != istride)) {
+      mgis::raise(
+          "executeInitializeFunction: "
+          "invalid size of the inputs '" +
+          std::string{n} + "'");
+    }
+    // effective stride
+    const auto estride = (inputs.size() == istride) ? 0 : istride;
+    m.setThreadSafe(true);
+    return internals::executeOnThreadPool(
+        p, getUniformPartition(indices.size(), p.getNumberOfThreads()),
+        [&inputs, &m, &ifct, &indices, estride](const size_type b,
+                                                const size_type ie) {
+          const auto points =
+              internals::IntegrationPointsList{indices.data(), b, ie};
+          return internals::executeInitializeFunction(m, ifct, inputs, estride,
+                                                      points);
+        });
+  }  // end of executeInitializeFunction
+
+  static const BehaviourPostProcessing& getBehaviourPostProcessing(
+      const Behaviour& b, const std::string_view n) {
+    const auto p = b.postprocessings.find(n);
+    if (p == b.postprocessings.end()) {
+      mgis::raise(
+          "getBehaviourPostProcessing: "
+          "no postprocessing named '" +
+          std::string{n} + "'");
+    }
+    return p->second;
+  }  // end of getBehaviourPostProcessing
+
+  /*!
+   * \brief check the given post-processing requests and return the
+   * information needed to execute them
+   * \param[in] m: material data manager
+   * \param[in] requests: post-processing requests
+   */
+  static std::vector<internals::PostProcessingCall> getPostProcessingCalls(
+      const MaterialDataManager& m,
+      const std::vector<PostProcessingRequest>& requests) {
+    auto pcalls = std::vector<internals::PostProcessingCall>{};
+    pcalls.reserve(requests.size());
+    for (const auto& request : requests) {
+      const auto& p = getBehaviourPostProcessing(m.b, request.name);
+      const auto ostride = getArraySize(p.outputs, m.b.hypothesis);
+      if (request.outputs.size() != m.n * ostride) {
+        mgis::raise(
+            "integrate: "
+            "invalid size of the outputs of the post-processing '" +
+            request.name + "'");
+      }
+      pcalls.push_back(std::make_tuple(&p, request.outputs.data(), ostride));
+    }
+    return pcalls;
+  }  // end of getPostProcessingCalls
+
   int integrate(MaterialDataManager& m,
                 const IntegrationType it,
                 const real dt,
@@ -622,7 +1196,8 @@ namespace mgis::behaviour {
                                        const size_type e) {
     internals::allocate(m, opts);
     internals::checkIntegrationPointsRange(m, b, e);
-    return internals::integrate(m, opts, dt, b, e);
+    const auto points = internals::IntegrationPointsRange{b, e};
+    return internals::integrate(m, opts, dt, points);
   }  // end of integrate
 
   int integrate(ThreadPool& p,
@@ -642,46 +1217,300 @@ namespace mgis::behaviour {
       const real dt) {
     m.setThreadSafe(true);
     internals::allocate(m, opts);
-    // get number of threads
-    const auto nth = p.getNumberOfThreads();
-    const auto d = m.n / nth;
-    const auto r = m.n % nth;
-    size_type b = 0;
-    std::vector<std::future<ThreadedTaskResult<BehaviourIntegrationResult>>>
-        tasks;
-    tasks.reserve(nth);
-    for (size_type i = 0; i != r; ++i) {
-      tasks.push_back(p.addTask([&m, &opts, dt, b, d] {
-        return internals::integrate(m, opts, dt, b, b + d + 1);
-      }));
-      b += d + 1;
-    }
-    for (size_type i = r; i != nth; ++i) {
-      tasks.push_back(p.addTask([&m, &opts, dt, b, d] {
-        return internals::integrate(m, opts, dt, b, b + d);
-      }));
-      b += d;
+    return internals::executeOnThreadPool(
+        p, internals::getIntegrationRanges(m, p.getNumberOfThreads()),
+        [&m, &opts, dt](const size_type b, const size_type ie) {
+          const auto points = internals::IntegrationPointsRange{b, ie};
+          return internals::integrate(m, opts, dt, points);
+        });
+  }  // end of integrate
+
+  AsyncBehaviourIntegrationResult integrateAsync(
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt) {
+    m.setThreadSafe(true);
+    internals::allocate(m, opts);
+    return AsyncBehaviourIntegrationResult{internals::submitOnThreadPool(
+        p, internals::getIntegrationRanges(m, p.getNumberOfThreads()),
+        [&m, opts, dt](const size_type b, const size_type ie) {
+          const auto points = internals::IntegrationPointsRange{b, ie};
+          return internals::integrate(m, opts, dt, points);
+        })};
+  }  // end of integrateAsync
+
+  MultiThreadedBehaviourIntegrationResult integrate(
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt,
+      const IntegrationChunkCallback& c,
+      const size_type nchunks) {
+    return integrateAsync(p, m, opts, dt, c, nchunks).get();
+  }  // end of integrate
+
+  AsyncBehaviourIntegrationResult integrateAsync(
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt,
+      const IntegrationChunkCallback& c,
+      const size_type nchunks) {
+    if (!c) {
+      mgis::raise("integrateAsync: invalid callback");
     }
-    auto res = MultiThreadedBehaviourIntegrationResult{};
-    for (auto& t : tasks) {
-      const auto& ri = *(t.get());
-      res.exit_status = std::min(res.exit_status, ri.exit_status);
-      res.results.push_back(ri);
+    m.setThreadSafe(true);
+    internals::allocate(m, opts);
+    const auto n = (nchunks == 0) ? p.getNumberOfThreads() : nchunks;
+    // empty chunks are avoided
+    const auto nc = std::max(std::min(n, m.n), size_type{1});
+    return AsyncBehaviourIntegrationResult{internals::submitOnThreadPool(
+        p, internals::getIntegrationRanges(m, nc),
+        [&m, opts, dt, c](const size_type b, const size_type ie) {
+          const auto points = internals::IntegrationPointsRange{b, ie};
+          auto r = internals::integrate(m, opts, dt, points);
+          c(b, ie, r);
+          return r;
+        })};
+  }  // end of integrateAsync
+
+  int integrate(Executor& e,
+                MaterialDataManager& m,
+                const IntegrationType it,
+                const real dt) {
+    BehaviourIntegrationOptions opts;
+    opts.integration_type = it;
+    const auto r = integrate(e, m, opts, dt);
+    return r.exit_status;
+  }  // end of integrate
+
+  MultiThreadedBehaviourIntegrationResult integrate(
+      Executor& e,
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt) {
+    m.setThreadSafe(true);
+    internals::allocate(m, opts);
+    const auto nchunks = std::min(e.getNumberOfChunks(), m.n);
+    if (nchunks == 0) {
+      return MultiThreadedBehaviourIntegrationResult{};
     }
-    return res;
+    auto results = executeOverRanges(
+        e, internals::getIntegrationRanges(m, nchunks),
+        [&m, &opts, dt](const size_type b, const size_type ie) {
+          const auto points = internals::IntegrationPointsRange{b, ie};
+          return internals::integrate(m, opts, dt, points);
+        });
+    return internals::gatherResults(results);
   }  // end of integrate
 
-  static const BehaviourPostProcessing& getBehaviourPostProcessing(
-      const Behaviour& b, const std::string_view n) {
-    const auto p = b.postprocessings.find(n);
-    if (p == b.postprocessings.end()) {
-      mgis::raise(
-          "getBehaviourPostProcessing: "
-          "no postprocessing named '" +
-          std::string{n} + "'");
+  BehaviourIntegrationResult integrate(
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt,
+      const std::vector<PostProcessingRequest>& requests,
+      const size_type b,
+      const size_type e) {
+    const auto pcalls = getPostProcessingCalls(m, requests);
+    internals::allocate(m, opts);
+    internals::checkIntegrationPointsRange(m, b, e);
+    const auto points = internals::IntegrationPointsRange{b, e};
+    return internals::integrate(m, opts, dt, pcalls, points);
+  }  // end of integrate
+
+  MultiThreadedBehaviourIntegrationResult integrate(
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt,
+      const std::vector<PostProcessingRequest>& requests) {
+    const auto pcalls = getPostProcessingCalls(m, requests);
+    m.setThreadSafe(true);
+    internals::allocate(m, opts);
+    return internals::executeOnThreadPool(
+        p, internals::getIntegrationRanges(m, p.getNumberOfThreads()),
+        [&m, &opts, &pcalls, dt](const size_type b, const size_type ie) {
+          const auto points = internals::IntegrationPointsRange{b, ie};
+          return internals::integrate(m, opts, dt, pcalls, points);
+        });
+  }  // end of integrate
+
+  BehaviourIntegrationResult integrate(
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt,
+      const std::vector<ReductionRequest>& reductions,
+      const size_type b,
+      const size_type e) {
+    internals::checkReductionRequests(m, opts, reductions);
+    internals::allocate(m, opts);
+    internals::checkIntegrationPointsRange(m, b, e);
+    const auto points = internals::IntegrationPointsRange{b, e};
+    return internals::integrate(m, opts, dt,
+                                std::vector<internals::PostProcessingCall>{},
+                                reductions, points);
+  }  // end of integrate
+
+  MultiThreadedBehaviourIntegrationResult integrate(
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt,
+      const std::vector<ReductionRequest>& reductions) {
+    internals::checkReductionRequests(m, opts, reductions);
+    m.setThreadSafe(true);
+    internals::allocate(m, opts);
+    const auto pcalls = std::vector<internals::PostProcessingCall>{};
+    auto r = internals::executeOnThreadPool(
+        p, internals::getIntegrationRanges(m, p.getNumberOfThreads()),
+        [&m, &opts, &pcalls, &reductions, dt](const size_type b,
+                                              const size_type ie) {
+          const auto points = internals::IntegrationPointsRange{b, ie};
+          return internals::integrate(m, opts, dt, pcalls, reductions,
+                                      points);
+        });
+    internals::combineReductions(r, reductions);
+    return r;
+  }  // end of integrate
+
+  BehaviourIntegrationResult integrate(
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt,
+      mgis::span<const size_type> indices) {
+    internals::allocate(m, opts);
+    internals::checkIntegrationPoints(m, indices);
+    const auto points = internals::IntegrationPointsList{
+        indices.data(), 0, static_cast<size_type>(indices.size())};
+    return internals::integrate(m, opts, dt, points);
+  }  // end of integrate
+
+  MultiThreadedBehaviourIntegrationResult integrate(
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt,
+      mgis::span<const size_type> indices) {
+    internals::checkIntegrationPoints(m, indices);
+    m.setThreadSafe(true);
+    internals::allocate(m, opts);
+    return internals::executeOnThreadPool(
+        p, internals::getIntegrationRanges(m, indices, p.getNumberOfThreads()),
+        [&m, &opts, &indices, dt](const size_type b, const size_type ie) {
+          const auto points =
+              internals::IntegrationPointsList{indices.data(), b, ie};
+          return internals::integrate(m, opts, dt, points);
+        });
+  }  // end of integrate
+
+  std::vector<MultiThreadedBehaviourIntegrationResult> integrate(
+      ThreadPool& p,
+      const std::vector<MaterialIntegrationRequest>& requests,
+      const size_type chunk_size) {
+    //! \brief a range of integration points of a material
+    struct Chunk {
+      //! \brief index of the request
+      size_type request;
+      //! \brief first integration point
+      size_type b;
+      //! \brief past-the-end integration point
+      size_type e;
+    };
+    auto total = size_type{};
+    for (size_type i = 0; i != requests.size(); ++i) {
+      auto& m = requests[i].material;
+      for (size_type j = 0; j != i; ++j) {
+        if (&(requests[j].material) == &m) {
+          mgis::raise(
+              "integrate: a material data manager appears more than once in "
+              "the list of requests");
+        }
+      }
+      m.setThreadSafe(true);
+      internals::allocate(m, requests[i].options);
+      total += m.n;
     }
-    return p->second;
-  }  // end of getBehaviourPostProcessing
+    const auto nth = p.getNumberOfThreads();
+    const auto cs = (chunk_size != 0)
+                        ? chunk_size
+                        : std::max(total / (4 * nth), size_type{1});
+    // split each material in chunks
+    auto bounds = std::vector<std::vector<size_type>>{};
+    bounds.reserve(requests.size());
+    for (const auto& r : requests) {
+      const auto nchunks = std::max((r.material.n + cs - 1) / cs, size_type{1});
+      bounds.push_back(internals::getIntegrationRanges(r.material, nchunks));
+    }
+    // interleave the chunks of the materials
+    auto chunks = std::vector<Chunk>{};
+    auto found = true;
+    for (size_type k = 0; found; ++k) {
+      found = false;
+      for (size_type i = 0; i != requests.size(); ++i) {
+        if (k + 1 < bounds[i].size()) {
+          chunks.push_back({i, bounds[i][k], bounds[i][k + 1]});
+          found = true;
+        }
+      }
+    }
+    // dynamic distribution of the chunks
+    auto chunk_results =
+        std::vector<BehaviourIntegrationResult>(chunks.size());
+    std::atomic<size_type> next = 0;
+    auto work = [&requests, &chunks, &chunk_results, &next] {
+      for (;;) {
+        const auto c = next.fetch_add(1);
+        if (c >= chunks.size()) {
+          return;
+        }
+        const auto& chunk = chunks[c];
+        const auto& r = requests[chunk.request];
+        const auto points = internals::IntegrationPointsRange{chunk.b, chunk.e};
+        try {
+          chunk_results[c] =
+              internals::integrate(r.material, r.options, r.dt, points);
+        } catch (...) {
+          // stop the other threads
+          next = chunks.size();
+          throw;
+        }
+      }
+    };
+    // tasks can't be dedicated to the threads of the pool if called from one
+    // of those threads (see submitOnThreadPool)
+    const auto pinned =
+        (p.getThreadAffinityPolicy() != ThreadAffinityPolicy::NONE) &&
+        (!p.isWorkerThread());
+    const auto nworkers = std::min(nth, static_cast<size_type>(chunks.size()));
+    std::vector<std::future<ThreadedTaskResult<void>>> tasks;
+    tasks.reserve(nworkers);
+    for (size_type i = 0; i != nworkers; ++i) {
+      tasks.push_back(pinned ? p.addTaskToThread(i, work) : p.addTask(work));
+    }
+    {
+      MGIS_PROFILING_TIMER(timer, THREAD_POOL_WAIT, 0);
+      auto failures = std::vector<ThreadedTaskResult<void>>{};
+      for (auto& t : tasks) {
+        auto r = t.get();
+        if (!r) {
+          failures.push_back(std::move(r));
+        }
+      }
+      if (!failures.empty()) {
+        failures.front().rethrow();
+      }
+    }
+    // gather the results
+    auto results =
+        std::vector<MultiThreadedBehaviourIntegrationResult>(requests.size());
+    for (size_type c = 0; c != chunks.size(); ++c) {
+      auto& res = results[chunks[c].request];
+      res.exit_status = std::min(res.exit_status, chunk_results[c].exit_status);
+      res.results.push_back(std::move(chunk_results[c]));
+    }
+    return results;
+  }  // end of integrate
 
   int executePostProcessing(mgis::span<real> outputs,
                             BehaviourDataView& d,
@@ -711,7 +1540,8 @@ namespace mgis::behaviour {
           "invalid size of the outputs '" +
           std::string{n} + "'");
     }
-    return internals::executePostProcessing(outputs, m, p, ostride, b, e);
+    const auto points = internals::IntegrationPointsRange{b, e};
+    return internals::executePostProcessing(outputs, m, p, ostride, points);
   }  // end of executePostProcessing
 
   BehaviourIntegrationResult executePostProcessing(mgis::span<real> outputs,
@@ -720,6 +1550,25 @@ namespace mgis::behaviour {
     return executePostProcessing(outputs, m, n, 0, m.n);
   }  // end of executePostProcessing
 
+  BehaviourIntegrationResult executePostProcessing(
+      mgis::span<real> outputs,
+      MaterialDataManager& m,
+      const std::string_view n,
+      mgis::span<const size_type> indices) {
+    const auto& p = getBehaviourPostProcessing(m.b, n);
+    const auto ostride = getArraySize(p.outputs, m.b.hypothesis);
+    internals::checkIntegrationPoints(m, indices);
+    if (outputs.size() != m.n * ostride) {
+      mgis::raise(
+          "executePostProcessing: "
+          "invalid size of the outputs '" +
+          std::string{n} + "'");
+    }
+    const auto points = internals::IntegrationPointsList{
+        indices.data(), 0, static_cast<size_type>(indices.size())};
+    return internals::executePostProcessing(outputs, m, p, ostride, points);
+  }  // end of executePostProcessing
+
   MultiThreadedBehaviourIntegrationResult executePostProcessing(
       mgis::span<real> outputs,
       ThreadPool& p,
@@ -734,35 +1583,99 @@ namespace mgis::behaviour {
           std::string{n} + "'");
     }
     m.setThreadSafe(true);
-    // get number of threads
-    const auto nth = p.getNumberOfThreads();
-    const auto d = m.n / nth;
-    const auto r = m.n % nth;
-    size_type b = 0;
-    std::vector<std::future<ThreadedTaskResult<BehaviourIntegrationResult>>>
-        tasks;
-    tasks.reserve(nth);
-    for (size_type i = 0; i != r; ++i) {
-      tasks.push_back(p.addTask([&outputs, &m, &post, ostride, b, d] {
-        return internals::executePostProcessing(outputs, m, post, ostride, b,
-                                                b + d + 1);
-      }));
-      b += d + 1;
-    }
-    for (size_type i = r; i != nth; ++i) {
-      tasks.push_back(p.addTask([&outputs, &m, &post, ostride, b, d] {
-        return internals::executePostProcessing(outputs, m, post, ostride, b,
-                                                b + d);
-      }));
-      b += d;
+    return internals::executeOnThreadPool(
+        p, getUniformPartition(m.n, p.getNumberOfThreads()),
+        [&outputs, &m, &post, ostride](const size_type b,
+                                       const size_type ie) {
+          const auto points = internals::IntegrationPointsRange{b, ie};
+          return internals::executePostProcessing(outputs, m, post, ostride,
+                                                  points);
+        });
+  }  // end of executePostProcessing
+
+  AsyncBehaviourIntegrationResult executePostProcessingAsync(
+      mgis::span<real> outputs,
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const std::string_view n) {
+    const auto& post = getBehaviourPostProcessing(m.b, n);
+    const auto ostride = getArraySize(post.outputs, m.b.hypothesis);
+    if (outputs.size() != m.n * ostride) {
+      mgis::raise(
+          "executePostProcessingAsync: "
+          "invalid size of the outputs '" +
+          std::string{n} + "'");
     }
-    auto res = MultiThreadedBehaviourIntegrationResult{};
-    for (auto& t : tasks) {
-      const auto& ri = *(t.get());
-      res.exit_status = std::min(res.exit_status, ri.exit_status);
-      res.results.push_back(ri);
+    m.setThreadSafe(true);
+    return AsyncBehaviourIntegrationResult{internals::submitOnThreadPool(
+        p, getUniformPartition(m.n, p.getNumberOfThreads()),
+        [outputs, &m, &post, ostride](const size_type b, const size_type ie) {
+          const auto points = internals::IntegrationPointsRange{b, ie};
+          return internals::executePostProcessing(outputs, m, post, ostride,
+                                                  points);
+        })};
+  }  // end of executePostProcessingAsync
+
+  MultiThreadedBehaviourIntegrationResult executePostProcessing(
+      mgis::span<real> outputs,
+      Executor& e,
+      MaterialDataManager& m,
+      const std::string_view n) {
+    const auto& post = getBehaviourPostProcessing(m.b, n);
+    const auto ostride = getArraySize(post.outputs, m.b.hypothesis);
+    if (outputs.size() != m.n * ostride) {
+      mgis::raise(
+          "executePostProcessing: "
+          "invalid size of the outputs '" +
+          std::string{n} + "'");
     }
-    return res;
+    m.setThreadSafe(true);
+    auto results = executeOverRange(
+        e, m.n,
+        [&outputs, &m, &post, ostride](const size_type b, const size_type ie) {
+          const auto points = internals::IntegrationPointsRange{b, ie};
+          return internals::executePostProcessing(outputs, m, post, ostride,
+                                                  points);
+        });
+    return internals::gatherResults(results);
+  }  // end of executePostProcessing
+
+  MultiThreadedBehaviourIntegrationResult executePostProcessing(
+      mgis::span<real> outputs,
+      ThreadPool& p,
+      MaterialDataManager& m,
+      const std::string_view n,
+      mgis::span<const size_type> indices) {
+    const auto& post = getBehaviourPostProcessing(m.b, n);
+    const auto ostride = getArraySize(post.outputs, m.b.hypothesis);
+    internals::checkIntegrationPoints(m, indices);
+    if (outputs.size() != m.n * ostride) {
+      mgis::raise(
+          "executePostProcessing: "
+          "invalid size of the outputs '" +
+          std::string{n} + "'");
+    }
+    m.setThreadSafe(true);
+    return internals::executeOnThreadPool(
+        p, getUniformPartition(indices.size(), p.getNumberOfThreads()),
+        [&outputs, &m, &post, &indices, ostride](const size_type b,
+                                                 const size_type ie) {
+          const auto points =
+              internals::IntegrationPointsList{indices.data(), b, ie};
+          return internals::executePostProcessing(outputs, m, post, ostride,
+                                                  points);
+        });
   }  // end of executePostProcessing
 
+  std::vector<size_type> getActiveIntegrationPoints(
+      mgis::span<const bool> mask) {
+    auto indices = std::vector<size_type>{};
+    for (size_type i = 0; i != static_cast<size_type>(mask.size()); ++i) {
+      if (mask[i]) {
+        indices.push_back(i);
+      }
+    }
+    return indices;
+  }  // end of getActiveIntegrationPoints
+
 }  // end of namespace mgis::behaviour
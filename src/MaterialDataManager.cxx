@@ -13,6 +13,7 @@
  */
 
 #include <mutex>
+#include <algorithm>
 #include <thread>
 #include "MGIS/Raise.hxx"
 #include "MGIS/Behaviour/Behaviour.hxx"
@@ -22,11 +23,27 @@ namespace mgis::behaviour {
 
   BehaviourIntegrationWorkSpace::BehaviourIntegrationWorkSpace(
       const Behaviour& b)
+      : BehaviourIntegrationWorkSpace(b, getDefaultMemoryResource()) {
+  }  // end of BehaviourIntegrationWorkSpace
+
+  BehaviourIntegrationWorkSpace::BehaviourIntegrationWorkSpace(
+      const Behaviour& b, mgis::MemoryResource& r)
       : error_message(512),
-        mps0(getArraySize(b.mps, b.hypothesis)),
-        mps1(getArraySize(b.mps, b.hypothesis)),
-        esvs0(getArraySize(b.esvs, b.hypothesis)),
-        esvs1(getArraySize(b.esvs, b.hypothesis)) {
+        mps0(getArraySize(b.mps, b.hypothesis),
+             real{0},
+             Storage::allocator_type(r)),
+        mps1(getArraySize(b.mps, b.hypothesis),
+             real{0},
+             Storage::allocator_type(r)),
+        esvs0(getArraySize(b.esvs, b.hypothesis),
+              real{0},
+              Storage::allocator_type(r)),
+        esvs1(getArraySize(b.esvs, b.hypothesis),
+              real{0},
+              Storage::allocator_type(r)),
+        K(std::max(getTangentOperatorArraySize(b), Behaviour::nopts + 1),
+          real{0},
+          Storage::allocator_type(r)) {
   }  // end of BehaviourIntegrationWorkSpace
 
   BehaviourIntegrationWorkSpace::BehaviourIntegrationWorkSpace(
@@ -45,42 +62,104 @@ namespace mgis::behaviour {
         s1(behaviour, s),
         n(s),
         K_stride(getTangentOperatorArraySize(behaviour)),
-        b(behaviour) {}  // end of MaterialDataManager
+        K_storage(),
+        b(behaviour),
+        memory_resource(getDefaultMemoryResource()) {
+  }  // end of MaterialDataManager
+
+  /*!
+   * \return the initializer of a state manager, using the thread pool of the
+   * initializer of the material data manager if the initializer of the state
+   * manager does not specify one.
+   * \param[in] i: initializer of the material data manager
+   * \param[in] si: initializer of the state manager
+   */
+  static MaterialStateManagerInitializer getMaterialStateManagerInitializer(
+      const MaterialDataManagerInitializer& i,
+      const MaterialStateManagerInitializer& si) {
+    auto r = si;
+    if (r.thread_pool == nullptr) {
+      r.thread_pool = i.thread_pool;
+    }
+    if (r.memory_resource == nullptr) {
+      r.memory_resource = i.memory_resource;
+    }
+    return r;
+  }  // end of getMaterialStateManagerInitializer
+
+  /*!
+   * \return the memory resource specified by the initializer of a material
+   * data manager, or the default memory resource.
+   * \param[in] i: initializer
+   */
+  static mgis::MemoryResource& getInitializerMemoryResource(
+      const MaterialDataManagerInitializer& i) {
+    if (i.memory_resource != nullptr) {
+      return *(i.memory_resource);
+    }
+    return getDefaultMemoryResource();
+  }  // end of getInitializerMemoryResource
 
   MaterialDataManager::MaterialDataManager(
       const Behaviour& behaviour,
       const size_type s,
       const MaterialDataManagerInitializer& i)
-      : s0(behaviour, s, i.s0),
-        s1(behaviour, s, i.s1),
+      : s0(behaviour, s, getMaterialStateManagerInitializer(i, i.s0)),
+        s1(behaviour, s, getMaterialStateManagerInitializer(i, i.s1)),
         n(s),
-        K_stride(getTangentOperatorArraySize(behaviour)),
-        b(behaviour) {
+        K_stride(getTangentOperatorArraySize(behaviour,
+                                             i.tangent_operator_storage)),
+        K_storage(i.tangent_operator_storage),
+        b(behaviour),
+        K_values(Storage::allocator_type(getInitializerMemoryResource(i))),
+        K_single_precision_values(
+            mgis::Allocator<float>(getInitializerMemoryResource(i))),
+        speed_of_sound_values(
+            Storage::allocator_type(getInitializerMemoryResource(i))),
+        integration_costs_values(
+            Storage::allocator_type(getInitializerMemoryResource(i))),
+        thread_pool(i.thread_pool),
+        memory_resource(getInitializerMemoryResource(i)) {
     if (!i.K.empty()) {
       this->useExternalArrayOfTangentOperatorBlocks(i.K);
     }
     if (!i.speed_of_sound.empty()) {
       this->useExternalArrayOfSpeedOfSounds(i.speed_of_sound);
     }
+    if (!i.integration_costs.empty()) {
+      this->useExternalArrayOfIntegrationCosts(i.integration_costs);
+    }
   }  // end of MaterialDataManager
 
-  static void allocateArrayWithoutSynchronization(
-      mgis::span<real>& v,
-      std::vector<mgis::real>& values,
-      const mgis::size_type s) {
+  template <typename ValueType, typename Storage>
+  static void allocateArrayWithoutSynchronization(mgis::span<ValueType>& v,
+                                                  Storage& values,
+                                                  const mgis::size_type s,
+                                                  ThreadPool* const p,
+                                                  const mgis::size_type n) {
     if (v.empty()) {
-      constexpr const auto zero = real{0};
-      values.resize(s, zero);
-      v = mgis::span<real>(values);
+      if (p != nullptr) {
+        // the memory is left untouched by the calling thread
+        values.resize(s);
+        v = mgis::span<ValueType>(values);
+        initializeValuesInParallel(*p, v, n);
+      } else {
+        constexpr const auto zero = ValueType{0};
+        values.resize(s, zero);
+        v = mgis::span<ValueType>(values);
+      }
     }
   }  // end of allocateArrayWithoutSynchronization
 
-  static void allocateArrayWithSynchronization(mgis::span<real>& v,
-                                               std::vector<mgis::real>& values,
-                                               const mgis::size_type s) {
+  template <typename ValueType, typename Storage>
+  static void allocateArrayWithSynchronization(mgis::span<ValueType>& v,
+                                               Storage& values,
+                                               const mgis::size_type s,
+                                               ThreadPool* const p,
+                                               const mgis::size_type n) {
     static std::mutex mt;
     std::lock_guard<std::mutex> lock(mt);
-    allocateArrayWithoutSynchronization(v, values, s);
+    allocateArrayWithoutSynchronization(v, values, s, p, n);
   }  // end of allocateArrayWithSynchronization
 
   void MaterialDataManager::setThreadSafe(const bool bv) {
@@ -88,22 +167,44 @@ namespace mgis::behaviour {
   }  // end of setThreadSafe
 
   void MaterialDataManager::allocateArrayOfTangentOperatorBlocks() {
+    if (this->K_storage.single_precision) {
+      if (this->thread_safe) {
+        allocateArrayWithSynchronization(
+            this->K_single_precision, this->K_single_precision_values,
+            this->n * this->K_stride, this->thread_pool, this->n);
+      } else {
+        allocateArrayWithoutSynchronization(
+            this->K_single_precision, this->K_single_precision_values,
+            this->n * this->K_stride, this->thread_pool, this->n);
+      }
+      return;
+    }
     if (this->thread_safe) {
       allocateArrayWithSynchronization(this->K, this->K_values,
-                                       this->n * this->K_stride);
+                                       this->n * this->K_stride,
+                                       this->thread_pool, this->n);
     } else {
       allocateArrayWithoutSynchronization(this->K, this->K_values,
-                                          this->n * this->K_stride);
+                                          this->n * this->K_stride,
+                                          this->thread_pool, this->n);
     }
   }  // end of allocateArrayOfTangentOperatorBlocks
 
   void MaterialDataManager::releaseArrayOfTangentOperatorBlocks() {
     this->K = mgis::span<real>();
     this->K_values.clear();
+    this->K_single_precision = mgis::span<float>();
+    this->K_single_precision_values.clear();
   }  // end of releaseArrayOfTangentOperatorBlocks
 
   void MaterialDataManager::useExternalArrayOfTangentOperatorBlocks(
       mgis::span<real> m) {
+    if (this->K_storage.single_precision) {
+      mgis::raise(
+          "MaterialDataManager::useExternalArrayOfTangentOperatorBlocks: "
+          "external memory can't be used when the tangent operator blocks "
+          "are stored in single precision");
+    }
     if (m.size() != this->n * this->K_stride) {
       mgis::raise(
           "MaterialDataManager::useExternalArrayOfTangentOperatorBlocks: "
@@ -116,10 +217,12 @@ namespace mgis::behaviour {
   void MaterialDataManager::allocateArrayOfSpeedOfSounds() {
     if (this->thread_safe) {
       allocateArrayWithSynchronization(this->speed_of_sound,
-                                       this->speed_of_sound_values, this->n);
+                                       this->speed_of_sound_values, this->n,
+                                       this->thread_pool, this->n);
     } else {
       allocateArrayWithoutSynchronization(this->speed_of_sound,
-                                          this->speed_of_sound_values, this->n);
+                                          this->speed_of_sound_values, this->n,
+                                          this->thread_pool, this->n);
     }
   }  // end of allocateArrayOfSpeedOfSounds
 
@@ -139,6 +242,34 @@ namespace mgis::behaviour {
     this->speed_of_sound = m;
   }  // end of useExternalArrayOfSpeedOfSounds
 
+  void MaterialDataManager::allocateArrayOfIntegrationCosts() {
+    if (this->thread_safe) {
+      allocateArrayWithSynchronization(this->integration_costs,
+                                       this->integration_costs_values, this->n,
+                                       this->thread_pool, this->n);
+    } else {
+      allocateArrayWithoutSynchronization(this->integration_costs,
+                                          this->integration_costs_values,
+                                          this->n, this->thread_pool, this->n);
+    }
+  }  // end of allocateArrayOfIntegrationCosts
+
+  void MaterialDataManager::releaseArrayOfIntegrationCosts() {
+    this->integration_costs = mgis::span<real>();
+    this->integration_costs_values.clear();
+  }  // end of releaseArrayOfIntegrationCosts
+
+  void MaterialDataManager::useExternalArrayOfIntegrationCosts(
+      mgis::span<real> m) {
+    if (m.size() != this->n) {
+      mgis::raise(
+          "MaterialDataManager::useExternalArrayOfIntegrationCosts: "
+          "the external memory has not been allocated properly");
+    }
+    this->releaseArrayOfIntegrationCosts();
+    this->integration_costs = m;
+  }  // end of useExternalArrayOfIntegrationCosts
+
   BehaviourIntegrationWorkSpace&
   MaterialDataManager::getBehaviourIntegrationWorkSpace() {
     if (this->thread_safe) {
@@ -147,13 +278,15 @@ namespace mgis::behaviour {
       const auto id = std::this_thread::get_id();
       auto p = this->iwks.find(id);
       if (p == this->iwks.end()) {
-        auto wk = std::make_unique<BehaviourIntegrationWorkSpace>(b);
+        auto wk = std::make_unique<BehaviourIntegrationWorkSpace>(
+            b, this->memory_resource);
         p = this->iwks.insert({id, std::move(wk)}).first;
       }
       return *(p->second);
     }
     if (this->iwk == nullptr) {
-      this->iwk = std::make_unique<BehaviourIntegrationWorkSpace>(b);
+      this->iwk = std::make_unique<BehaviourIntegrationWorkSpace>(
+          b, this->memory_resource);
     }
     return *(this->iwk);
   }  // end of getBehaviourIntegrationWorkSpace
@@ -167,11 +300,15 @@ namespace mgis::behaviour {
 
   void update(MaterialDataManager& m) {
     std::fill(m.K.begin(), m.K.end(), real{0});
+    std::fill(m.K_single_precision.begin(), m.K_single_precision.end(),
+              float{0});
     updateValues(m.s0, m.s1);
   }  // end of update
 
   void revert(MaterialDataManager& m) {
     std::fill(m.K.begin(), m.K.end(), real{0});
+    std::fill(m.K_single_precision.begin(), m.K_single_precision.end(),
+              float{0});
     updateValues(m.s1, m.s0);
   }  // end of update
 
@@ -0,0 +1,192 @@
+/*!
+ * \file   MaterialDataManagerArena.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cstdint>
+#include <algorithm>
+#include "MGIS/Raise.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/MaterialDataManagerArena.hxx"
+
+namespace mgis::behaviour {
+
+  /*!
+   * \brief build the initializer of a material data manager, the arrays
+   * being given by the `get` functor
+   * \param[in] b: behaviour
+   * \param[in] n: number of integration points
+   * \param[in] o: options
+   * \param[in] get: functor returning a view to an array of the given size
+   */
+  template <typename Functor>
+  static MaterialDataManagerInitializer getInitializer(
+      const Behaviour& b,
+      const size_type n,
+      const MaterialDataManagerArenaOptions& o,
+      const Functor& get) {
+    const auto h = b.hypothesis;
+    auto i = MaterialDataManagerInitializer{};
+    for (auto* const s : {&i.s0, &i.s1}) {
+      s->gradients = get(n * getArraySize(b.gradients, h));
+      s->thermodynamic_forces =
+          get(n * getArraySize(b.thermodynamic_forces, h));
+      s->internal_state_variables = get(n * getArraySize(b.isvs, h));
+      if (b.computesStoredEnergy) {
+        s->stored_energies = get(n);
+      }
+      if (b.computesDissipatedEnergy) {
+        s->dissipated_energies = get(n);
+      }
+    }
+    if (o.tangent_operator) {
+      i.K = get(n * getTangentOperatorArraySize(b));
+    }
+    if (o.speed_of_sound) {
+      i.speed_of_sound = get(n);
+    }
+    if (o.integration_costs) {
+      i.integration_costs = get(n);
+    }
+    return i;
+  }  // end of getInitializer
+
+  MaterialDataManagerArena::MaterialDataManagerArena()
+      : MaterialDataManagerArena(getDefaultMemoryResource()) {
+  }  // end of MaterialDataManagerArena
+
+  MaterialDataManagerArena::MaterialDataManagerArena(mgis::MemoryResource& r)
+      : memory(mgis::Allocator<mgis::real>(r)) {
+  }  // end of MaterialDataManagerArena
+
+  size_type MaterialDataManagerArena::addMaterial(
+      const Behaviour& b,
+      const size_type n,
+      const MaterialDataManagerArenaOptions& o) {
+    if (this->isBuilt()) {
+      mgis::raise(
+          "MaterialDataManagerArena::addMaterial: "
+          "the arena has already been built");
+    }
+    this->materials.push_back({&b, n, o});
+    return this->materials.size() - 1;
+  }  // end of addMaterial
+
+  void MaterialDataManagerArena::build() {
+    if (this->isBuilt()) {
+      mgis::raise(
+          "MaterialDataManagerArena::build: "
+          "the arena has already been built");
+    }
+    // computation of the size of the arena
+    auto size = size_type{};
+    auto count = [&size](const size_type s) {
+      size = internals::alignOffsetOnCacheLine(size) + s;
+      return mgis::span<real>{};
+    };
+    for (const auto& m : this->materials) {
+      getInitializer(*(m.behaviour), m.n, m.options, count);
+    }
+    // the memory is reused if possible. The previous values are not copied.
+    // The memory resource only guarantees the alignment of a real, so
+    // additional values are allocated to align the first array on a cache
+    // line.
+    constexpr auto cache_line_size = std::uintptr_t{64};
+    this->memory.clear();
+    this->memory.resize(size + cache_line_size / sizeof(real));
+    const auto address = reinterpret_cast<std::uintptr_t>(this->memory.data());
+    const auto padding =
+        (cache_line_size - address % cache_line_size) % cache_line_size;
+    this->memory_offset = static_cast<size_type>(padding / sizeof(real));
+    this->memory_size = size;
+    std::fill(this->memory.begin(), this->memory.end(), real{0});
+    // creation of the material data managers
+    auto& r = this->memory.get_allocator().getMemoryResource();
+    auto* const base = this->memory.data() + this->memory_offset;
+    auto offset = size_type{};
+    auto get = [base, &offset](const size_type s) {
+      const auto o = internals::alignOffsetOnCacheLine(offset);
+      offset = o + s;
+      return mgis::span<real>(base + o, s);
+    };
+    this->managers.reserve(this->materials.size());
+    for (const auto& m : this->materials) {
+      auto i = getInitializer(*(m.behaviour), m.n, m.options, get);
+      i.memory_resource = &r;
+      this->managers.push_back(
+          std::make_unique<MaterialDataManager>(*(m.behaviour), m.n, i));
+      internals::initializeDeformationGradients(this->managers.back()->s0);
+      internals::initializeDeformationGradients(this->managers.back()->s1);
+    }
+  }  // end of build
+
+  bool MaterialDataManagerArena::isBuilt() const {
+    return !this->managers.empty();
+  }  // end of isBuilt
+
+  size_type MaterialDataManagerArena::getNumberOfMaterials() const {
+    return this->materials.size();
+  }  // end of getNumberOfMaterials
+
+  MaterialDataManager& MaterialDataManagerArena::getMaterialDataManager(
+      const size_type i) {
+    if (i >= this->managers.size()) {
+      mgis::raise(
+          "MaterialDataManagerArena::getMaterialDataManager: "
+          "invalid index or the arena has not been built");
+    }
+    return *(this->managers[i]);
+  }  // end of getMaterialDataManager
+
+  const MaterialDataManager& MaterialDataManagerArena::getMaterialDataManager(
+      const size_type i) const {
+    if (i >= this->managers.size()) {
+      mgis::raise(
+          "MaterialDataManagerArena::getMaterialDataManager: "
+          "invalid index or the arena has not been built");
+    }
+    return *(this->managers[i]);
+  }  // end of getMaterialDataManager
+
+  mgis::span<mgis::real> MaterialDataManagerArena::getMemory() {
+    if (this->memory.empty()) {
+      return mgis::span<mgis::real>();
+    }
+    return mgis::span<mgis::real>(this->memory.data() + this->memory_offset,
+                                  this->memory_size);
+  }  // end of getMemory
+
+  void MaterialDataManagerArena::reset() {
+    std::fill(this->memory.begin(), this->memory.end(), real{0});
+    for (auto& m : this->managers) {
+      internals::initializeDeformationGradients(m->s0);
+      internals::initializeDeformationGradients(m->s1);
+    }
+  }  // end of reset
+
+  void MaterialDataManagerArena::clear() {
+    this->managers.clear();
+    this->materials.clear();
+  }  // end of clear
+
+  void MaterialDataManagerArena::release() {
+    this->clear();
+    this->memory.clear();
+    this->memory.shrink_to_fit();
+    this->memory_offset = 0;
+    this->memory_size = 0;
+  }  // end of release
+
+  MaterialDataManagerArena::~MaterialDataManagerArena() = default;
+
+}  // end of namespace mgis::behaviour
@@ -12,13 +12,37 @@
  *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
  */
 
+#include <future>
 #include <algorithm>
 #include "MGIS/Raise.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Partition.hxx"
 #include "MGIS/Behaviour/Behaviour.hxx"
 #include "MGIS/Behaviour/MaterialStateManager.hxx"
 
 namespace mgis::behaviour {
 
+  namespace internals {
+
+    size_type alignOffsetOnCacheLine(const size_type o) {
+      constexpr auto a = size_type{64} / sizeof(real);
+      return ((o + a - 1) / a) * a;
+    }  // end of alignOffsetOnCacheLine
+
+    void initializeDeformationGradients(MaterialStateManager& s) {
+      if ((s.b.btype != Behaviour::STANDARDFINITESTRAINBEHAVIOUR) ||
+          (s.b.kinematic != Behaviour::FINITESTRAINKINEMATIC_F_CAUCHY)) {
+        return;
+      }
+      for (size_type i = 0; i != s.n; ++i) {
+        auto F = s.gradients.subspan(i * s.gradients_stride,  //
+                                     s.gradients_stride);
+        F[0] = F[1] = F[2] = real{1};
+      }
+    }  // end of initializeDeformationGradients
+
+  }  // end of namespace internals
+
   MaterialStateManager::MaterialStateManager(const Behaviour& behaviour,
                                              const size_type s)
       : gradients_stride(
@@ -29,21 +53,14 @@ namespace mgis::behaviour {
             getArraySize(behaviour.isvs, behaviour.hypothesis)),
         n(s),
         b(behaviour) {
-    auto init = [this](mgis::span<mgis::real>& view,
-                       std::vector<mgis::real>& values, const size_type vs) {
+    auto init = [this](mgis::span<mgis::real>& view, Storage& values,
+                       const size_type vs) {
       constexpr const auto zero = real{0};
       values.resize(this->n * vs, zero);
       view = mgis::span<mgis::real>(values);
     };
     init(this->gradients, this->gradients_values, this->gradients_stride);
-    if ((this->b.btype == Behaviour::STANDARDFINITESTRAINBEHAVIOUR) &&
-        (this->b.kinematic == Behaviour::FINITESTRAINKINEMATIC_F_CAUCHY)) {
-      for (size_type i = 0; i != this->n; ++i) {
-        auto F = this->gradients.subspan(i * gradients_stride,  //
-                                         gradients_stride);
-        F[0] = F[1] = F[2] = real{1};
-      }
-    }
+    internals::initializeDeformationGradients(*this);
     init(this->thermodynamic_forces, this->thermodynamic_forces_values,
          this->thermodynamic_forces_stride);
     init(this->internal_state_variables, this->internal_state_variables_values,
@@ -68,14 +85,23 @@ namespace mgis::behaviour {
             getArraySize(behaviour.isvs, behaviour.hypothesis)),
         n(s),
         b(behaviour) {
-    auto init = [this](mgis::span<mgis::real>& view,
-                       std::vector<mgis::real>& values,
-                       const mgis::span<mgis::real>& evalues,
-                       const size_type vs, const char* const vn) {
+    auto init = [this, &i](mgis::span<mgis::real>& view, Storage& values,
+                           const mgis::span<mgis::real>& evalues,
+                           const size_type vs, const char* const vn) {
       if (evalues.empty()) {
-        constexpr const auto zero = real{0};
-        values.resize(this->n * vs, zero);
-        view = mgis::span<mgis::real>(values);
+        if (i.memory_resource != nullptr) {
+          values = Storage(mgis::Allocator<real>(*(i.memory_resource)));
+        }
+        if (i.thread_pool != nullptr) {
+          // the memory is left untouched by the calling thread
+          values.resize(this->n * vs);
+          view = mgis::span<mgis::real>(values);
+          initializeValuesInParallel(*(i.thread_pool), view, this->n);
+        } else {
+          constexpr const auto zero = real{0};
+          values.resize(this->n * vs, zero);
+          view = mgis::span<mgis::real>(values);
+        }
       } else {
         if (static_cast<size_type>(evalues.size()) != this->n * vs) {
           mgis::raise(
@@ -88,14 +114,8 @@ namespace mgis::behaviour {
     };
     init(this->gradients, this->gradients_values, i.gradients,
          this->gradients_stride, "gradients");
-    if ((this->b.btype == Behaviour::STANDARDFINITESTRAINBEHAVIOUR) &&
-        (this->b.kinematic == Behaviour::FINITESTRAINKINEMATIC_F_CAUCHY) &&
-        (i.gradients.empty())) {
-      for (size_type ig = 0; ig != this->n; ++ig) {
-        auto F = this->gradients.subspan(ig * gradients_stride,  //
-                                         gradients_stride);
-        F[0] = F[1] = F[2] = real{1};
-      }
+    if (i.gradients.empty()) {
+      internals::initializeDeformationGradients(*this);
     }
     init(this->thermodynamic_forces, this->thermodynamic_forces_values,
          i.thermodynamic_forces, this->thermodynamic_forces_stride,
@@ -422,4 +442,358 @@ namespace mgis::behaviour {
     }
   }  // end of extractInternalStateVariable
 
+  namespace internals {
+
+    //! \brief location of a variable in an array of values
+    struct VariableLocation {
+      //! \brief stride of the array
+      mgis::size_type stride;
+      //! \brief offset of the variable
+      mgis::size_type offset;
+      //! \brief size of the variable
+      mgis::size_type size;
+    };
+
+    static VariableLocation getVariableLocation(
+        const std::vector<Variable>& variables,
+        const mgis::size_type stride,
+        const mgis::string_view n,
+        const Hypothesis h) {
+      const auto& v = mgis::behaviour::getVariable(variables, n);
+      return {stride, mgis::behaviour::getVariableOffset(variables, n, h),
+              mgis::behaviour::getVariableSize(v, h)};
+    }  // end of getVariableLocation
+
+    /*!
+     * \return the number of blocks of values handled
+     * \param[in] f: calling function
+     * \param[in] b: size of the buffer
+     * \param[in] l: location of the variable
+     * \param[in] n: number of integration points
+     * \param[in] ordering: indices of the integration points
+     */
+    static mgis::size_type checkBufferAndOrdering(
+        const char* const f,
+        const mgis::size_type b,
+        const VariableLocation& l,
+        const mgis::size_type n,
+        const mgis::span<const mgis::size_type> ordering) {
+      const auto nb = ordering.empty() ? n : ordering.size();
+      if (b != nb * l.size) {
+        mgis::raise(std::string(f) + ": invalid buffer size");
+      }
+      for (const auto i : ordering) {
+        if (i >= n) {
+          mgis::raise(std::string(f) + ": invalid integration point index");
+        }
+      }
+      return nb;
+    }  // end of checkBufferAndOrdering
+
+    /*!
+     * \brief copy the values of a variable in a buffer for the blocks in
+     * range [b, e[
+     */
+    static void gatherValues(mgis::real* const o,
+                             const mgis::real* const v,
+                             const VariableLocation& l,
+                             const mgis::span<const mgis::size_type> ordering,
+                             const mgis::size_type b,
+                             const mgis::size_type e) {
+      for (mgis::size_type j = b; j != e; ++j) {
+        const auto i = ordering.empty() ? j : ordering[j];
+        const auto* const pv = v + i * l.stride + l.offset;
+        std::copy(pv, pv + l.size, o + j * l.size);
+      }
+    }  // end of gatherValues
+
+    /*!
+     * \brief copy the values of a buffer in the values of a variable for the
+     * blocks in range [b, e[
+     */
+    static void scatterValues(mgis::real* const v,
+                              const mgis::real* const in,
+                              const VariableLocation& l,
+                              const mgis::span<const mgis::size_type> ordering,
+                              const mgis::size_type b,
+                              const mgis::size_type e) {
+      for (mgis::size_type j = b; j != e; ++j) {
+        const auto i = ordering.empty() ? j : ordering[j];
+        const auto* const pi = in + j * l.size;
+        std::copy(pi, pi + l.size, v + i * l.stride + l.offset);
+      }
+    }  // end of scatterValues
+
+    /*!
+     * \brief split the range [0, n[ in chunks treated by the threads of the
+     * given pool
+     * \param[in] p: thread pool
+     * \param[in] n: size of the range
+     * \param[in] f: function called on each chunk
+     */
+    template <typename Functor>
+    static void parallel_for(mgis::ThreadPool& p,
+                             const mgis::size_type n,
+                             const Functor& f) {
+      const auto bounds = getUniformPartition(n, p.getNumberOfThreads());
+      auto tasks = std::vector<std::future<ThreadedTaskResult<void>>>{};
+      tasks.reserve(bounds.size() - 1);
+      for (mgis::size_type i = 0; i + 1 < bounds.size(); ++i) {
+        const auto b = bounds[i];
+        const auto e = bounds[i + 1];
+        if (b != e) {
+          tasks.push_back(p.addTask([&f, b, e] { f(b, e); }));
+        }
+      }
+      for (auto& t : tasks) {
+        auto r2 = t.get();
+        if (!r2) {
+          r2.rethrow();
+        }
+      }
+    }  // end of parallel_for
+
+    static void extractValues(const char* const f,
+                              mgis::span<mgis::real> o,
+                              const mgis::real* const v,
+                              const VariableLocation& l,
+                              const mgis::size_type n,
+                              const mgis::span<const mgis::size_type> ordering) {
+      const auto nb = checkBufferAndOrdering(f, o.size(), l, n, ordering);
+      gatherValues(o.data(), v, l, ordering, 0, nb);
+    }  // end of extractValues
+
+    static void extractValues(mgis::ThreadPool& p,
+                              const char* const f,
+                              mgis::span<mgis::real> o,
+                              const mgis::real* const v,
+                              const VariableLocation& l,
+                              const mgis::size_type n,
+                              const mgis::span<const mgis::size_type> ordering) {
+      const auto nb = checkBufferAndOrdering(f, o.size(), l, n, ordering);
+      auto* const po = o.data();
+      parallel_for(p, nb, [po, v, &l, ordering](const mgis::size_type b,
+                                                const mgis::size_type e) {
+        gatherValues(po, v, l, ordering, b, e);
+      });
+    }  // end of extractValues
+
+    static void setValues(const char* const f,
+                          mgis::real* const v,
+                          const mgis::span<const mgis::real> in,
+                          const VariableLocation& l,
+                          const mgis::size_type n,
+                          const mgis::span<const mgis::size_type> ordering) {
+      const auto nb = checkBufferAndOrdering(f, in.size(), l, n, ordering);
+      scatterValues(v, in.data(), l, ordering, 0, nb);
+    }  // end of setValues
+
+    static void setValues(mgis::ThreadPool& p,
+                          const char* const f,
+                          mgis::real* const v,
+                          const mgis::span<const mgis::real> in,
+                          const VariableLocation& l,
+                          const mgis::size_type n,
+                          const mgis::span<const mgis::size_type> ordering) {
+      const auto nb = checkBufferAndOrdering(f, in.size(), l, n, ordering);
+      const auto* const pi = in.data();
+      parallel_for(p, nb, [v, pi, &l, ordering](const mgis::size_type b,
+                                                const mgis::size_type e) {
+        scatterValues(v, pi, l, ordering, b, e);
+      });
+    }  // end of setValues
+
+    static VariableLocation getGradientLocation(const MaterialStateManager& s,
+                                                const mgis::string_view n) {
+      return getVariableLocation(s.b.gradients, s.gradients_stride, n,
+                                 s.b.hypothesis);
+    }  // end of getGradientLocation
+
+    static VariableLocation getThermodynamicForceLocation(
+        const MaterialStateManager& s, const mgis::string_view n) {
+      return getVariableLocation(s.b.thermodynamic_forces,
+                                 s.thermodynamic_forces_stride, n,
+                                 s.b.hypothesis);
+    }  // end of getThermodynamicForceLocation
+
+    static VariableLocation getInternalStateVariableLocation(
+        const MaterialStateManager& s, const mgis::string_view n) {
+      return getVariableLocation(s.b.isvs, s.internal_state_variables_stride,
+                                 n, s.b.hypothesis);
+    }  // end of getInternalStateVariableLocation
+
+  }  // end of namespace internals
+
+  void extractGradient(mgis::span<mgis::real> o,
+                       const MaterialStateManager& s,
+                       const mgis::string_view n,
+                       const mgis::span<const mgis::size_type> ordering) {
+    internals::extractValues("extractGradient", o, s.gradients.data(),
+                             internals::getGradientLocation(s, n), s.n,
+                             ordering);
+  }  // end of extractGradient
+
+  void extractThermodynamicForce(
+      mgis::span<mgis::real> o,
+      const MaterialStateManager& s,
+      const mgis::string_view n,
+      const mgis::span<const mgis::size_type> ordering) {
+    internals::extractValues(
+        "extractThermodynamicForce", o, s.thermodynamic_forces.data(),
+        internals::getThermodynamicForceLocation(s, n), s.n, ordering);
+  }  // end of extractThermodynamicForce
+
+  void extractInternalStateVariable(
+      mgis::span<mgis::real> o,
+      const MaterialStateManager& s,
+      const mgis::string_view n,
+      const mgis::span<const mgis::size_type> ordering) {
+    internals::extractValues(
+        "extractInternalStateVariable", o, s.internal_state_variables.data(),
+        internals::getInternalStateVariableLocation(s, n), s.n, ordering);
+  }  // end of extractInternalStateVariable
+
+  void setGradient(MaterialStateManager& s,
+                   const mgis::string_view n,
+                   const mgis::span<const mgis::real> v,
+                   const mgis::span<const mgis::size_type> ordering) {
+    internals::setValues("setGradient", s.gradients.data(), v,
+                         internals::getGradientLocation(s, n), s.n, ordering);
+  }  // end of setGradient
+
+  void setThermodynamicForce(MaterialStateManager& s,
+                             const mgis::string_view n,
+                             const mgis::span<const mgis::real> v,
+                             const mgis::span<const mgis::size_type> ordering) {
+    internals::setValues("setThermodynamicForce", s.thermodynamic_forces.data(),
+                         v, internals::getThermodynamicForceLocation(s, n),
+                         s.n, ordering);
+  }  // end of setThermodynamicForce
+
+  void setInternalStateVariable(
+      MaterialStateManager& s,
+      const mgis::string_view n,
+      const mgis::span<const mgis::real> v,
+      const mgis::span<const mgis::size_type> ordering) {
+    internals::setValues("setInternalStateVariable",
+                         s.internal_state_variables.data(), v,
+                         internals::getInternalStateVariableLocation(s, n), s.n,
+                         ordering);
+  }  // end of setInternalStateVariable
+
+  void extractGradient(mgis::ThreadPool& p,
+                       mgis::span<mgis::real> o,
+                       const MaterialStateManager& s,
+                       const mgis::string_view n,
+                       const mgis::span<const mgis::size_type> ordering) {
+    internals::extractValues(p, "extractGradient", o, s.gradients.data(),
+                             internals::getGradientLocation(s, n), s.n,
+                             ordering);
+  }  // end of extractGradient
+
+  void extractThermodynamicForce(
+      mgis::ThreadPool& p,
+      mgis::span<mgis::real> o,
+      const MaterialStateManager& s,
+      const mgis::string_view n,
+      const mgis::span<const mgis::size_type> ordering) {
+    internals::extractValues(
+        p, "extractThermodynamicForce", o, s.thermodynamic_forces.data(),
+        internals::getThermodynamicForceLocation(s, n), s.n, ordering);
+  }  // end of extractThermodynamicForce
+
+  void extractInternalStateVariable(
+      mgis::ThreadPool& p,
+      mgis::span<mgis::real> o,
+      const MaterialStateManager& s,
+      const mgis::string_view n,
+      const mgis::span<const mgis::size_type> ordering) {
+    internals::extractValues(
+        p, "extractInternalStateVariable", o, s.internal_state_variables.data(),
+        internals::getInternalStateVariableLocation(s, n), s.n, ordering);
+  }  // end of extractInternalStateVariable
+
+  void setGradient(mgis::ThreadPool& p,
+                   MaterialStateManager& s,
+                   const mgis::string_view n,
+                   const mgis::span<const mgis::real> v,
+                   const mgis::span<const mgis::size_type> ordering) {
+    internals::setValues(p, "setGradient", s.gradients.data(), v,
+                         internals::getGradientLocation(s, n), s.n, ordering);
+  }  // end of setGradient
+
+  void setThermodynamicForce(mgis::ThreadPool& p,
+                             MaterialStateManager& s,
+                             const mgis::string_view n,
+                             const mgis::span<const mgis::real> v,
+                             const mgis::span<const mgis::size_type> ordering) {
+    internals::setValues(p, "setThermodynamicForce",
+                         s.thermodynamic_forces.data(), v,
+                         internals::getThermodynamicForceLocation(s, n), s.n,
+                         ordering);
+  }  // end of setThermodynamicForce
+
+  void setInternalStateVariable(
+      mgis::ThreadPool& p,
+      MaterialStateManager& s,
+      const mgis::string_view n,
+      const mgis::span<const mgis::real> v,
+      const mgis::span<const mgis::size_type> ordering) {
+    internals::setValues(p, "setInternalStateVariable",
+                         s.internal_state_variables.data(), v,
+                         internals::getInternalStateVariableLocation(s, n), s.n,
+                         ordering);
+  }  // end of setInternalStateVariable
+
+  /*!
+   * \brief implementation of the `initializeValuesInParallel` functions
+   * \param[in] p: thread pool
+   * \param[out] v: values
+   * \param[in] n: number of integration points
+   */
+  template <typename ValueType>
+  static void initializeValuesInParallelImplementation(
+      mgis::ThreadPool& p, mgis::span<ValueType> v, const size_type n) {
+    const auto size = static_cast<size_type>(v.size());
+    if ((size == 0) || (n == 0)) {
+      return;
+    }
+    if (size % n != 0) {
+      mgis::raise("initializeValuesInParallel: invalid array size");
+    }
+    if (p.isWorkerThread()) {
+      std::fill(v.begin(), v.end(), ValueType{0});
+      return;
+    }
+    const auto s = size / n;
+    const auto bounds = getUniformPartition(n, p.getNumberOfThreads());
+    std::vector<std::future<ThreadedTaskResult<void>>> tasks;
+    tasks.reserve(bounds.size() - 1);
+    for (size_type i = 0; i + 1 < bounds.size(); ++i) {
+      const auto b = bounds[i] * s;
+      const auto e = bounds[i + 1] * s;
+      tasks.push_back(p.addTaskToThread(i, [v, b, e] {
+        std::fill(v.begin() + b, v.begin() + e, ValueType{0});
+      }));
+    }
+    for (auto& t : tasks) {
+      auto r = t.get();
+      if (!r) {
+        r.rethrow();
+      }
+    }
+  }  // end of initializeValuesInParallelImplementation
+
+  void initializeValuesInParallel(mgis::ThreadPool& p,
+                                  mgis::span<mgis::real> v,
+                                  const size_type n) {
+    initializeValuesInParallelImplementation(p, v, n);
+  }  // end of initializeValuesInParallel
+
+  void initializeValuesInParallel(mgis::ThreadPool& p,
+                                  mgis::span<float> v,
+                                  const size_type n) {
+    initializeValuesInParallelImplementation(p, v, n);
+  }  // end of initializeValuesInParallel
+
 }  // end of namespace mgis::behaviour
@@ -0,0 +1,223 @@
+/*!
+ * \file   MemoryResource.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <new>
+#include <cstdint>
+#include <algorithm>
+#ifdef __linux__
+#include <cstdlib>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif /* __linux__ */
+#include "MGIS/Raise.hxx"
+#include "MGIS/MemoryResource.hxx"
+
+namespace mgis {
+
+  MemoryResource::~MemoryResource() = default;
+
+  //! \brief memory resource based on the global `operator new`
+  struct DefaultMemoryResource final : MemoryResource {
+    void* allocate(const std::size_t s, const std::size_t a) override {
+      if (a > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        return ::operator new(s, std::align_val_t{a});
+      }
+      return ::operator new(s);
+    }  // end of allocate
+    void deallocate(void* const p,
+                    const std::size_t,
+                    const std::size_t a) noexcept override {
+      if (a > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        ::operator delete(p, std::align_val_t{a});
+      } else {
+        ::operator delete(p);
+      }
+    }  // end of deallocate
+  };   // end of struct DefaultMemoryResource
+
+  //! \brief memory resource returning memory blocks aligned on cache lines
+  struct AlignedMemoryResource final : MemoryResource {
+    //! \brief alignment of the memory blocks
+    static constexpr std::size_t alignment = 64;
+    void* allocate(const std::size_t s, const std::size_t a) override {
+      return ::operator new(s, std::align_val_t{std::max(a, alignment)});
+    }  // end of allocate
+    void deallocate(void* const p,
+                    const std::size_t,
+                    const std::size_t a) noexcept override {
+      ::operator delete(p, std::align_val_t{std::max(a, alignment)});
+    }  // end of deallocate
+  };   // end of struct AlignedMemoryResource
+
+  /*!
+   * \brief memory resource returning large memory blocks backed by huge
+   * pages. Small memory blocks are delegated to the aligned memory resource.
+   */
+  struct HugePagesMemoryResource final : MemoryResource {
+    /*!
+     * \brief constructor
+     * \param[in] b: use explicit huge pages (`MAP_HUGETLB`)
+     */
+    HugePagesMemoryResource(const bool b) : hugetlb(b) {}
+    void* allocate(const std::size_t s, const std::size_t a) override {
+#ifdef __linux__
+      if ((s >= huge_page_size) && (a <= huge_page_size)) {
+        return this->map(getMappingSize(s));
+      }
+#endif /* __linux__ */
+      return this->aligned.allocate(s, a);
+    }  // end of allocate
+    void deallocate(void* const p,
+                    const std::size_t s,
+                    const std::size_t a) noexcept override {
+#ifdef __linux__
+      if ((s >= huge_page_size) && (a <= huge_page_size)) {
+        ::munmap(p, getMappingSize(s));
+        return;
+      }
+#endif /* __linux__ */
+      this->aligned.deallocate(p, s, a);
+    }  // end of deallocate
+
+   private:
+    //! \brief size of a huge page
+    static constexpr std::size_t huge_page_size = std::size_t{2} << 20;
+    //! \return the size of the mapping associated with a memory block
+    static std::size_t getMappingSize(const std::size_t s) {
+      return ((s + huge_page_size - 1) / huge_page_size) * huge_page_size;
+    }
+#ifdef __linux__
+    /*!
+     * \return a memory mapping aligned on a huge page boundary
+     * \param[in] s: size of the mapping, multiple of the huge page size
+     */
+    void* map(const std::size_t s) const {
+      constexpr auto prot = PROT_READ | PROT_WRITE;
+      constexpr auto flags = MAP_PRIVATE | MAP_ANONYMOUS;
+      if (this->hugetlb) {
+        auto* const p = ::mmap(nullptr, s, prot, flags | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED) {
+          return p;
+        }
+      }
+      // over-allocation to align the mapping on a huge page boundary
+      auto* const p = ::mmap(nullptr, s + huge_page_size, prot, flags, -1, 0);
+      if (p == MAP_FAILED) {
+        throw std::bad_alloc();
+      }
+      const auto b = reinterpret_cast<std::uintptr_t>(p);
+      const auto ab = ((b + huge_page_size - 1) / huge_page_size) *
+                      huge_page_size;
+      if (ab != b) {
+        ::munmap(p, ab - b);
+      }
+      if (const auto tail = b + huge_page_size - ab; tail != 0) {
+        ::munmap(reinterpret_cast<void*>(ab + s), tail);
+      }
+      auto* const r = reinterpret_cast<void*>(ab);
+#ifdef MADV_HUGEPAGE
+      // failure is not an error: transparent huge pages may be disabled
+      ::madvise(r, s, MADV_HUGEPAGE);
+#endif /* MADV_HUGEPAGE */
+      return r;
+    }  // end of map
+#endif /* __linux__ */
+    //! \brief memory resource used for small blocks
+    AlignedMemoryResource aligned;
+    //! \brief use explicit huge pages
+    const bool hugetlb;
+  };  // end of struct HugePagesMemoryResource
+
+  MemoryResource& getDefaultMemoryResource() {
+    static DefaultMemoryResource r;
+    return r;
+  }  // end of getDefaultMemoryResource
+
+  MemoryResource& getMemoryResource(const AllocationPolicy p) {
+    if (p == AllocationPolicy::ALIGNED) {
+      static AlignedMemoryResource r;
+      return r;
+    } else if (p == AllocationPolicy::TRANSPARENT_HUGE_PAGES) {
+      static HugePagesMemoryResource r(false);
+      return r;
+    } else if (p == AllocationPolicy::HUGETLB) {
+      static HugePagesMemoryResource r(true);
+      return r;
+    } else if (p != AllocationPolicy::DEFAULT) {
+      mgis::raise("getMemoryResource: invalid allocation policy");
+    }
+    return getDefaultMemoryResource();
+  }  // end of getMemoryResource
+
+  FileBackedMemoryResource::FileBackedMemoryResource(const std::string& d,
+                                                     const std::size_t s)
+      : directory(d), minimal_size(s) {}  // end of FileBackedMemoryResource
+
+  bool FileBackedMemoryResource::isFileBacked(const std::size_t s,
+                                              const std::size_t a) const {
+#ifdef __linux__
+    // mappings are aligned on pages
+    return (s != 0) && (s >= this->minimal_size) && (a <= 4096);
+#else  /* __linux__ */
+    static_cast<void>(s);
+    static_cast<void>(a);
+    return false;
+#endif /* __linux__ */
+  }  // end of isFileBacked
+
+  void* FileBackedMemoryResource::allocate(const std::size_t s,
+                                           const std::size_t a) {
+    if (!this->isFileBacked(s, a)) {
+      return getMemoryResource(AllocationPolicy::ALIGNED).allocate(s, a);
+    }
+#ifdef __linux__
+    auto f = this->directory + "/mgis-XXXXXX";
+    const auto fd = ::mkstemp(f.data());
+    if (fd == -1) {
+      mgis::raise("FileBackedMemoryResource::allocate: can't create a file "
+                  "in directory '" + this->directory + "'");
+    }
+    // the file is deleted when unmapped
+    ::unlink(f.c_str());
+    if (::ftruncate(fd, static_cast<off_t>(s)) != 0) {
+      ::close(fd);
+      throw std::bad_alloc();
+    }
+    auto* const p =
+        ::mmap(nullptr, s, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+      throw std::bad_alloc();
+    }
+    return p;
+#else  /* __linux__ */
+    return nullptr;
+#endif /* __linux__ */
+  }  // end of allocate
+
+  void FileBackedMemoryResource::deallocate(void* const p,
+                                            const std::size_t s,
+                                            const std::size_t a) noexcept {
+    if (!this->isFileBacked(s, a)) {
+      getMemoryResource(AllocationPolicy::ALIGNED).deallocate(p, s, a);
+      return;
+    }
+#ifdef __linux__
+    ::munmap(p, s);
+#endif /* __linux__ */
+  }  // end of deallocate
+
+  FileBackedMemoryResource::~FileBackedMemoryResource() = default;
+
+}  // end of namespace mgis
@@ -0,0 +1,65 @@
+/*!
+ * \file   Partition.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <algorithm>
+#include "MGIS/Raise.hxx"
+#include "MGIS/Partition.hxx"
+
+namespace mgis {
+
+  std::vector<size_type> getUniformPartition(const size_type n,
+                                             const size_type nchunks) {
+    if (nchunks == 0) {
+      mgis::raise("getUniformPartition: invalid number of chunks");
+    }
+    auto bounds = std::vector<size_type>(nchunks + 1);
+    const auto d = n / nchunks;
+    const auto r = n % nchunks;
+    for (size_type i = 0; i != nchunks + 1; ++i) {
+      bounds[i] = i * d + std::min(i, r);
+    }
+    return bounds;
+  }  // end of getUniformPartition
+
+  std::vector<size_type> getBalancedPartition(mgis::span<const real> costs,
+                                              const size_type nchunks) {
+    if (nchunks == 0) {
+      mgis::raise("getBalancedPartition: invalid number of chunks");
+    }
+    const auto n = static_cast<size_type>(costs.size());
+    auto total = real{};
+    for (const auto c : costs) {
+      total += std::max(c, real{0});
+    }
+    if (!(total > 0)) {
+      return getUniformPartition(n, nchunks);
+    }
+    auto bounds = std::vector<size_type>{};
+    bounds.reserve(nchunks + 1);
+    bounds.push_back(0);
+    auto acc = real{};
+    for (size_type i = 0; (i != n) && (bounds.size() != nchunks); ++i) {
+      const auto c = std::max(costs[i], real{0});
+      const auto mid = acc + c / 2;
+      while ((bounds.size() != nchunks) &&
+             (mid > total * bounds.size() / nchunks)) {
+        bounds.push_back(i);
+      }
+      acc += c;
+    }
+    bounds.resize(nchunks + 1, n);
+    return bounds;
+  }  // end of getBalancedPartition
+
+}  // end of namespace mgis
@@ -0,0 +1,267 @@
+/*!
+ * \file   Profiling.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <limits>
+#include <string>
+#include <ostream>
+#include <algorithm>
+#include "MGIS/Raise.hxx"
+#include "MGIS/Profiling.hxx"
+
+namespace mgis::profiling {
+
+  //! \brief profiling data of a thread
+  struct ThreadData {
+    //! \brief mutex protecting the profile
+    std::mutex m;
+    //! \brief profile
+    ThreadProfile profile;
+  };  // end of struct ThreadData
+
+  //! \brief structure gathering the profiling data of all threads
+  struct ProfilingRegistry {
+    //! \return the unique instance of the registry
+    static ProfilingRegistry& get() {
+      static ProfilingRegistry r;
+      return r;
+    }  // end of get
+    //! \return the profiling data of the calling thread
+    ThreadData& getThreadData() {
+      thread_local ThreadData* d = nullptr;
+      if (d == nullptr) {
+        std::lock_guard<std::mutex> lock(this->m);
+        this->threads.push_back(std::make_unique<ThreadData>());
+        d = this->threads.back().get();
+        d->profile.thread = this->threads.size() - 1;
+      }
+      return *d;
+    }  // end of getThreadData
+    //! \brief mutex protecting the list of threads
+    std::mutex m;
+    /*!
+     * \brief profiling data of all the threads. Those data are never
+     * released, so that they outlive the threads.
+     */
+    std::vector<std::unique_ptr<ThreadData>> threads;
+    //! \brief runtime flag
+    std::atomic<bool> enabled = false;
+  };  // end of struct ProfilingRegistry
+
+  static const char* const region_names[number_of_regions] = {
+      "integrate",
+      "post_processing",
+      "initialize_function",
+      "build_evaluators",
+      "update_view",
+      "rotate_gradients",
+      "rotate_thermodynamic_forces",
+      "rotate_tangent_operator_blocks",
+      "convert_finite_strain_stress",
+      "convert_finite_strain_tangent_operator",
+      "thread_pool_task",
+      "thread_pool_queue",
+      "thread_pool_wait"};
+
+  const char* getRegionName(const Region r) {
+    return region_names[static_cast<size_type>(r)];
+  }  // end of getRegionName
+
+  Region getRegion(const std::string_view n) {
+    for (size_type i = 0; i != number_of_regions; ++i) {
+      if (n == region_names[i]) {
+        return static_cast<Region>(i);
+      }
+    }
+    mgis::raise("getRegion: no region named '" + std::string{n} + "'");
+  }  // end of getRegion
+
+  void merge(RegionStatistics& s1, const RegionStatistics& s2) {
+    if (s2.calls == 0) {
+      return;
+    }
+    if (s1.calls == 0) {
+      s1 = s2;
+      return;
+    }
+    s1.calls += s2.calls;
+    s1.points += s2.points;
+    s1.failures += s2.failures;
+    s1.total_time += s2.total_time;
+    s1.min_time = std::min(s1.min_time, s2.min_time);
+    s1.max_time = std::max(s1.max_time, s2.max_time);
+  }  // end of merge
+
+  RegionStatistics ProfilingReport::getTotal(const Region r) const {
+    auto s = RegionStatistics{};
+    for (const auto& t : this->threads) {
+      merge(s, t.regions[static_cast<size_type>(r)]);
+    }
+    return s;
+  }  // end of getTotal
+
+  real ProfilingReport::getLoadImbalance(const Region r) const {
+    auto n = size_type{};
+    auto tmax = real{};
+    auto tsum = real{};
+    for (const auto& t : this->threads) {
+      const auto& s = t.regions[static_cast<size_type>(r)];
+      if (s.calls == 0) {
+        continue;
+      }
+      ++n;
+      tmax = std::max(tmax, s.total_time);
+      tsum += s.total_time;
+    }
+    if ((n < 2) || (tsum <= 0)) {
+      return real{0};
+    }
+    return tmax * static_cast<real>(n) / tsum - 1;
+  }  // end of getLoadImbalance
+
+  bool isProfilingAvailable() {
+#ifdef MGIS_HAVE_PROFILING
+    return true;
+#else  /* MGIS_HAVE_PROFILING */
+    return false;
+#endif /* MGIS_HAVE_PROFILING */
+  }    // end of isProfilingAvailable
+
+  void enableProfiling(const bool b) {
+    if (isProfilingAvailable()) {
+      ProfilingRegistry::get().enabled = b;
+    }
+  }  // end of enableProfiling
+
+  bool isProfilingEnabled() {
+    return ProfilingRegistry::get().enabled;
+  }  // end of isProfilingEnabled
+
+  void resetProfiling() {
+    auto& r = ProfilingRegistry::get();
+    std::lock_guard<std::mutex> lock(r.m);
+    for (auto& t : r.threads) {
+      std::lock_guard<std::mutex> tlock(t->m);
+      t->profile.regions = {};
+    }
+  }  // end of resetProfiling
+
+  ProfilingReport getProfilingReport() {
+    auto& r = ProfilingRegistry::get();
+    auto report = ProfilingReport{};
+    std::lock_guard<std::mutex> lock(r.m);
+    report.threads.reserve(r.threads.size());
+    for (auto& t : r.threads) {
+      std::lock_guard<std::mutex> tlock(t->m);
+      report.threads.push_back(t->profile);
+    }
+    return report;
+  }  // end of getProfilingReport
+
+  void record(const Region r,
+              const real t,
+              const size_type n,
+              const bool f) {
+    auto& registry = ProfilingRegistry::get();
+    if (!registry.enabled) {
+      return;
+    }
+    auto& d = registry.getThreadData();
+    auto s = RegionStatistics{};
+    s.calls = 1;
+    s.points = n;
+    s.failures = f ? 1 : 0;
+    s.total_time = s.min_time = s.max_time = t;
+    std::lock_guard<std::mutex> lock(d.m);
+    merge(d.profile.regions[static_cast<size_type>(r)], s);
+  }  // end of record
+
+  static void print_json(std::ostream& os, const RegionStatistics& s) {
+    os << "{\"calls\": " << s.calls << ", \"points\": " << s.points
+       << ", \"failures\": " << s.failures
+       << ", \"total_time\": " << s.total_time
+       << ", \"min_time\": " << s.min_time << ", \"max_time\": " << s.max_time
+       << ", \"mean_time\": " << s.total_time / static_cast<real>(s.calls);
+  }  // end of print_json
+
+  void print_json(std::ostream& os, const ProfilingReport& r) {
+    const auto prec = os.precision(std::numeric_limits<real>::digits10);
+    os << "{\n"
+       << "  \"profiling_available\": "
+       << (isProfilingAvailable() ? "true" : "false") << ",\n"
+       << "  \"time_unit\": \"s\",\n"
+       << "  \"totals\": {";
+    auto first = true;
+    for (size_type i = 0; i != number_of_regions; ++i) {
+      const auto region = static_cast<Region>(i);
+      const auto s = r.getTotal(region);
+      if (s.calls == 0) {
+        continue;
+      }
+      os << (first ? "\n" : ",\n") << "    \"" << getRegionName(region)
+         << "\": ";
+      print_json(os, s);
+      os << ", \"load_imbalance\": " << r.getLoadImbalance(region) << "}";
+      first = false;
+    }
+    os << "\n  },\n"
+       << "  \"threads\": [";
+    for (size_type t = 0; t != r.threads.size(); ++t) {
+      const auto& p = r.threads[t];
+      os << (t == 0 ? "\n" : ",\n") << "    {\"thread\": " << p.thread
+         << ", \"regions\": {";
+      first = true;
+      for (size_type i = 0; i != number_of_regions; ++i) {
+        const auto& s = p.regions[i];
+        if (s.calls == 0) {
+          continue;
+        }
+        os << (first ? "\n" : ",\n") << "      \""
+           << getRegionName(static_cast<Region>(i)) << "\": ";
+        print_json(os, s);
+        os << "}";
+        first = false;
+      }
+      os << "}}";
+    }
+    os << "\n  ]\n}\n";
+    os.precision(prec);
+  }  // end of print_json
+
+  ProfilingTimer::ProfilingTimer(const Region r, const size_type n)
+      : region(r), points(n), active(isProfilingEnabled()) {
+    if (this->active) {
+      this->start = std::chrono::steady_clock::now();
+    }
+  }  // end of ProfilingTimer
+
+  void ProfilingTimer::setNumberOfPoints(const size_type n) {
+    this->points = n;
+  }  // end of setNumberOfPoints
+
+  void ProfilingTimer::setFailure() { this->failure = true; }
+
+  ProfilingTimer::~ProfilingTimer() {
+    if (!this->active) {
+      return;
+    }
+    const auto t = std::chrono::duration<real>(
+                       std::chrono::steady_clock::now() - this->start)
+                       .count();
+    record(this->region, t, this->points, this->failure);
+  }  // end of ~ProfilingTimer
+
+}  // end of namespace mgis::profiling
@@ -0,0 +1,287 @@
+/*!
+ * \file   Reordering.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <limits>
+#include <string>
+#include <cstdint>
+#include <numeric>
+#include <algorithm>
+#include "MGIS/Raise.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Reordering.hxx"
+
+namespace mgis::behaviour {
+
+  /*!
+   * \brief map the coordinates of the points on a grid of `2^b` cells in
+   * each direction, using the bounding box of the points.
+   * \return the integer coordinates of the points
+   * \param[in] coordinates: coordinates of the points
+   * \param[in] d: space dimension
+   * \param[in] b: number of bits per direction
+   * \param[in] n: name of the calling function
+   */
+  static std::vector<std::uint32_t> getGridCoordinates(
+      mgis::span<const real> coordinates,
+      const size_type d,
+      const size_type b,
+      const char* const n) {
+    if ((d == 0) || (d > 3)) {
+      mgis::raise(std::string{n} + ": invalid space dimension");
+    }
+    const auto size = static_cast<size_type>(coordinates.size());
+    if (size % d != 0) {
+      mgis::raise(std::string{n} + ": invalid size of the coordinates");
+    }
+    const auto np = size / d;
+    auto cmin = std::vector<real>(d, std::numeric_limits<real>::max());
+    auto cmax = std::vector<real>(d, std::numeric_limits<real>::lowest());
+    for (size_type i = 0; i != np; ++i) {
+      for (size_type c = 0; c != d; ++c) {
+        cmin[c] = std::min(cmin[c], coordinates[i * d + c]);
+        cmax[c] = std::max(cmax[c], coordinates[i * d + c]);
+      }
+    }
+    // a common scale is used in all directions to preserve the aspect ratio
+    auto l = real{};
+    for (size_type c = 0; c != d; ++c) {
+      l = std::max(l, cmax[c] - cmin[c]);
+    }
+    const auto cmax_grid = static_cast<real>((std::uint64_t{1} << b) - 1);
+    const auto scale = (l > 0) ? cmax_grid / l : real{0};
+    auto r = std::vector<std::uint32_t>(size);
+    for (size_type i = 0; i != np; ++i) {
+      for (size_type c = 0; c != d; ++c) {
+        const auto x = (coordinates[i * d + c] - cmin[c]) * scale;
+        r[i * d + c] = static_cast<std::uint32_t>(
+            std::min(std::max(x, real{0}), cmax_grid));
+      }
+    }
+    return r;
+  }  // end of getGridCoordinates
+
+  //! \return the number of bits per direction
+  static size_type getNumberOfBits(const size_type d) {
+    return std::min(size_type{32}, size_type{64} / std::max(d, size_type{1}));
+  }  // end of getNumberOfBits
+
+  /*!
+   * \return the permutation sorting the points by increasing keys
+   * \param[in] keys: keys
+   */
+  static std::vector<size_type> sortByKeys(
+      const std::vector<std::uint64_t>& keys) {
+    auto p = std::vector<size_type>(keys.size());
+    std::iota(p.begin(), p.end(), size_type{0});
+    std::stable_sort(p.begin(), p.end(), [&keys](const size_type i,
+                                                 const size_type j) {
+      return keys[i] < keys[j];
+    });
+    return p;
+  }  // end of sortByKeys
+
+  std::vector<size_type> getMortonOrdering(mgis::span<const real> coordinates,
+                                           const size_type d) {
+    const auto b = getNumberOfBits(d);
+    const auto x = getGridCoordinates(coordinates, d, b, "getMortonOrdering");
+    const auto np = x.size() / d;
+    auto keys = std::vector<std::uint64_t>(np);
+    for (size_type i = 0; i != np; ++i) {
+      auto key = std::uint64_t{};
+      for (size_type j = b; j-- > 0;) {
+        for (size_type c = 0; c != d; ++c) {
+          key = (key << 1) | ((x[i * d + c] >> j) & 1u);
+        }
+      }
+      keys[i] = key;
+    }
+    return sortByKeys(keys);
+  }  // end of getMortonOrdering
+
+  std::vector<size_type> getHilbertOrdering(mgis::span<const real> coordinates,
+                                            const size_type d) {
+    if (d == 1) {
+      // in one dimension, the Hilbert and Morton curves are identical
+      return getMortonOrdering(coordinates, d);
+    }
+    const auto b = getNumberOfBits(d);
+    auto x = getGridCoordinates(coordinates, d, b, "getHilbertOrdering");
+    const auto np = x.size() / d;
+    auto keys = std::vector<std::uint64_t>(np);
+    const auto M = std::uint32_t{1} << (b - 1);
+    for (size_type i = 0; i != np; ++i) {
+      auto* const X = x.data() + i * d;
+      // transposition of the Hilbert index, following J. Skilling,
+      // "Programming the Hilbert curve", AIP Conference Proceedings, 2004
+      for (auto Q = M; Q > 1; Q >>= 1) {
+        const auto P = Q - 1;
+        for (size_type c = 0; c != d; ++c) {
+          if (X[c] & Q) {
+            X[0] ^= P;
+          } else {
+            const auto t = (X[0] ^ X[c]) & P;
+            X[0] ^= t;
+            X[c] ^= t;
+          }
+        }
+      }
+      // Gray encoding
+      for (size_type c = 1; c != d; ++c) {
+        X[c] ^= X[c - 1];
+      }
+      auto t = std::uint32_t{};
+      for (auto Q = M; Q > 1; Q >>= 1) {
+        if (X[d - 1] & Q) {
+          t ^= Q - 1;
+        }
+      }
+      auto key = std::uint64_t{};
+      for (size_type j = b; j-- > 0;) {
+        for (size_type c = 0; c != d; ++c) {
+          key = (key << 1) | (((X[c] ^ t) >> j) & 1u);
+        }
+      }
+      keys[i] = key;
+    }
+    return sortByKeys(keys);
+  }  // end of getHilbertOrdering
+
+  std::vector<size_type> getInversePermutation(
+      mgis::span<const size_type> p) {
+    const auto n = static_cast<size_type>(p.size());
+    auto q = std::vector<size_type>(n, n);
+    for (size_type k = 0; k != n; ++k) {
+      if ((p[k] >= n) || (q[p[k]] != n)) {
+        mgis::raise("getInversePermutation: invalid permutation");
+      }
+      q[p[k]] = k;
+    }
+    return q;
+  }  // end of getInversePermutation
+
+  /*!
+   * \brief reorder the blocks of the given array
+   * \param[in,out] values: values
+   * \param[in] p: permutation
+   * \param[in] wk: workspace
+   */
+  template <typename ValueType>
+  static void permuteValues(mgis::span<ValueType> values,
+                            mgis::span<const size_type> p,
+                            std::vector<ValueType>& wk) {
+    const auto n = static_cast<size_type>(p.size());
+    const auto size = static_cast<size_type>(values.size());
+    if ((size == 0) || (n == 0)) {
+      return;
+    }
+    if (size % n != 0) {
+      mgis::raise("reorderIntegrationPoints: invalid array size");
+    }
+    const auto s = size / n;
+    wk.assign(values.begin(), values.end());
+    for (size_type k = 0; k != n; ++k) {
+      std::copy(wk.begin() + p[k] * s, wk.begin() + (p[k] + 1) * s,
+                values.begin() + k * s);
+    }
+  }  // end of permuteValues
+
+  /*!
+   * \brief reorder the blocks of the given array
+   * \param[in,out] values: values
+   * \param[in] p: permutation
+   * \param[in] wk: workspace
+   */
+  static void permute(mgis::span<real> values,
+                      mgis::span<const size_type> p,
+                      std::vector<real>& wk) {
+    permuteValues(values, p, wk);
+  }  // end of permute
+
+  /*!
+   * \brief reorder the spatially variable fields. Fields whose size is
+   * equal to the size of the associated variable are uniform and are left
+   * unchanged.
+   * \param[in,out] fields: fields
+   * \param[in] variables: variables associated with the fields
+   * \param[in] h: modelling hypothesis
+   * \param[in] p: permutation
+   * \param[in] wk: workspace
+   */
+  static void permute(
+      std::map<std::string, MaterialStateManager::FieldHolder>& fields,
+      const std::vector<Variable>& variables,
+      const Hypothesis h,
+      mgis::span<const size_type> p,
+      std::vector<real>& wk) {
+    auto is_uniform = [&variables, h](const std::string& n,
+                                      const size_type size) {
+      if (!contains(variables, n)) {
+        return false;
+      }
+      return size == getVariableSize(getVariable(variables, n), h);
+    };
+    for (auto& f : fields) {
+      if (std::holds_alternative<mgis::span<real>>(f.second)) {
+        auto& values = std::get<mgis::span<real>>(f.second);
+        if (!is_uniform(f.first, static_cast<size_type>(values.size()))) {
+          permute(values, p, wk);
+        }
+      } else if (std::holds_alternative<std::vector<real>>(f.second)) {
+        auto& values = std::get<std::vector<real>>(f.second);
+        if (!is_uniform(f.first, values.size())) {
+          permute(values, p, wk);
+        }
+      }
+    }
+  }  // end of permute
+
+  /*!
+   * \brief reorder the state of the integration points
+   * \param[in,out] s: state
+   * \param[in] p: permutation
+   * \param[in] wk: workspace
+   */
+  static void permute(MaterialStateManager& s,
+                      mgis::span<const size_type> p,
+                      std::vector<real>& wk) {
+    permute(s.gradients, p, wk);
+    permute(s.thermodynamic_forces, p, wk);
+    permute(s.internal_state_variables, p, wk);
+    permute(s.stored_energies, p, wk);
+    permute(s.dissipated_energies, p, wk);
+    permute(s.material_properties, s.b.mps, s.b.hypothesis, p, wk);
+    permute(s.external_state_variables, s.b.esvs, s.b.hypothesis, p, wk);
+  }  // end of permute
+
+  void reorderIntegrationPoints(MaterialDataManager& m,
+                                mgis::span<const size_type> p) {
+    if (static_cast<size_type>(p.size()) != m.n) {
+      mgis::raise("reorderIntegrationPoints: invalid permutation size");
+    }
+    // check that p is a permutation
+    getInversePermutation(p);
+    auto wk = std::vector<real>{};
+    permute(m.s0, p, wk);
+    permute(m.s1, p, wk);
+    permute(m.K, p, wk);
+    if (!m.K_single_precision.empty()) {
+      auto wk2 = std::vector<float>{};
+      permuteValues(m.K_single_precision, p, wk2);
+    }
+    permute(m.speed_of_sound, p, wk);
+    permute(m.integration_costs, p, wk);
+  }  // end of reorderIntegrationPoints
+
+}  // end of namespace mgis::behaviour
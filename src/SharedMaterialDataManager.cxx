@@ -0,0 +1,433 @@
+/*!
+ * \file   SharedMaterialDataManager.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <array>
+#include <cerrno>
+#include <limits>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif /* __linux__ */
+#include "MGIS/Raise.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/SharedMaterialDataManager.hxx"
+
+namespace mgis::behaviour {
+
+  //! \brief version of the layout of the shared memory segments
+  static constexpr std::uint32_t shared_memory_layout_version = 1;
+
+  //! \brief header stored at the beginning of a shared memory segment
+  struct SharedMemoryHeader {
+    //! \brief magic string
+    char magic[8];
+    //! \brief version of the layout
+    std::uint32_t version;
+    //! \brief options used to create the segment
+    std::uint32_t options;
+    //! \brief number of integration points
+    std::uint64_t n;
+    //! \brief size of the segment, in bytes
+    std::uint64_t size;
+    //! \brief hash of the name and modelling hypothesis of the behaviour
+    std::uint64_t behaviour;
+    //! \brief size of the gradients per integration point
+    std::uint64_t gradients_stride;
+    //! \brief size of the thermodynamic forces per integration point
+    std::uint64_t thermodynamic_forces_stride;
+    //! \brief size of the internal state variables per integration point
+    std::uint64_t internal_state_variables_stride;
+    //! \brief size of the tangent operator blocks per integration point
+    std::uint64_t K_stride;
+  };  // end of struct SharedMemoryHeader
+
+  //! \brief size reserved for the header, in bytes
+  static constexpr std::size_t shared_memory_header_size = 128;
+
+  static_assert(sizeof(SharedMemoryHeader) <= shared_memory_header_size);
+  static_assert(shared_memory_header_size % 64 == 0);
+
+  //! \brief magic string identifying the shared memory segments
+  static constexpr char shared_memory_magic[8] = {'M', 'G', 'I', 'S',
+                                                  'S', 'H', 'M', '\0'};
+
+  //! \brief a simple alias
+  using SharedFields = std::vector<std::pair<std::string, mgis::span<real>>>;
+
+  //! \brief description of the arrays stored in a shared memory segment
+  struct SharedArrays {
+    //! \brief initializer of the material data manager
+    MaterialDataManagerInitializer initializer;
+    //! \brief material properties of the states
+    std::array<SharedFields, 2> material_properties;
+    //! \brief external state variables of the states
+    std::array<SharedFields, 2> external_state_variables;
+  };  // end of struct SharedArrays
+
+  /*!
+   * \brief describe the arrays stored in a shared memory segment, the arrays
+   * being given by the `get` functor
+   * \param[in] b: behaviour
+   * \param[in] o: options
+   * \param[in] get: functor returning a view to an array given the number of
+   * values per integration point
+   */
+  template <typename Functor>
+  static SharedArrays getSharedArrays(const Behaviour& b,
+                                      const SharedMaterialDataManagerOptions& o,
+                                      const Functor& get) {
+    const auto h = b.hypothesis;
+    SharedArrays a;
+    auto& i = a.initializer;
+    for (auto* const s : {&i.s0, &i.s1}) {
+      s->gradients = get(getArraySize(b.gradients, h));
+      s->thermodynamic_forces = get(getArraySize(b.thermodynamic_forces, h));
+      s->internal_state_variables = get(getArraySize(b.isvs, h));
+      if (b.computesStoredEnergy) {
+        s->stored_energies = get(1);
+      }
+      if (b.computesDissipatedEnergy) {
+        s->dissipated_energies = get(1);
+      }
+    }
+    if (o.tangent_operator) {
+      i.K = get(getTangentOperatorArraySize(b));
+    }
+    if (o.speed_of_sound) {
+      i.speed_of_sound = get(1);
+    }
+    if (o.integration_costs) {
+      i.integration_costs = get(1);
+    }
+    for (size_type s = 0; s != 2; ++s) {
+      if (o.material_properties) {
+        for (const auto& mp : b.mps) {
+          // only scalar material properties are supported
+          if (mp.type == Variable::SCALAR) {
+            a.material_properties[s].push_back({mp.name, get(1)});
+          }
+        }
+      }
+      if (o.external_state_variables) {
+        for (const auto& esv : b.esvs) {
+          a.external_state_variables[s].push_back(
+              {esv.name, get(getVariableSize(esv, h))});
+        }
+      }
+    }
+    return a;
+  }  // end of getSharedArrays
+
+  /*!
+   * \return the size of the segment, in bytes
+   * \param[in] b: behaviour
+   * \param[in] n: number of integration points
+   * \param[in] o: options
+   */
+  static std::size_t getSegmentSize(const Behaviour& b,
+                                    const size_type n,
+                                    const SharedMaterialDataManagerOptions& o) {
+    auto size = size_type{};
+    auto count = [&size, n](const size_type s) {
+      size = internals::alignOffsetOnCacheLine(size) + n * s;
+      return mgis::span<real>{};
+    };
+    getSharedArrays(b, o, count);
+    return shared_memory_header_size + size * sizeof(real);
+  }  // end of getSegmentSize
+
+  //! \return the options encoded as a bit field
+  static std::uint32_t encodeOptions(
+      const SharedMaterialDataManagerOptions& o) {
+    return (o.tangent_operator ? 1u : 0u) | (o.speed_of_sound ? 2u : 0u) |
+           (o.integration_costs ? 4u : 0u) |
+           (o.material_properties ? 8u : 0u) |
+           (o.external_state_variables ? 16u : 0u);
+  }  // end of encodeOptions
+
+  //! \return the options decoded from a bit field
+  static SharedMaterialDataManagerOptions decodeOptions(const std::uint32_t v) {
+    auto o = SharedMaterialDataManagerOptions{};
+    o.tangent_operator = (v & 1u) != 0;
+    o.speed_of_sound = (v & 2u) != 0;
+    o.integration_costs = (v & 4u) != 0;
+    o.material_properties = (v & 8u) != 0;
+    o.external_state_variables = (v & 16u) != 0;
+    return o;
+  }  // end of decodeOptions
+
+  //! \return a hash of the name and the modelling hypothesis of a behaviour
+  static std::uint64_t getBehaviourHash(const Behaviour& b) {
+    // FNV-1a
+    auto h = std::uint64_t{14695981039346656037ull};
+    const auto id = b.behaviour + '/' + toString(b.hypothesis);
+    for (const auto c : id) {
+      h ^= static_cast<unsigned char>(c);
+      h *= std::uint64_t{1099511628211ull};
+    }
+    return h;
+  }  // end of getBehaviourHash
+
+  //! \return the header describing a segment
+  static SharedMemoryHeader getHeader(
+      const Behaviour& b,
+      const size_type n,
+      const SharedMaterialDataManagerOptions& o) {
+    auto h = SharedMemoryHeader{};
+    std::memcpy(h.magic, shared_memory_magic, sizeof(h.magic));
+    h.version = shared_memory_layout_version;
+    h.options = encodeOptions(o);
+    h.n = n;
+    h.size = getSegmentSize(b, n, o);
+    h.behaviour = getBehaviourHash(b);
+    h.gradients_stride = getArraySize(b.gradients, b.hypothesis);
+    h.thermodynamic_forces_stride =
+        getArraySize(b.thermodynamic_forces, b.hypothesis);
+    h.internal_state_variables_stride = getArraySize(b.isvs, b.hypothesis);
+    h.K_stride = getTangentOperatorArraySize(b);
+    return h;
+  }  // end of getHeader
+
+  //! \return the name of the segment, starting with a slash
+  static std::string getSegmentName(const std::string& n) {
+    if (n.empty()) {
+      mgis::raise("SharedMaterialDataManager: empty segment name");
+    }
+    return n[0] == '/' ? n : '/' + n;
+  }  // end of getSegmentName
+
+#ifdef __linux__
+
+  //! \return a description of the last system error
+  static std::string getSystemErrorMessage() {
+    return std::strerror(errno);
+  }  // end of getSystemErrorMessage
+
+#endif /* __linux__ */
+
+  SharedMaterialDataManager::SharedMaterialDataManager(
+      const Behaviour& b,
+      const size_type s,
+      const std::string& id,
+      const SharedMaterialDataManagerOptions& o)
+      : name(getSegmentName(id)), n(s), owner(true) {
+#ifdef __linux__
+    const auto h = getHeader(b, s, o);
+    const auto fd = ::shm_open(this->name.c_str(), O_CREAT | O_EXCL | O_RDWR,
+                               S_IRUSR | S_IWUSR);
+    if (fd == -1) {
+      mgis::raise("SharedMaterialDataManager: can't create segment '" +
+                  this->name + "' (" + getSystemErrorMessage() + ")");
+    }
+    // the segment is filled with zeros
+    if (::ftruncate(fd, static_cast<off_t>(h.size)) != 0) {
+      const auto msg = getSystemErrorMessage();
+      ::close(fd);
+      ::shm_unlink(this->name.c_str());
+      mgis::raise("SharedMaterialDataManager: can't resize segment '" +
+                  this->name + "' (" + msg + ")");
+    }
+    auto* const p =
+        ::mmap(nullptr, h.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+      ::shm_unlink(this->name.c_str());
+      mgis::raise("SharedMaterialDataManager: can't map segment '" +
+                  this->name + "'");
+    }
+    this->address = p;
+    this->size = h.size;
+    try {
+      std::memcpy(this->address, &h, sizeof(h));
+      this->build(b, o, 0, s);
+      internals::initializeDeformationGradients(this->manager->s0);
+      internals::initializeDeformationGradients(this->manager->s1);
+    } catch (...) {
+      this->release();
+      throw;
+    }
+#else  /* __linux__ */
+    static_cast<void>(b);
+    static_cast<void>(o);
+    mgis::raise(
+        "SharedMaterialDataManager: shared memory segments are not "
+        "supported on this system");
+#endif /* __linux__ */
+  }  // end of SharedMaterialDataManager
+
+  SharedMaterialDataManager::SharedMaterialDataManager(const Behaviour& b,
+                                                       const std::string& id)
+      : SharedMaterialDataManager(
+            b, id, 0, std::numeric_limits<size_type>::max()) {
+  }  // end of SharedMaterialDataManager
+
+  SharedMaterialDataManager::SharedMaterialDataManager(const Behaviour& b,
+                                                       const std::string& id,
+                                                       const size_type ib,
+                                                       const size_type ie)
+      : name(getSegmentName(id)) {
+#ifdef __linux__
+    const auto fd = ::shm_open(this->name.c_str(), O_RDWR, 0);
+    if (fd == -1) {
+      mgis::raise("SharedMaterialDataManager: can't open segment '" +
+                  this->name + "' (" + getSystemErrorMessage() + ")");
+    }
+    struct stat st;
+    if ((::fstat(fd, &st) != 0) ||
+        (static_cast<std::size_t>(st.st_size) < shared_memory_header_size)) {
+      ::close(fd);
+      mgis::raise("SharedMaterialDataManager: invalid segment '" +
+                  this->name + "'");
+    }
+    const auto s = static_cast<std::size_t>(st.st_size);
+    auto* const p =
+        ::mmap(nullptr, s, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) {
+      mgis::raise("SharedMaterialDataManager: can't map segment '" +
+                  this->name + "'");
+    }
+    this->address = p;
+    this->size = s;
+    try {
+      auto h = SharedMemoryHeader{};
+      std::memcpy(&h, this->address, sizeof(h));
+      if ((std::memcmp(h.magic, shared_memory_magic, sizeof(h.magic)) != 0) ||
+          (h.version != shared_memory_layout_version)) {
+        mgis::raise("SharedMaterialDataManager: segment '" + this->name +
+                    "' has not been created by a SharedMaterialDataManager "
+                    "or by an incompatible version");
+      }
+      this->n = h.n;
+      const auto o = decodeOptions(h.options);
+      const auto eh = getHeader(b, this->n, o);
+      if (h.behaviour != eh.behaviour) {
+        mgis::raise("SharedMaterialDataManager: segment '" + this->name +
+                    "' does not match behaviour '" + b.behaviour + "'");
+      }
+      if ((h.gradients_stride != eh.gradients_stride) ||
+          (h.thermodynamic_forces_stride != eh.thermodynamic_forces_stride) ||
+          (h.internal_state_variables_stride !=
+           eh.internal_state_variables_stride) ||
+          (h.K_stride != eh.K_stride) || (h.size != eh.size) ||
+          (this->size < h.size)) {
+        mgis::raise("SharedMaterialDataManager: the layout of segment '" +
+                    this->name + "' does not match behaviour '" +
+                    b.behaviour + "'");
+      }
+      const auto e = std::min(ie, this->n);
+      if (ib > e) {
+        mgis::raise("SharedMaterialDataManager: invalid range");
+      }
+      this->build(b, o, ib, e);
+    } catch (...) {
+      this->release();
+      throw;
+    }
+#else  /* __linux__ */
+    static_cast<void>(b);
+    static_cast<void>(ib);
+    static_cast<void>(ie);
+    mgis::raise(
+        "SharedMaterialDataManager: shared memory segments are not "
+        "supported on this system");
+#endif /* __linux__ */
+  }  // end of SharedMaterialDataManager
+
+  void SharedMaterialDataManager::build(
+      const Behaviour& b,
+      const SharedMaterialDataManagerOptions& o,
+      const size_type ib,
+      const size_type ie) {
+    auto* const values = reinterpret_cast<real*>(
+        static_cast<char*>(this->address) + shared_memory_header_size);
+    auto pos = size_type{};
+    auto get = [this, values, &pos, ib, ie](const size_type s) {
+      pos = internals::alignOffsetOnCacheLine(pos);
+      auto v = mgis::span<real>(values + pos + ib * s, (ie - ib) * s);
+      pos += this->n * s;
+      return v;
+    };
+    auto a = getSharedArrays(b, o, get);
+    this->offset = ib;
+    this->manager =
+        std::make_unique<MaterialDataManager>(b, ie - ib, a.initializer);
+    const auto states = std::array<MaterialStateManager*, 2>{
+        &(this->manager->s0), &(this->manager->s1)};
+    for (size_type s = 0; s != 2; ++s) {
+      for (const auto& mp : a.material_properties[s]) {
+        setMaterialProperty(*(states[s]), mp.first, mp.second,
+                            MaterialStateManager::EXTERNAL_STORAGE);
+      }
+      for (const auto& esv : a.external_state_variables[s]) {
+        setExternalStateVariable(*(states[s]), esv.first, esv.second,
+                                 MaterialStateManager::EXTERNAL_STORAGE);
+      }
+    }
+  }  // end of build
+
+  MaterialDataManager& SharedMaterialDataManager::getMaterialDataManager() {
+    return *(this->manager);
+  }  // end of getMaterialDataManager
+
+  const MaterialDataManager& SharedMaterialDataManager::getMaterialDataManager()
+      const {
+    return *(this->manager);
+  }  // end of getMaterialDataManager
+
+  const std::string& SharedMaterialDataManager::getName() const {
+    return this->name;
+  }  // end of getName
+
+  size_type SharedMaterialDataManager::getNumberOfIntegrationPoints() const {
+    return this->n;
+  }  // end of getNumberOfIntegrationPoints
+
+  size_type SharedMaterialDataManager::getOffset() const {
+    return this->offset;
+  }  // end of getOffset
+
+  bool SharedMaterialDataManager::isOwner() const {
+    return this->owner;
+  }  // end of isOwner
+
+  void SharedMaterialDataManager::release() noexcept {
+    this->manager.reset();
+#ifdef __linux__
+    if (this->address != nullptr) {
+      ::munmap(this->address, this->size);
+    }
+    if (this->owner) {
+      ::shm_unlink(this->name.c_str());
+    }
+#endif /* __linux__ */
+    this->address = nullptr;
+    this->size = 0;
+    this->owner = false;
+  }  // end of release
+
+  SharedMaterialDataManager::~SharedMaterialDataManager() {
+    this->release();
+  }  // end of ~SharedMaterialDataManager
+
+}  // end of namespace mgis::behaviour
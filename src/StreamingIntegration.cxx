@@ -0,0 +1,254 @@
+/*!
+ * \file   StreamingIntegration.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <map>
+#include <string>
+#include <future>
+#include <vector>
+#include <variant>
+#include <cstdint>
+#include <algorithm>
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/mman.h>
+#endif /* __linux__ */
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Partition.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/StreamingIntegration.hxx"
+
+namespace mgis::behaviour {
+
+  //! \brief description of an array storing values per integration point
+  struct StreamedArray {
+    //! \brief values
+    const char* values;
+    //! \brief number of bytes per integration point
+    size_type stride;
+  };  // end of struct StreamedArray
+
+  //! \brief add the given array to the list of streamed arrays
+  template <typename ValueType>
+  static void addArray(std::vector<StreamedArray>& arrays,
+                       mgis::span<ValueType> values,
+                       const size_type n) {
+    const auto size = static_cast<size_type>(values.size());
+    if ((n == 0) || (size == 0) || (size % n != 0)) {
+      return;
+    }
+    arrays.push_back({reinterpret_cast<const char*>(values.data()),
+                      (size / n) * sizeof(ValueType)});
+  }  // end of addArray
+
+  //! \brief add the given array to the list of streamed arrays
+  static void addArray(std::vector<StreamedArray>& arrays,
+                       std::vector<real>& values,
+                       const size_type n) {
+    addArray(arrays, mgis::span<real>(values), n);
+  }  // end of addArray
+
+  //! \brief add the spatially variable fields to the list of streamed arrays
+  static void addArrays(
+      std::vector<StreamedArray>& arrays,
+      std::map<std::string, MaterialStateManager::FieldHolder>& fields,
+      const size_type n) {
+    for (auto& f : fields) {
+      if (std::holds_alternative<mgis::span<real>>(f.second)) {
+        addArray(arrays, std::get<mgis::span<real>>(f.second), n);
+      } else if (std::holds_alternative<std::vector<real>>(f.second)) {
+        addArray(arrays, std::get<std::vector<real>>(f.second), n);
+      }
+    }
+  }  // end of addArrays
+
+  //! \brief add the arrays of the given state to the list of streamed arrays
+  static void addArrays(std::vector<StreamedArray>& arrays,
+                        MaterialStateManager& s) {
+    addArray(arrays, s.gradients, s.n);
+    addArray(arrays, s.thermodynamic_forces, s.n);
+    addArray(arrays, s.internal_state_variables, s.n);
+    addArray(arrays, s.stored_energies, s.n);
+    addArray(arrays, s.dissipated_energies, s.n);
+    addArrays(arrays, s.material_properties, s.n);
+    addArrays(arrays, s.external_state_variables, s.n);
+  }  // end of addArrays
+
+  /*!
+   * \brief give an advice to the operating system about the use of the data
+   * associated with the given range of integration points
+   * \param[in] arrays: arrays
+   * \param[in] b: first integration point
+   * \param[in] e: integration point past the last one
+   * \param[in] a: advice
+   * \param[in] extend: if true, the pages partially covered by the end of
+   * the range are included. Otherwise, they are excluded, so that the data
+   * of the next integration points are not affected.
+   */
+  [[maybe_unused]] static void advise(const std::vector<StreamedArray>& arrays,
+                                      const size_type b,
+                                      const size_type e,
+                                      [[maybe_unused]] const int a,
+                                      const bool extend) {
+#ifdef __linux__
+    static const auto page =
+        static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+    for (const auto& array : arrays) {
+      const auto pb =
+          reinterpret_cast<std::uintptr_t>(array.values + b * array.stride);
+      const auto pe =
+          reinterpret_cast<std::uintptr_t>(array.values + e * array.stride);
+      const auto ab = (pb / page) * page;
+      const auto ae = extend ? ((pe + page - 1) / page) * page  //
+                             : (pe / page) * page;
+      if (ae > ab) {
+        // failure is not an error, advices are only hints
+        ::madvise(reinterpret_cast<void*>(ab), ae - ab, a);
+      }
+    }
+#else  /* __linux__ */
+    static_cast<void>(arrays);
+    static_cast<void>(b);
+    static_cast<void>(e);
+    static_cast<void>(extend);
+#endif /* __linux__ */
+  }  // end of advise
+
+  //! \brief ask the operating system to read the given window in advance
+  static void prefetch(const std::vector<StreamedArray>& arrays,
+                       const size_type b,
+                       const size_type e) {
+#if defined(__linux__) && defined(MADV_WILLNEED)
+    advise(arrays, b, e, MADV_WILLNEED, true);
+#else
+    static_cast<void>(arrays);
+    static_cast<void>(b);
+    static_cast<void>(e);
+#endif
+  }  // end of prefetch
+
+  //! \brief ask the operating system to write back the given window
+  static void writeback(const std::vector<StreamedArray>& arrays,
+                        const size_type b,
+                        const size_type e) {
+#if defined(__linux__) && defined(MADV_PAGEOUT)
+    // the last page may be shared with the next window
+    advise(arrays, b, e, MADV_PAGEOUT, false);
+#elif defined(__linux__) && defined(MADV_COLD)
+    advise(arrays, b, e, MADV_COLD, false);
+#else
+    static_cast<void>(arrays);
+    static_cast<void>(b);
+    static_cast<void>(e);
+#endif
+  }  // end of writeback
+
+  /*!
+   * \brief integrate the behaviour over a window using the given thread pool
+   * \param[in] p: thread pool
+   * \param[in,out] m: material data manager
+   * \param[in] opts: integration options
+   * \param[in] dt: time step
+   * \param[in] b: first integration point of the window
+   * \param[in] e: integration point past the last one of the window
+   */
+  static BehaviourIntegrationResult integrateWindow(
+      mgis::ThreadPool& p,
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt,
+      const size_type b,
+      const size_type e) {
+    const auto nth = std::min(p.getNumberOfThreads(), e - b);
+    const auto bounds = getUniformPartition(e - b, nth);
+    using Task = std::future<ThreadedTaskResult<BehaviourIntegrationResult>>;
+    auto tasks = std::vector<Task>{};
+    tasks.reserve(nth);
+    for (size_type i = 0; i != nth; ++i) {
+      tasks.push_back(p.addTask([&m, &opts, dt, b1 = b + bounds[i],
+                                 e1 = b + bounds[i + 1]] {
+        return integrate(m, opts, dt, b1, e1);
+      }));
+    }
+    auto r = BehaviourIntegrationResult{};
+    for (auto& t : tasks) {
+      auto rt = t.get();
+      const auto& ri = *rt;
+      if (ri.exit_status < r.exit_status) {
+        r.exit_status = ri.exit_status;
+        r.n = ri.n;
+        r.error_message = ri.error_message;
+      }
+      r.time_step_increase_factor =
+          std::min(r.time_step_increase_factor, ri.time_step_increase_factor);
+    }
+    return r;
+  }  // end of integrateWindow
+
+  MultiThreadedBehaviourIntegrationResult integrateByWindows(
+      MaterialDataManager& m,
+      const BehaviourIntegrationOptions& opts,
+      const real dt,
+      const StreamingIntegrationOptions& sopts) {
+    // allocation of the auxiliary arrays before any parallel treatment
+    if (opts.integration_type !=
+        IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR) {
+      m.allocateArrayOfTangentOperatorBlocks();
+    }
+    if (opts.compute_speed_of_sound) {
+      m.allocateArrayOfSpeedOfSounds();
+    }
+    if (opts.measure_integration_costs) {
+      m.allocateArrayOfIntegrationCosts();
+    }
+    auto arrays = std::vector<StreamedArray>{};
+    addArrays(arrays, m.s0);
+    addArrays(arrays, m.s1);
+    addArray(arrays, m.K, m.n);
+    addArray(arrays, m.K_single_precision, m.n);
+    addArray(arrays, m.speed_of_sound, m.n);
+    addArray(arrays, m.integration_costs, m.n);
+    auto ws = sopts.window_size;
+    if (ws == 0) {
+      auto s = size_type{};
+      for (const auto& a : arrays) {
+        s += a.stride;
+      }
+      constexpr auto window_memory = size_type{64} << 20;
+      ws = std::max(window_memory / std::max(s, size_type{1}), size_type{1});
+    }
+    if (sopts.thread_pool != nullptr) {
+      m.setThreadSafe(true);
+    }
+    auto r = MultiThreadedBehaviourIntegrationResult{};
+    for (size_type b = 0; b < m.n; b += ws) {
+      const auto e = std::min(b + ws, m.n);
+      if ((sopts.prefetch) && (e < m.n)) {
+        prefetch(arrays, e, std::min(e + ws, m.n));
+      }
+      auto rw = (sopts.thread_pool != nullptr)
+                    ? integrateWindow(*(sopts.thread_pool), m, opts, dt, b, e)
+                    : integrate(m, opts, dt, b, e);
+      r.exit_status = std::min(r.exit_status, rw.exit_status);
+      r.results.push_back(std::move(rw));
+      if (r.exit_status == -1) {
+        break;
+      }
+      if (sopts.writeback) {
+        writeback(arrays, b, e);
+      }
+    }
+    return r;
+  }  // end of integrateByWindows
+
+}  // end of namespace mgis::behaviour
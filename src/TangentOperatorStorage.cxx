@@ -0,0 +1,210 @@
+/*!
+ * \file   TangentOperatorStorage.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include "MGIS/Raise.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/TangentOperatorStorage.hxx"
+
+namespace mgis::behaviour {
+
+  /*!
+   * \return the number of values used to store a block
+   * \param[in] nr: number of rows of the block
+   * \param[in] nc: number of columns of the block
+   * \param[in] s: storage
+   */
+  static size_type getBlockStorageSize(const size_type nr,
+                                       const size_type nc,
+                                       const TangentOperatorStorage& s) {
+    if ((s.packed_symmetric) && (nr == nc)) {
+      return (nr * (nr + 1)) / 2;
+    }
+    return nr * nc;
+  }  // end of getBlockStorageSize
+
+  /*!
+   * \brief convert dense tangent operator blocks to the given storage
+   * \param[out] d: stored values
+   * \param[in] K: dense tangent operator blocks
+   * \param[in] b: behaviour
+   * \param[in] s: storage
+   */
+  template <typename ValueType>
+  static void pack(ValueType* d,
+                   const real* K,
+                   const Behaviour& b,
+                   const TangentOperatorStorage& s) {
+    for (const auto& block : b.to_blocks) {
+      const auto nr = getVariableSize(block.first, b.hypothesis);
+      const auto nc = getVariableSize(block.second, b.hypothesis);
+      if ((s.packed_symmetric) && (nr == nc)) {
+        for (size_type r = 0; r != nr; ++r) {
+          for (size_type c = r; c != nc; ++c, ++d) {
+            *d = static_cast<ValueType>(K[r * nc + c]);
+          }
+        }
+      } else {
+        d = std::transform(K, K + nr * nc, d, [](const real v) {
+          return static_cast<ValueType>(v);
+        });
+      }
+      K += nr * nc;
+    }
+  }  // end of pack
+
+  /*!
+   * \brief convert tangent operator blocks stored using the given storage to
+   * dense blocks
+   * \param[out] K: dense tangent operator blocks
+   * \param[in] d: stored values
+   * \param[in] b: behaviour
+   * \param[in] s: storage
+   */
+  template <typename ValueType>
+  static void unpack(real* K,
+                     const ValueType* d,
+                     const Behaviour& b,
+                     const TangentOperatorStorage& s) {
+    for (const auto& block : b.to_blocks) {
+      const auto nr = getVariableSize(block.first, b.hypothesis);
+      const auto nc = getVariableSize(block.second, b.hypothesis);
+      if ((s.packed_symmetric) && (nr == nc)) {
+        for (size_type r = 0; r != nr; ++r) {
+          for (size_type c = r; c != nc; ++c, ++d) {
+            K[r * nc + c] = K[c * nc + r] = static_cast<real>(*d);
+          }
+        }
+      } else {
+        std::transform(d, d + nr * nc, K, [](const ValueType v) {
+          return static_cast<real>(v);
+        });
+        d += nr * nc;
+      }
+      K += nr * nc;
+    }
+  }  // end of unpack
+
+  /*!
+   * \brief check that the tangent operator blocks of the given integration
+   * point are allocated
+   * \param[in] n: name of the calling function
+   * \param[in] m: material data manager
+   * \param[in] i: integration point
+   */
+  static void checkTangentOperatorBlocks(const char* const n,
+                                         const MaterialDataManager& m,
+                                         const size_type i) {
+    const auto size = static_cast<size_type>(
+        m.K_storage.single_precision ? m.K_single_precision.size()
+                                     : m.K.size());
+    if ((i >= m.n) || ((i + 1) * m.K_stride > size)) {
+      mgis::raise(std::string(n) +
+                  ": tangent operator blocks not allocated or invalid "
+                  "integration point");
+    }
+  }  // end of checkTangentOperatorBlocks
+
+  bool requiresConversion(const TangentOperatorStorage& s) {
+    return (s.packed_symmetric) || (s.single_precision);
+  }  // end of requiresConversion
+
+  size_type getTangentOperatorArraySize(const Behaviour& b,
+                                        const TangentOperatorStorage& s) {
+    auto size = size_type{};
+    for (const auto& block : b.to_blocks) {
+      size += getBlockStorageSize(getVariableSize(block.first, b.hypothesis),
+                                  getVariableSize(block.second, b.hypothesis),
+                                  s);
+    }
+    return size;
+  }  // end of getTangentOperatorArraySize
+
+  void setTangentOperatorBlocks(MaterialDataManager& m,
+                                const size_type i,
+                                mgis::span<const real> K) {
+    checkTangentOperatorBlocks("setTangentOperatorBlocks", m, i);
+    if (static_cast<size_type>(K.size()) < getTangentOperatorArraySize(m.b)) {
+      mgis::raise("setTangentOperatorBlocks: invalid array size");
+    }
+    if (m.K_storage.single_precision) {
+      pack(m.K_single_precision.data() + i * m.K_stride, K.data(), m.b,
+           m.K_storage);
+    } else if (m.K_storage.packed_symmetric) {
+      pack(m.K.data() + i * m.K_stride, K.data(), m.b, m.K_storage);
+    } else {
+      std::copy(K.begin(), K.begin() + m.K_stride,
+                m.K.begin() + i * m.K_stride);
+    }
+  }  // end of setTangentOperatorBlocks
+
+  void getTangentOperatorBlocks(mgis::span<real> K,
+                                const MaterialDataManager& m,
+                                const size_type i) {
+    checkTangentOperatorBlocks("getTangentOperatorBlocks", m, i);
+    if (static_cast<size_type>(K.size()) < getTangentOperatorArraySize(m.b)) {
+      mgis::raise("getTangentOperatorBlocks: invalid array size");
+    }
+    if (m.K_storage.single_precision) {
+      unpack(K.data(), m.K_single_precision.data() + i * m.K_stride, m.b,
+             m.K_storage);
+    } else if (m.K_storage.packed_symmetric) {
+      unpack(K.data(), m.K.data() + i * m.K_stride, m.b, m.K_storage);
+    } else {
+      std::copy(m.K.begin() + i * m.K_stride,
+                m.K.begin() + (i + 1) * m.K_stride, K.begin());
+    }
+  }  // end of getTangentOperatorBlocks
+
+  void getTangentOperatorBlocks(mgis::span<real> K,
+                                const MaterialDataManager& m) {
+    const auto s = getTangentOperatorArraySize(m.b);
+    if (static_cast<size_type>(K.size()) != m.n * s) {
+      mgis::raise("getTangentOperatorBlocks: invalid array size");
+    }
+    for (size_type i = 0; i != m.n; ++i) {
+      getTangentOperatorBlocks(K.subspan(i * s, s), m, i);
+    }
+  }  // end of getTangentOperatorBlocks
+
+  void rotateTangentOperatorBlocks(MaterialDataManager& m,
+                                   const mgis::span<const real>& r) {
+    if (!requiresConversion(m.K_storage)) {
+      rotateTangentOperatorBlocks(m.K, m.b, r);
+      return;
+    }
+    if (m.b.rotate_tangent_operator_blocks_ptr == nullptr) {
+      mgis::raise(
+          "rotateTangentOperatorBlocks: no function performing the rotation "
+          "of the tangent operator blocks defined");
+    }
+    const auto rsize = static_cast<size_type>(r.size());
+    if ((rsize != 9) && (rsize != 9 * m.n)) {
+      mgis::raise(
+          "rotateTangentOperatorBlocks: "
+          "invalid size for the rotation matrix array");
+    }
+    auto K = std::vector<real>(getTangentOperatorArraySize(m.b));
+    for (size_type i = 0; i != m.n; ++i) {
+      const auto* const ri = r.data() + ((rsize == 9) ? 0 : 9 * i);
+      getTangentOperatorBlocks(K, m, i);
+      m.b.rotate_tangent_operator_blocks_ptr(K.data(), K.data(), ri);
+      setTangentOperatorBlocks(m, i, K);
+    }
+  }  // end of rotateTangentOperatorBlocks
+
+}  // end of namespace mgis::behaviour
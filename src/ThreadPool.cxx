@@ -12,33 +12,183 @@
  *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
  */
 
+#include <chrono>
 #include <memory>
+#include <string>
+#include <fstream>
+#include <sstream>
 #include <stdexcept>
+#ifdef __linux__
+#include <sched.h>
+#include <pthread.h>
+#endif /* __linux__ */
+#include "MGIS/Profiling.hxx"
+#include "MGIS/EventRecorder.hxx"
 #include "MGIS/ThreadPool.hxx"
 
 namespace mgis {
 
-  ThreadPool::ThreadPool(const size_t n) {
+  //! \brief pool owning the current thread, if any
+  static thread_local const ThreadPool* current_thread_pool = nullptr;
+
+#ifdef __linux__
+
+  /*!
+   * \return the list of integers described by the given string, using the
+   * format of the lists of cpus and nodes of the Linux kernel, i.e.
+   * `0-3,8-11`.
+   * \param[in] l: list
+   */
+  static std::vector<int> parseLinuxList(const std::string& l) {
+    auto r = std::vector<int>{};
+    auto is = std::istringstream{l};
+    auto t = std::string{};
+    while (std::getline(is, t, ',')) {
+      if (t.empty() || (t == "\n")) {
+        continue;
+      }
+      try {
+        const auto p = t.find('-');
+        const auto b = std::stoi(t.substr(0, p));
+        const auto e =
+            (p == std::string::npos) ? b : std::stoi(t.substr(p + 1));
+        for (auto i = b; i <= e; ++i) {
+          r.push_back(i);
+        }
+      } catch (...) {
+        return {};
+      }
+    }
+    return r;
+  }  // end of parseLinuxList
+
+  /*!
+   * \return the content of the first line of the given file, or an empty
+   * string if the file can't be read.
+   * \param[in] f: file name
+   */
+  static std::string readFirstLine(const std::string& f) {
+    auto in = std::ifstream{f};
+    auto l = std::string{};
+    if (in) {
+      std::getline(in, l);
+    }
+    return l;
+  }  // end of readFirstLine
+
+  /*!
+   * \return the processing units available to the process, grouped by NUMA
+   * node. If the NUMA topology can't be determined, all the processing units
+   * are assumed to belong to the same node.
+   */
+  static std::vector<std::vector<int>> getProcessingUnitsByNUMANodes() {
+    auto available = std::vector<int>{};
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &cpus) != 0) {
+      return {};
+    }
+    for (int c = 0; c != CPU_SETSIZE; ++c) {
+      if (CPU_ISSET(c, &cpus)) {
+        available.push_back(c);
+      }
+    }
+    auto r = std::vector<std::vector<int>>{};
+    const auto root = std::string{"/sys/devices/system/node/"};
+    for (const auto n : parseLinuxList(readFirstLine(root + "online"))) {
+      auto node = std::vector<int>{};
+      const auto f = root + "node" + std::to_string(n) + "/cpulist";
+      for (const auto c : parseLinuxList(readFirstLine(f))) {
+        if ((c >= 0) && (c < CPU_SETSIZE) && (CPU_ISSET(c, &cpus))) {
+          node.push_back(c);
+        }
+      }
+      if (!node.empty()) {
+        r.push_back(std::move(node));
+      }
+    }
+    if (r.empty()) {
+      r.push_back(std::move(available));
+    }
+    return r;
+  }  // end of getProcessingUnitsByNUMANodes
+
+  /*!
+   * \return the ordered list of processing units to which the threads are
+   * bound
+   * \param[in] a: thread affinity policy
+   */
+  static std::vector<int> getProcessingUnits(const ThreadAffinityPolicy a) {
+    const auto nodes = getProcessingUnitsByNUMANodes();
+    auto r = std::vector<int>{};
+    if (a == ThreadAffinityPolicy::COMPACT) {
+      for (const auto& node : nodes) {
+        r.insert(r.end(), node.begin(), node.end());
+      }
+    } else if (a == ThreadAffinityPolicy::SCATTER) {
+      auto found = true;
+      for (decltype(nodes.size()) i = 0; found; ++i) {
+        found = false;
+        for (const auto& node : nodes) {
+          if (i < node.size()) {
+            r.push_back(node[i]);
+            found = true;
+          }
+        }
+      }
+    }
+    return r;
+  }  // end of getProcessingUnits
+
+  /*!
+   * \brief bind the given thread to the given processing unit
+   * \return true on success
+   * \param[in] t: thread
+   * \param[in] c: processing unit
+   */
+  static bool bindThread(std::thread& t, const int c) {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(c, &cpus);
+    return pthread_setaffinity_np(t.native_handle(), sizeof(cpu_set_t),
+                                  &cpus) == 0;
+  }  // end of bindThread
+
+#endif /* __linux__ */
+
+  ThreadPool::ThreadPool(const size_t n)
+      : ThreadPool(n, ThreadAffinityPolicy::NONE) {}  // end of ThreadPool
+
+  ThreadPool::ThreadPool(const size_t n, const ThreadAffinityPolicy a)
+      : affinity(a) {
     this->statuses.resize(n, ThreadPool::Status::IDLE);
+    this->thread_tasks.resize(n);
+    this->processing_units.resize(n, -1);
     for (size_t i = 0; i < n; ++i) {
       auto f = [this, i] {
+        current_thread_pool = this;
+        auto& own_tasks = this->thread_tasks[i];
         for (;;) {
           std::function<void()> task;
           {
             std::unique_lock<std::mutex> lock(this->m);
-            while (!(this->stop || !this->tasks.empty())) {
-              this->c.wait(
-                  lock, [this] { return this->stop || !this->tasks.empty(); });
-            }
-            if (this->stop && this->tasks.empty()) {
+            this->c.wait(lock, [this, &own_tasks] {
+              return this->stop || !own_tasks.empty() || !this->tasks.empty();
+            });
+            if (this->stop && own_tasks.empty() && this->tasks.empty()) {
               return;
             }
-            task = std::move(this->tasks.front());
-            this->tasks.pop();
+            // tasks dedicated to this thread are processed first
+            auto& q = own_tasks.empty() ? this->tasks : own_tasks;
+            task = std::move(q.front());
+            q.pop();
             this->statuses[i] = ThreadPool::Status::WORKING;
             this->c.notify_all();
           }
-          task();
+          {
+            MGIS_PROFILING_TIMER(timer, THREAD_POOL_TASK, 0);
+            task();
+          }
           {
             std::unique_lock<std::mutex> lock(this->m);
             this->statuses[i] = ThreadPool::Status::IDLE;
@@ -48,16 +198,126 @@ namespace mgis {
       };
       this->workers.emplace_back(f);
     }
-  }
+#ifdef __linux__
+    if (a != ThreadAffinityPolicy::NONE) {
+      const auto units = getProcessingUnits(a);
+      if (!units.empty()) {
+        for (size_t i = 0; i < n; ++i) {
+          const auto u = units[i % units.size()];
+          if (bindThread(this->workers[i], u)) {
+            this->processing_units[i] = u;
+          }
+        }
+      }
+    }
+#endif /* __linux__ */
+  }  // end of ThreadPool
+
+  std::function<void()> ThreadPool::wrap(std::function<void()> t) {
+#ifdef MGIS_HAVE_PROFILING
+    if (profiling::isProfilingEnabled()) {
+      // measure the time spent by the task in the queue
+      t = [t, start = std::chrono::steady_clock::now()] {
+        const auto qt = std::chrono::duration<real>(
+            std::chrono::steady_clock::now() - start);
+        profiling::record(profiling::Region::THREAD_POOL_QUEUE, qt.count());
+        t();
+      };
+    }
+#endif /* MGIS_HAVE_PROFILING */
+    if (auto* const r = this->recorder.load(); r != nullptr) {
+      const auto id = r->getNewTaskIdentifier();
+      r->record(EventRecorder::TASK_ENQUEUE, "task", id);
+      t = [t, r, id] {
+        auto* const previous = getThreadEventRecorder();
+        setThreadEventRecorder(r);
+        r->record(EventRecorder::TASK_BEGIN, "task", id);
+        t();
+        r->record(EventRecorder::TASK_END, "task", id);
+        setThreadEventRecorder(previous);
+      };
+    }
+    return t;
+  }  // end of ThreadPool::wrap
+
+  void ThreadPool::push(std::function<void()> t) {
+    t = this->wrap(std::move(t));
+    {
+      std::unique_lock<std::mutex> lock(this->m);
+      // don't allow enqueueing after stopping the pool
+      if (this->stop) {
+        throw std::runtime_error(
+            "ThreadPool::addTask: "
+            "enqueue on stopped ThreadPool");
+      }
+      this->tasks.emplace(std::move(t));
+    }
+    this->c.notify_one();
+  }  // end of ThreadPool::push
+
+  void ThreadPool::push(const size_type i, std::function<void()> t) {
+    if (i >= this->workers.size()) {
+      throw std::runtime_error(
+          "ThreadPool::addTaskToThread: "
+          "invalid thread index");
+    }
+    t = this->wrap(std::move(t));
+    {
+      std::unique_lock<std::mutex> lock(this->m);
+      // don't allow enqueueing after stopping the pool
+      if (this->stop) {
+        throw std::runtime_error(
+            "ThreadPool::addTaskToThread: "
+            "enqueue on stopped ThreadPool");
+      }
+      this->thread_tasks[i].emplace(std::move(t));
+    }
+    // all threads are notified since only one of them can process the task
+    this->c.notify_all();
+  }  // end of ThreadPool::push
+
+  void ThreadPool::setEventRecorder(EventRecorder* const r) {
+    this->recorder = r;
+  }  // end of ThreadPool::setEventRecorder
 
   size_type ThreadPool::getNumberOfThreads() const {
     return this->workers.size();
   }  // end of ThreadPool::getNumberOfThreads
 
+  ThreadAffinityPolicy ThreadPool::getThreadAffinityPolicy() const {
+    return this->affinity;
+  }  // end of ThreadPool::getThreadAffinityPolicy
+
+  int ThreadPool::getThreadProcessingUnit(const size_type i) const {
+    if (i >= this->processing_units.size()) {
+      throw std::runtime_error(
+          "ThreadPool::getThreadProcessingUnit: "
+          "invalid thread index");
+    }
+    return this->processing_units[i];
+  }  // end of ThreadPool::getThreadProcessingUnit
+
+  bool ThreadPool::isWorkerThread() const {
+    return current_thread_pool == this;
+  }  // end of ThreadPool::isWorkerThread
+
+  bool ThreadPool::areTaskQueuesEmpty() const {
+    if (!this->tasks.empty()) {
+      return false;
+    }
+    for (const auto& q : this->thread_tasks) {
+      if (!q.empty()) {
+        return false;
+      }
+    }
+    return true;
+  }  // end of ThreadPool::areTaskQueuesEmpty
+
   void ThreadPool::wait() {
+    MGIS_PROFILING_TIMER(timer, THREAD_POOL_WAIT, 0);
     std::unique_lock<std::mutex> lock(this->m);
-    while (!this->tasks.empty()) {
-      this->c.wait(lock, [this] { return this->tasks.empty(); });
+    while (!this->areTaskQueuesEmpty()) {
+      this->c.wait(lock, [this] { return this->areTaskQueuesEmpty(); });
     }
     for (decltype(this->statuses.size()) i = 0; i != this->statuses.size();
          ++i) {
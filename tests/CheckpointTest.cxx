@@ -0,0 +1,180 @@
+/*!
+ * \file   CheckpointTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cstdio>
+#include <vector>
+#include <cstdlib>
+#include <fstream>
+#include <algorithm>
+#include <iostream>
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+#include "MGIS/Behaviour/Checkpoint.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << "CheckpointTest: " << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+static bool same_values(mgis::span<const mgis::real> a,
+                        mgis::span<const mgis::real> b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  return std::equal(a.begin(), a.end(), b.begin());
+}  // end of same_values
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  constexpr auto n = size_type{100};
+  constexpr auto f = "CheckpointTest.bin";
+  if (argc != 2) {
+    std::cerr << "CheckpointTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = true;
+  try {
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    ThreadPool p(2);
+    auto opts = CheckpointOptions{};
+    opts.thread_pool = &p;
+    opts.chunk_size = 256;
+    // material data manager to be saved
+    auto m1 = MaterialDataManager{b, n};
+    auto temperatures = std::vector<real>(n);
+    for (size_type idx = 0; idx != n; ++idx) {
+      temperatures[idx] = 293.15 + idx;
+      m1.s1.gradients[idx * m1.s1.gradients_stride] = 5.e-5 * (idx + 1);
+    }
+    setExternalStateVariable(m1.s1, "Temperature", temperatures);
+    setExternalStateVariable(m1.s0, "Temperature", 293.15);
+    integrate(p, m1, IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR,
+              180);
+    saveCheckpoint(f, m1, opts);
+    const auto info = readCheckpointInformation(f);
+    success = check(info.version == checkpoint_format_version,
+                    "invalid version") &&
+              success;
+    success = check(info.behaviour == "Norton", "invalid behaviour") && success;
+    success = check(info.n == n, "invalid number of points") && success;
+    success = check(info.isvs.size() == b.isvs.size(),
+                    "invalid number of internal state variables") &&
+              success;
+    // restoration
+    auto m2 = MaterialDataManager{b, n};
+    restoreCheckpoint(m2, f, opts);
+    success = check(same_values(m1.s0.gradients, m2.s0.gradients) &&
+                        same_values(m1.s1.gradients, m2.s1.gradients),
+                    "invalid gradients") &&
+              success;
+    success = check(same_values(m1.s1.thermodynamic_forces,
+                                m2.s1.thermodynamic_forces),
+                    "invalid thermodynamic forces") &&
+              success;
+    success = check(same_values(m1.s1.internal_state_variables,
+                                m2.s1.internal_state_variables),
+                    "invalid internal state variables") &&
+              success;
+    success = check(same_values(m1.K, m2.K), "invalid tangent operator") &&
+              success;
+    const auto& T = m2.s1.external_state_variables.at("Temperature");
+    success = check(std::holds_alternative<std::vector<real>>(T) &&
+                        (std::get<std::vector<real>>(T) == temperatures),
+                    "invalid temperature") &&
+              success;
+    const auto& T0 = m2.s0.external_state_variables.at("Temperature");
+    success = check(std::holds_alternative<real>(T0) &&
+                        (std::get<real>(T0) == 293.15),
+                    "invalid temperature") &&
+              success;
+    // restoration on a material data manager using another behaviour
+    auto error = false;
+    try {
+      const auto b2 = load(argv[1], "Plasticity", Hypothesis::TRIDIMENSIONAL);
+      auto m3 = MaterialDataManager{b2, n};
+      restoreCheckpoint(m3, f);
+    } catch (std::exception&) {
+      error = true;
+    }
+    success = check(error, "unmatched behaviour not detected") && success;
+    // storage of the tangent operator blocks
+    {
+      constexpr auto f2 = "CheckpointTest2.bin";
+      auto i = MaterialDataManagerInitializer{};
+      i.tangent_operator_storage.packed_symmetric = true;
+      auto m5 = MaterialDataManager{b, n, i};
+      m5.allocateArrayOfTangentOperatorBlocks();
+      saveCheckpoint(f2, m5, opts);
+      error = false;
+      try {
+        auto m6 = MaterialDataManager{b, n};
+        m6.allocateArrayOfTangentOperatorBlocks();
+        restoreCheckpoint(m6, f2, opts);
+      } catch (std::exception&) {
+        error = true;
+      }
+      std::remove(f2);
+      success = check(error, "unmatched storage of the tangent operator "
+                             "blocks not detected") &&
+                success;
+      i.tangent_operator_storage.single_precision = true;
+      auto m7 = MaterialDataManager{b, n, i};
+      m7.allocateArrayOfTangentOperatorBlocks();
+      error = false;
+      try {
+        saveCheckpoint(f2, m7, opts);
+      } catch (std::exception&) {
+        error = true;
+      }
+      std::remove(f2);
+      success = check(error, "tangent operator blocks stored in single "
+                             "precision saved") &&
+                success;
+    }
+    // corruption of the file
+    {
+      auto file = std::fstream(f, std::ios::in | std::ios::out |
+                                      std::ios::binary | std::ios::ate);
+      const auto size = static_cast<std::streamoff>(file.tellg());
+      file.seekp(size - 1);
+      file.put('x');
+    }
+    auto m4 = MaterialDataManager{b, n};
+    std::fill(m4.s1.gradients.begin(), m4.s1.gradients.end(), real{1});
+    const auto g4 = std::vector<real>(m4.s1.gradients.begin(),
+                                      m4.s1.gradients.end());
+    error = false;
+    try {
+      restoreCheckpoint(m4, f, opts);
+    } catch (std::exception&) {
+      error = true;
+    }
+    success = check(error, "corrupted file not detected") && success;
+    success = check(same_values(m4.s1.gradients, g4) && (m4.K.empty()),
+                    "material data manager modified by a failed "
+                    "restoration") &&
+              success;
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    std::remove(f);
+    return EXIT_FAILURE;
+  }
+  std::remove(f);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
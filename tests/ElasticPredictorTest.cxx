@@ -0,0 +1,102 @@
+/*!
+ * \file   ElasticPredictorTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include "MGIS/Raise.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+#include "MGIS/Behaviour/ElasticPredictor.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << "ElasticPredictorTest: " << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  if (argc != 2) {
+    std::cerr << "ElasticPredictorTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = true;
+  try {
+    // elastic properties and yield stress of the `Plasticity` behaviour
+    constexpr auto young = real{20000};
+    constexpr auto nu = real{0.3};
+    constexpr auto s0 = real{200};
+    constexpr auto mu = young / (2 * (1 + nu));
+    const auto b = load(argv[1], "Plasticity", Hypothesis::TRIDIMENSIONAL);
+    MaterialDataManager m1{b, 20};
+    MaterialDataManager m2{b, 20};
+    for (auto* const m : {&m1, &m2}) {
+      m->s1.external_state_variables["Temperature"] = 293.15;
+      update(*m);
+      for (size_type idx = 0; idx != m->n; ++idx) {
+        m->s1.gradients[idx * m->s1.gradients_stride] = 0.95e-3 * (idx + 1);
+      }
+    }
+    // for an uniaxial strain, the von Mises stress of the trial stress is
+    // 2 mu |exx|
+    m2.elastic_predictor.predicate = [](const MaterialDataManager& m,
+                                        const size_type i) {
+      const auto de = m.s1.gradients[i * m.s1.gradients_stride] -
+                      m.s0.gradients[i * m.s0.gradients_stride];
+      return 2 * mu * std::abs(de) < s0;
+    };
+    auto kernel = makeLinearElasticKernel(m2, "ElasticStrain");
+    std::atomic<size_type> nelastic = 0;
+    m2.elastic_predictor.kernel =
+        [&kernel, &nelastic](MaterialDataManager& m,
+                             const BehaviourIntegrationOptions& opts,
+                             const real dt, const size_type i) {
+          ++nelastic;
+          return kernel(m, opts, dt, i);
+        };
+    const auto it = IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
+    if (integrate(m1, it, 0, 0, m1.n) == -1) {
+      mgis::raise("ElasticPredictorTest: integration failed");
+    }
+    ThreadPool p(2);
+    if (integrate(p, m2, it, 0) == -1) {
+      mgis::raise("ElasticPredictorTest: integration failed");
+    }
+    success = check(nelastic == 13, "invalid number of elastic points") &&
+              success;
+    auto compare = [&success](mgis::span<const real> v1,
+                              mgis::span<const real> v2, const char* const n) {
+      for (size_type i = 0; i != static_cast<size_type>(v1.size()); ++i) {
+        success = check(std::abs(v1[i] - v2[i]) < 1.e-8 * (1 + std::abs(v1[i])),
+                        n) &&
+                  success;
+      }
+    };
+    compare(m1.s1.thermodynamic_forces, m2.s1.thermodynamic_forces,
+            "invalid thermodynamic forces");
+    compare(m1.s1.internal_state_variables, m2.s1.internal_state_variables,
+            "invalid internal state variables");
+    compare(m1.K, m2.K, "invalid tangent operator");
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,124 @@
+/*!
+ * \file   EventRecorderTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cstring>
+#include <cstdlib>
+#include <sstream>
+#include <iostream>
+#include "MGIS/Raise.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/EventRecorder.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << "EventRecorderTest: " << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+/*!
+ * \return the number of events of the given type and name
+ * \param[in] r: recorder
+ * \param[in] t: type of the events
+ * \param[in] n: name of the events
+ */
+static mgis::size_type count(const mgis::EventRecorder& r,
+                             const mgis::EventRecorder::EventType t,
+                             const char* const n) {
+  auto c = mgis::size_type{};
+  for (const auto& te : r.getEvents()) {
+    for (const auto& e : te.events) {
+      if ((e.type == t) && (std::strcmp(e.name, n) == 0)) {
+        ++c;
+      }
+    }
+  }
+  return c;
+}  // end of count
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  if (argc != 2) {
+    std::cerr << "EventRecorderTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = true;
+  try {
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    MaterialDataManager m{b, 100};
+    m.s1.external_state_variables["Temperature"] = 293.15;
+    update(m);
+    for (size_type idx = 0; idx != m.n; ++idx) {
+      m.s1.gradients[idx * m.s1.gradients_stride] = 5.e-5 * (idx + 1);
+    }
+    const auto it = IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+    EventRecorder r;
+    ThreadPool p(3);
+    p.setEventRecorder(&r);
+    if (integrate(p, m, it, 180) != 1) {
+      mgis::raise("EventRecorderTest: integration failed");
+    }
+    p.wait();
+    p.setEventRecorder(nullptr);
+    // not recorded
+    integrate(p, m, it, 180);
+    p.wait();
+    success = check(count(r, EventRecorder::TASK_ENQUEUE, "task") == 3,
+                    "invalid number of enqueued tasks") &&
+              success;
+    success = check(count(r, EventRecorder::TASK_BEGIN, "task") == 3,
+                    "invalid number of started tasks") &&
+              success;
+    success = check(count(r, EventRecorder::TASK_END, "task") == 3,
+                    "invalid number of finished tasks") &&
+              success;
+    success = check(count(r, EventRecorder::REGION_BEGIN, "integrate") == 3,
+                    "invalid number of regions") &&
+              success;
+    success = check(count(r, EventRecorder::REGION_END, "integrate") == 3,
+                    "invalid number of regions") &&
+              success;
+    // events are in chronological order in each thread
+    for (const auto& te : r.getEvents()) {
+      for (size_type i = 1; i < te.events.size(); ++i) {
+        success = check(te.events[i - 1].time <= te.events[i].time,
+                        "events are not ordered") &&
+                  success;
+      }
+    }
+    std::ostringstream os;
+    print_chrome_trace(os, r);
+    success = check(os.str().find("\"traceEvents\"") != std::string::npos,
+                    "invalid trace") &&
+              success;
+    // ring buffers
+    EventRecorder r2(4);
+    for (size_type i = 0; i != 10; ++i) {
+      r2.record(EventRecorder::REGION_BEGIN, "region");
+    }
+    const auto events = r2.getEvents();
+    success = check((events.size() == 1) && (events[0].events.size() == 4) &&
+                        (events[0].lost == 6),
+                    "invalid ring buffer") &&
+              success;
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,132 @@
+/*!
+ * \file   ExecutorTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include "MGIS/Raise.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Executor.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+//! \brief a callback treating all the chunks sequentially
+static void sequential_callback(void* const data,
+                                const mgis::size_type n,
+                                mgis::ExecutorChunkFunction f,
+                                void* const ctx) {
+  auto& ncalls = *(static_cast<mgis::size_type*>(data));
+  for (mgis::size_type i = 0; i != n; ++i) {
+    f(ctx, i);
+    ++ncalls;
+  }
+}  // end of sequential_callback
+
+/*!
+ * \brief integrate the Norton behaviour over one time step
+ * \return the values of the internal state variables at the end of the time
+ * step.
+ * \param[in] b: behaviour
+ * \param[in] e: executor. If null, the integration is sequential.
+ */
+static std::vector<mgis::real> integrate(const mgis::behaviour::Behaviour& b,
+                                         mgis::Executor* const e) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  constexpr const auto n = mgis::size_type{100};
+  MaterialDataManager m{b, n};
+  m.s1.external_state_variables["Temperature"] = 293.15;
+  update(m);
+  for (size_type idx = 0; idx != m.n; ++idx) {
+    m.s1.gradients[idx * m.s1.gradients_stride] = 5.e-5 * (idx + 1);
+  }
+  const auto dt = real(180);
+  const auto it = IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+  const auto r = (e == nullptr) ? integrate(m, it, dt, 0, m.n)
+                                : integrate(*e, m, it, dt);
+  if (r != 1) {
+    mgis::raise("ExecutorTest: integration failed");
+  }
+  return {m.s1.internal_state_variables.begin(),
+          m.s1.internal_state_variables.end()};
+}  // end of integrate
+
+static bool check(const std::vector<mgis::real>& ref,
+                  const std::vector<mgis::real>& values,
+                  const char* const executor) {
+  if (ref.size() != values.size()) {
+    std::cerr << "ExecutorTest: invalid number of values (" << executor
+              << ")\n";
+    return false;
+  }
+  for (decltype(ref.size()) i = 0; i != ref.size(); ++i) {
+    if (std::abs(ref[i] - values[i]) > 1.e-14) {
+      std::cerr << "ExecutorTest: invalid value for the internal state "
+                   "variables ("
+                << executor << ", expected '" << ref[i] << "', computed '"
+                << values[i] << "')\n";
+      return false;
+    }
+  }
+  return true;
+}  // end of check
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  if (argc != 2) {
+    std::cerr << "ExecutorTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = true;
+  try {
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    const auto ref = integrate(b, nullptr);
+    // thread pool executor
+    ThreadPool p(3);
+    ThreadPoolExecutor pe(p);
+    success = check(ref, integrate(b, &pe), "ThreadPoolExecutor") && success;
+    // callback executor
+    auto ncalls = size_type{};
+    CallbackExecutor ce(sequential_callback, &ncalls, 7);
+    success = check(ref, integrate(b, &ce), "CallbackExecutor") && success;
+    if (ncalls != 7) {
+      std::cerr << "ExecutorTest: invalid number of chunks treated by the "
+                   "callback executor\n";
+      success = false;
+    }
+    // OpenMP executor
+    if (OpenMPExecutor::isAvailable()) {
+      OpenMPExecutor oe(4);
+      success = check(ref, integrate(b, &oe), "OpenMPExecutor") && success;
+    }
+    // exceptions thrown in a chunk are reported
+    auto results = executeOverRange(ce, 10, [](const size_type bi,
+                                               const size_type) {
+      if (bi != 0) {
+        mgis::raise("invalid chunk");
+      }
+    });
+    if ((results.size() != 7) || (!results[0]) || (results[1])) {
+      std::cerr << "ExecutorTest: exceptions not reported\n";
+      success = false;
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,180 @@
+/*!
+ * \file   IntegrateAsyncTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <mutex>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+#include "MGIS/Behaviour/IntegrateAsync.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << "IntegrateAsyncTest: " << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+//! \brief initialize the state of the given material data manager
+static void initialize(mgis::behaviour::MaterialDataManager& m) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  m.s1.external_state_variables["Temperature"] = 293.15;
+  update(m);
+  for (size_type idx = 0; idx != m.n; ++idx) {
+    m.s1.gradients[idx * m.s1.gradients_stride] = 5.e-5 * (idx + 1);
+  }
+}  // end of initialize
+
+static bool test_integrate(const mgis::behaviour::Behaviour& b) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  constexpr auto n = size_type{100};
+  auto success = true;
+  ThreadPool p(2);
+  auto m1 = MaterialDataManager{b, n};
+  auto m2 = MaterialDataManager{b, n};
+  initialize(m1);
+  initialize(m2);
+  auto opts = BehaviourIntegrationOptions{};
+  const auto r1 = integrate(p, m1, opts, 180);
+  auto f = integrateAsync(p, m2, opts, 180);
+  success = check(f.valid(), "invalid handle") && success;
+  // the caller is free to perform other tasks while the integration runs
+  auto nchecks = size_type{};
+  while (!f.isReady()) {
+    ++nchecks;
+  }
+  const auto r2 = f.get();
+  success = check(!f.valid(), "the handle shall be invalid after get") &&
+            success;
+  success = check(r1.exit_status == r2.exit_status, "invalid exit status") &&
+            success;
+  success = check(r1.results.size() == r2.results.size(),
+                  "invalid number of results") &&
+            success;
+  const auto nt = static_cast<size_type>(m1.s1.thermodynamic_forces.size());
+  for (size_type i = 0; i != nt; ++i) {
+    const auto s1 = m1.s1.thermodynamic_forces[i];
+    const auto s2 = m2.s1.thermodynamic_forces[i];
+    success = check(std::abs(s1 - s2) < 1.e-8 * (1 + std::abs(s1)),
+                    "invalid thermodynamic forces") &&
+              success;
+  }
+  // the destructor waits for the end of the computations
+  {
+    auto f2 = integrateAsync(p, m2, opts, 180);
+  }
+  return success;
+}  // end of test_integrate
+
+static bool test_callback(const mgis::behaviour::Behaviour& b) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  constexpr auto n = size_type{100};
+  constexpr auto nchunks = size_type{7};
+  auto success = true;
+  ThreadPool p(2);
+  auto m = MaterialDataManager{b, n};
+  initialize(m);
+  auto mutex = std::mutex{};
+  auto ranges = std::vector<std::pair<size_type, size_type>>{};
+  auto opts = BehaviourIntegrationOptions{};
+  const auto r = integrate(
+      p, m, opts, 180,
+      [&mutex, &ranges](const size_type bp, const size_type ep,
+                        const BehaviourIntegrationResult& ri) {
+        if (ri.exit_status != 1) {
+          return;
+        }
+        auto lock = std::lock_guard<std::mutex>{mutex};
+        ranges.emplace_back(bp, ep);
+      },
+      nchunks);
+  success = check(r.exit_status == 1, "integration failed") && success;
+  success = check(ranges.size() == nchunks, "invalid number of callbacks") &&
+            success;
+  // the chunks shall cover all the integration points
+  std::sort(ranges.begin(), ranges.end());
+  auto e = size_type{};
+  for (const auto& ri : ranges) {
+    success = check(ri.first == e, "invalid chunk") && success;
+    e = ri.second;
+  }
+  success = check(e == n, "invalid chunks") && success;
+  return success;
+}  // end of test_callback
+
+static bool test_post_processing(const mgis::behaviour::Behaviour& b) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  constexpr auto eps = 10 * std::numeric_limits<real>::epsilon();
+  constexpr auto n = size_type{10};
+  auto success = true;
+  ThreadPool p(2);
+  auto m = MaterialDataManager{b, n};
+  setMaterialProperty(m.s1, "YoungModulus", 150e9);
+  setMaterialProperty(m.s1, "PoissonRatio", 0.3);
+  setExternalStateVariable(m.s1, "Temperature", 293.15);
+  update(m);
+  for (size_type i = 0; i != n; ++i) {
+    m.s1.gradients[6 * i] = 1.3e-2;
+    m.s1.gradients[6 * i + 1] = 1.2e-2;
+    m.s1.gradients[6 * i + 2] = 1.4e-2;
+  }
+  auto outputs = allocatePostProcessingVariables(m, "PrincipalStrain");
+  auto f = executePostProcessingAsync(outputs, p, m, "PrincipalStrain");
+  const auto r = f.get();
+  success = check(r.exit_status == 1, "post-processing failed") && success;
+  for (size_type i = 0; i != n; ++i) {
+    success = check(std::abs(outputs[3 * i] - 1.2e-2) < eps,
+                    "invalid output value") &&
+              success;
+    success = check(std::abs(outputs[3 * i + 1] - 1.3e-2) < eps,
+                    "invalid output value") &&
+              success;
+    success = check(std::abs(outputs[3 * i + 2] - 1.4e-2) < eps,
+                    "invalid output value") &&
+              success;
+  }
+  return success;
+}  // end of test_post_processing
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis::behaviour;
+  constexpr const auto h = Hypothesis::TRIDIMENSIONAL;
+  if (argc != 2) {
+    std::cerr << "IntegrateAsyncTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = true;
+  try {
+    const auto b = load(argv[1], "Norton", h);
+    success = test_integrate(b) && success;
+    success = test_callback(b) && success;
+    success =
+        test_post_processing(load(argv[1], "PostProcessingTest", h)) &&
+        success;
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,106 @@
+/*!
+ * \file   IntegrationCostsTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include "MGIS/Raise.hxx"
+#include "MGIS/Partition.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << "IntegrationCostsTest: " << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+static bool test_partitions() {
+  using namespace mgis;
+  auto success = true;
+  const auto u = getUniformPartition(10, 3);
+  success = check(u == std::vector<size_type>{0, 4, 7, 10},
+                  "invalid uniform partition") &&
+            success;
+  const auto costs = std::vector<real>{100, 1, 1, 1, 1, 1, 1, 1, 1, 100};
+  const auto b = getBalancedPartition(costs, 3);
+  success = check(b == std::vector<size_type>{0, 1, 9, 10},
+                  "invalid balanced partition") &&
+            success;
+  const auto z = getBalancedPartition(std::vector<real>(10, real{0}), 3);
+  success = check(z == u, "invalid balanced partition for null costs") &&
+            success;
+  return success;
+}  // end of test_partitions
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  if (argc != 2) {
+    std::cerr << "IntegrationCostsTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = test_partitions();
+  try {
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    MaterialDataManager m1{b, 100};
+    MaterialDataManager m2{b, 100};
+    for (auto* const m : {&m1, &m2}) {
+      m->s1.external_state_variables["Temperature"] = 293.15;
+      update(*m);
+      for (size_type idx = 0; idx != m->n; ++idx) {
+        m->s1.gradients[idx * m->s1.gradients_stride] = 5.e-5 * (idx + 1);
+      }
+    }
+    auto opts = BehaviourIntegrationOptions{};
+    opts.integration_type = IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+    opts.measure_integration_costs = true;
+    // serial reference, without measure
+    if (integrate(m1, opts.integration_type, 180, 0, m1.n) != 1) {
+      mgis::raise("IntegrationCostsTest: integration failed");
+    }
+    ThreadPool p(3);
+    const auto r = integrate(p, m2, opts, 180);
+    if (r.exit_status != 1) {
+      mgis::raise("IntegrationCostsTest: integration failed");
+    }
+    const auto nc = static_cast<size_type>(m2.integration_costs.size());
+    success =
+        check(nc == m2.n, "the integration costs have not been allocated") &&
+        success;
+    for (const auto c : m2.integration_costs) {
+      success = check(c > 0, "invalid integration cost") && success;
+    }
+    // the second integration uses the measured costs to balance the ranges
+    if (integrate(p, m2, opts, 180).exit_status != 1) {
+      mgis::raise("IntegrationCostsTest: integration failed");
+    }
+    const auto ns = static_cast<size_type>(m1.s1.thermodynamic_forces.size());
+    for (size_type i = 0; i != ns; ++i) {
+      const auto s1 = m1.s1.thermodynamic_forces[i];
+      const auto s2 = m2.s1.thermodynamic_forces[i];
+      success = check(std::abs(s1 - s2) < 1.e-8 * (1 + std::abs(s1)),
+                      "results differ from the serial integration") &&
+                success;
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,148 @@
+/*!
+ * \file   IntegrationReductionsTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << "IntegrationReductionsTest: " << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+static bool check_value(const mgis::real v1,
+                        const mgis::real v2,
+                        const char* const msg) {
+  return check(std::abs(v1 - v2) < 1.e-10 * (1 + std::abs(v2)), msg);
+}  // end of check_value
+
+//! \brief initialize the state of the given material data manager
+static void initialize(mgis::behaviour::MaterialDataManager& m) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  setMaterialProperty(m.s1, "YoungModulus", 150e9);
+  setMaterialProperty(m.s1, "PoissonRatio", 0.3);
+  setExternalStateVariable(m.s1, "Temperature", 293.15);
+  update(m);
+  for (size_type idx = 0; idx != m.n; ++idx) {
+    m.s1.gradients[idx * m.s1.gradients_stride] = 1.e-4 * (idx + 1);
+  }
+}  // end of initialize
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  constexpr auto n = size_type{50};
+  if (argc != 2) {
+    std::cerr << "IntegrationReductionsTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = true;
+  try {
+    const auto b = load(argv[1], "EnergiesTest", Hypothesis::TRIDIMENSIONAL);
+    auto weights = std::vector<real>(n);
+    for (size_type idx = 0; idx != n; ++idx) {
+      weights[idx] = 1 + real(idx % 3);
+    }
+    const auto reductions = std::vector<ReductionRequest>{
+        {ReductionOperation::SUM, ReducedQuantity::STORED_ENERGY, weights},
+        {ReductionOperation::MIN, ReducedQuantity::STORED_ENERGY},
+        {ReductionOperation::MAX, ReducedQuantity::STORED_ENERGY},
+        {ReductionOperation::SUM, ReducedQuantity::DISSIPATED_ENERGY}};
+    auto opts = BehaviourIntegrationOptions{};
+    // serial integration
+    auto m1 = MaterialDataManager{b, n};
+    initialize(m1);
+    const auto r1 = integrate(m1, opts, 0, reductions, 0, n);
+    success = check(r1.exit_status == 1, "integration failed") && success;
+    success = check(r1.reductions.size() == reductions.size(),
+                    "invalid number of reductions") &&
+              success;
+    // reference values, computed in a separate pass
+    auto wsum = real{};
+    for (size_type idx = 0; idx != n; ++idx) {
+      wsum += weights[idx] * m1.s1.stored_energies[idx];
+    }
+    const auto& psi = m1.s1.stored_energies;
+    const auto [psi_min, psi_max] = std::minmax_element(psi.begin(), psi.end());
+    success = check(*psi_min > 0, "invalid stored energy") && success;
+    success = check_value(r1.reductions[0], wsum, "invalid sum") && success;
+    success = check_value(r1.reductions[1], *psi_min, "invalid min") && success;
+    success = check_value(r1.reductions[2], *psi_max, "invalid max") && success;
+    success = check_value(r1.reductions[3], 0, "invalid sum") && success;
+    // parallel integration
+    ThreadPool p(3);
+    auto m2 = MaterialDataManager{b, n};
+    initialize(m2);
+    const auto r2 = integrate(p, m2, opts, 0, reductions);
+    success = check(r2.exit_status == 1, "integration failed") && success;
+    success = check(r2.reductions.size() == reductions.size(),
+                    "invalid number of reductions") &&
+              success;
+    for (size_type k = 0; k != reductions.size(); ++k) {
+      success = check_value(r2.reductions[k], r1.reductions[k],
+                            "invalid reduction") &&
+                success;
+    }
+    // the speed of sound must be computed
+    auto lengths = std::vector<real>(n, real{1e-3});
+    auto error = false;
+    try {
+      const auto rs = std::vector<ReductionRequest>{
+          {ReductionOperation::MIN, ReducedQuantity::STABLE_TIME_STEP, {},
+           lengths}};
+      integrate(m1, opts, 0, rs, 0, n);
+    } catch (std::exception&) {
+      error = true;
+    }
+    success = check(error, "missing computation of the speed of sound") &&
+              success;
+    // the stable time step requires the characteristic lengths
+    error = false;
+    try {
+      const auto rs = std::vector<ReductionRequest>{
+          {ReductionOperation::MIN, ReducedQuantity::STABLE_TIME_STEP,
+           weights}};
+      auto opts2 = BehaviourIntegrationOptions{};
+      opts2.compute_speed_of_sound = true;
+      integrate(m1, opts2, 0, rs, 0, n);
+    } catch (std::exception&) {
+      error = true;
+    }
+    success = check(error, "missing characteristic lengths") && success;
+    // characteristic lengths are rejected for the other quantities
+    error = false;
+    try {
+      const auto rs = std::vector<ReductionRequest>{
+          {ReductionOperation::SUM, ReducedQuantity::STORED_ENERGY, weights,
+           lengths}};
+      integrate(m1, opts, 0, rs, 0, n);
+    } catch (std::exception&) {
+      error = true;
+    }
+    success = check(error, "unexpected characteristic lengths") && success;
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,96 @@
+/*!
+ * \file   MaskedIntegrationTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <memory>
+#include <cstdlib>
+#include <iostream>
+#include "MGIS/Raise.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << "MaskedIntegrationTest: " << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  if (argc != 2) {
+    std::cerr << "MaskedIntegrationTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = true;
+  try {
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    MaterialDataManager m1{b, 100};
+    MaterialDataManager m2{b, 100};
+    MaterialDataManager m3{b, 100};
+    for (auto* const m : {&m1, &m2, &m3}) {
+      m->s1.external_state_variables["Temperature"] = 293.15;
+      update(*m);
+      for (size_type idx = 0; idx != m->n; ++idx) {
+        m->s1.gradients[idx * m->s1.gradients_stride] = 5.e-5 * (idx + 1);
+      }
+    }
+    // select one integration point out of three
+    const auto mask = std::make_unique<bool[]>(m1.n);
+    for (size_type idx = 0; idx != m1.n; ++idx) {
+      mask[idx] = (idx % 3) == 0;
+    }
+    const auto indices =
+        getActiveIntegrationPoints(mgis::span<const bool>(mask.get(), m1.n));
+    success = check(indices.size() == 34, "invalid number of active points") &&
+              success;
+    auto opts = BehaviourIntegrationOptions{};
+    opts.integration_type = IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+    if (integrate(m1, opts, 180, 0, m1.n).exit_status != 1) {
+      mgis::raise("MaskedIntegrationTest: integration failed");
+    }
+    if (integrate(m2, opts, 180, indices).exit_status != 1) {
+      mgis::raise("MaskedIntegrationTest: integration failed");
+    }
+    ThreadPool p(2);
+    if (integrate(p, m3, opts, 180, indices).exit_status != 1) {
+      mgis::raise("MaskedIntegrationTest: integration failed");
+    }
+    const auto ts = m1.s1.thermodynamic_forces_stride;
+    for (const auto* const m : {&m2, &m3}) {
+      for (size_type idx = 0; idx != m1.n; ++idx) {
+        // non selected points are left unchanged
+        const auto sref = mask[idx] ? m1.s1.thermodynamic_forces[idx * ts]
+                                    : real{0};
+        const auto s = m->s1.thermodynamic_forces[idx * ts];
+        success = check(std::abs(s - sref) < 1.e-8 * (1 + std::abs(sref)),
+                        "invalid thermodynamic forces") &&
+                  success;
+      }
+    }
+    try {
+      const size_type invalid[] = {0, 100};
+      integrate(m2, opts, 180, invalid);
+      success = check(false, "an invalid index shall be rejected") && success;
+    } catch (std::exception&) {
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
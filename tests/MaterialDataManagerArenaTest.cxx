@@ -0,0 +1,123 @@
+/*!
+ * \file   MaterialDataManagerArenaTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include "MGIS/Raise.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/MaterialDataManagerArena.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << "MaterialDataManagerArenaTest: " << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+//! \return if the given array is stored in the given memory
+static bool contains(mgis::span<mgis::real> memory,
+                     mgis::span<mgis::real> a) {
+  return (a.data() >= memory.data()) &&
+         (a.data() + a.size() <= memory.data() + memory.size());
+}  // end of contains
+
+//! \return if the given array is aligned on a cache line
+static bool isAligned(mgis::span<mgis::real> a) {
+  return reinterpret_cast<std::uintptr_t>(a.data()) % 64 == 0;
+}  // end of isAligned
+
+//! \brief initialize the gradients of the given material data manager
+static void initialize(mgis::behaviour::MaterialDataManager& m) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  m.s1.external_state_variables["Temperature"] = 293.15;
+  update(m);
+  for (size_type idx = 0; idx != m.n; ++idx) {
+    m.s1.gradients[idx * m.s1.gradients_stride] = 5.e-5 * (idx + 1);
+  }
+}  // end of initialize
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  if (argc != 2) {
+    std::cerr << "MaterialDataManagerArenaTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = true;
+  try {
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    const auto sizes = std::vector<size_type>{10, 23, 7};
+    auto arena = MaterialDataManagerArena{};
+    for (const auto n : sizes) {
+      arena.addMaterial(b, n);
+    }
+    arena.build();
+    success = check(arena.getNumberOfMaterials() == sizes.size(),
+                    "invalid number of materials") &&
+              success;
+    const auto memory = arena.getMemory();
+    const auto it = IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
+    for (size_type i = 0; i != sizes.size(); ++i) {
+      auto& m = arena.getMaterialDataManager(i);
+      initialize(m);
+      for (const auto a :
+           {m.s0.gradients, m.s0.thermodynamic_forces,
+            m.s0.internal_state_variables, m.s1.gradients,
+            m.s1.thermodynamic_forces, m.s1.internal_state_variables, m.K}) {
+        success = check(contains(memory, a),
+                        "an array is not stored in the arena") &&
+                  success;
+        success = check(isAligned(a), "an array is not aligned") && success;
+      }
+      // comparison with a standalone material data manager
+      auto m2 = MaterialDataManager{b, sizes[i]};
+      initialize(m2);
+      if ((integrate(m, it, 180, 0, m.n) != 1) ||
+          (integrate(m2, it, 180, 0, m2.n) != 1)) {
+        mgis::raise("MaterialDataManagerArenaTest: integration failed");
+      }
+      const auto nt = static_cast<size_type>(m.s1.thermodynamic_forces.size());
+      for (size_type idx = 0; idx != nt; ++idx) {
+        const auto s1 = m.s1.thermodynamic_forces[idx];
+        const auto s2 = m2.s1.thermodynamic_forces[idx];
+        success = check(std::abs(s1 - s2) < 1.e-8 * (1 + std::abs(s1)),
+                        "results differ from a standalone manager") &&
+                  success;
+      }
+    }
+    // reset
+    arena.reset();
+    for (const auto v : arena.getMemory()) {
+      success = check(v == 0, "invalid value after reset") && success;
+    }
+    // rebuilding a smaller set reuses the memory
+    const auto* const p = arena.getMemory().data();
+    arena.clear();
+    arena.addMaterial(b, 20);
+    arena.build();
+    success = check(arena.getMemory().data() == p,
+                    "the memory has not been reused") &&
+              success;
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,119 @@
+/*!
+ * \file   MaterialStateManagerTest.cxx
+ * \brief  This test checks the functions extracting and setting the values
+ * of the gradients, thermodynamic forces and internal state variables
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialStateManager.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+static bool check_values(const std::vector<mgis::real>& values,
+                         const std::vector<mgis::real>& expected,
+                         const char* const msg) {
+  if (values.size() != expected.size()) {
+    return check(false, msg);
+  }
+  for (std::vector<mgis::real>::size_type i = 0; i != values.size(); ++i) {
+    if (std::abs(values[i] - expected[i]) > 1e-14) {
+      return check(false, msg);
+    }
+  }
+  return true;
+}  // end of check_values
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  if (argc != 2) {
+    std::cerr << "MaterialStateManagerTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = true;
+  try {
+    constexpr auto n = size_type{4};
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    auto s = MaterialStateManager{b, n};
+    auto p = ThreadPool{2};
+    // gradients
+    auto eto = std::vector<real>(6 * n);
+    for (size_type i = 0; i != eto.size(); ++i) {
+      eto[i] = static_cast<real>(i);
+    }
+    setGradient(s, "Strain", eto);
+    success = check_values(std::vector<real>(s.gradients.begin(),
+                                             s.gradients.end()),
+                           eto, "invalid gradients") &&
+              success;
+    auto eto2 = std::vector<real>(6 * n);
+    extractGradient(p, eto2, s, "Strain");
+    success = check_values(eto2, eto, "invalid extracted gradients") && success;
+    // scalar internal state variable with an user defined ordering
+    const auto ordering = std::vector<size_type>{3, 1, 2, 0};
+    const auto p_values = std::vector<real>{3, 1, 2, 0};
+    setInternalStateVariable(p, s, "EquivalentViscoplasticStrain", p_values,
+                             ordering);
+    auto p_values2 = std::vector<real>(n);
+    extractInternalStateVariable(p_values2, s, "EquivalentViscoplasticStrain");
+    success = check_values(p_values2, {0, 1, 2, 3},
+                           "invalid equivalent viscoplastic strain") &&
+              success;
+    extractInternalStateVariable(p, p_values2, s,
+                                 "EquivalentViscoplasticStrain", ordering);
+    success = check_values(p_values2, p_values,
+                           "invalid equivalent viscoplastic strain "
+                           "(user defined ordering)") &&
+              success;
+    // thermodynamic forces on a subset of the integration points
+    const auto subset = std::vector<size_type>{2};
+    auto sig = std::vector<real>(6, 1);
+    setThermodynamicForce(s, "Stress", sig, subset);
+    auto sig2 = std::vector<real>(6 * n);
+    extractThermodynamicForce(sig2, s, "Stress");
+    for (size_type i = 0; i != n; ++i) {
+      const auto v = (i == 2) ? real(1) : real(0);
+      for (size_type j = 0; j != 6; ++j) {
+        success = check(sig2[i * 6 + j] == v, "invalid stress") && success;
+      }
+    }
+    // invalid calls
+    auto has_thrown = false;
+    try {
+      extractGradient(eto2, s, "Strain", std::vector<size_type>{n});
+    } catch (std::exception&) {
+      has_thrown = true;
+    }
+    success = check(has_thrown, "invalid index not detected") && success;
+    has_thrown = false;
+    try {
+      setGradient(s, "Strain", sig);
+    } catch (std::exception&) {
+      has_thrown = true;
+    }
+    success = check(has_thrown, "invalid buffer size not detected") && success;
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
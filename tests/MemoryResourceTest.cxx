@@ -0,0 +1,117 @@
+/*!
+ * \file   MemoryResourceTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <vector>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include "MGIS/Raise.hxx"
+#include "MGIS/Allocator.hxx"
+#include "MGIS/MemoryResource.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << "MemoryResourceTest: " << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+//! \return if the given pointer is aligned on the given boundary
+static bool isAligned(const void* const p, const std::uintptr_t a) {
+  return reinterpret_cast<std::uintptr_t>(p) % a == 0;
+}  // end of isAligned
+
+static bool test_allocators() {
+  using namespace mgis;
+  auto success = true;
+  for (const auto p :
+       {AllocationPolicy::DEFAULT, AllocationPolicy::ALIGNED,
+        AllocationPolicy::TRANSPARENT_HUGE_PAGES, AllocationPolicy::HUGETLB}) {
+    auto& r = getMemoryResource(p);
+    // small and large (8MB) arrays
+    for (const auto n : {std::size_t{10}, std::size_t{1} << 20}) {
+      auto v = std::vector<real, Allocator<real>>(n, real{1},
+                                                  Allocator<real>(r));
+      success = check(&(v.get_allocator().getMemoryResource()) == &r,
+                      "invalid memory resource") &&
+                success;
+      if (p != AllocationPolicy::DEFAULT) {
+        success = check(isAligned(v.data(), 64), "invalid alignment") &&
+                  success;
+      }
+      auto sum = real{};
+      for (const auto value : v) {
+        sum += value;
+      }
+      success = check(sum == static_cast<real>(n), "invalid values") &&
+                success;
+      // the memory resource is propagated on copy
+      const auto v2 = v;
+      success = check(v2.get_allocator() == v.get_allocator(),
+                      "the memory resource has not been propagated") &&
+                success;
+    }
+  }
+  return success;
+}  // end of test_allocators
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  if (argc != 2) {
+    std::cerr << "MemoryResourceTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = test_allocators();
+  try {
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    auto i = MaterialDataManagerInitializer{};
+    i.memory_resource = &getMemoryResource(AllocationPolicy::ALIGNED);
+    MaterialDataManager m1{b, 100};
+    MaterialDataManager m2{b, 100, i};
+    for (auto* const m : {&m1, &m2}) {
+      m->s1.external_state_variables["Temperature"] = 293.15;
+      update(*m);
+      for (size_type idx = 0; idx != m->n; ++idx) {
+        m->s1.gradients[idx * m->s1.gradients_stride] = 5.e-5 * (idx + 1);
+      }
+    }
+    const auto it = IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
+    if ((integrate(m1, it, 180, 0, m1.n) != 1) ||
+        (integrate(m2, it, 180, 0, m2.n) != 1)) {
+      mgis::raise("MemoryResourceTest: integration failed");
+    }
+    for (const auto* const p :
+         {m2.s0.gradients.data(), m2.s1.thermodynamic_forces.data(),
+          m2.s1.internal_state_variables.data(), m2.K.data()}) {
+      success = check(isAligned(p, 64), "invalid alignment") && success;
+    }
+    const auto nt = static_cast<size_type>(m1.s1.thermodynamic_forces.size());
+    for (size_type idx = 0; idx != nt; ++idx) {
+      const auto s1 = m1.s1.thermodynamic_forces[idx];
+      const auto s2 = m2.s1.thermodynamic_forces[idx];
+      success = check(std::abs(s1 - s2) < 1.e-8 * (1 + std::abs(s1)),
+                      "results differ from the default allocation") &&
+                success;
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
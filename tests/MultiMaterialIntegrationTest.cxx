@@ -0,0 +1,122 @@
+/*!
+ * \file   MultiMaterialIntegrationTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <memory>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include "MGIS/Raise.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << "MultiMaterialIntegrationTest: " << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+//! \brief initialize the gradients of the given material data manager
+static void initialize(mgis::behaviour::MaterialDataManager& m) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  m.s1.external_state_variables["Temperature"] = 293.15;
+  update(m);
+  for (size_type idx = 0; idx != m.n; ++idx) {
+    m.s1.gradients[idx * m.s1.gradients_stride] = 5.e-5 * (idx + 1);
+  }
+}  // end of initialize
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  if (argc != 2) {
+    std::cerr << "MultiMaterialIntegrationTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = true;
+  try {
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    const auto sizes = std::vector<size_type>{3, 50, 17};
+    ThreadPool p(3);
+    for (const auto chunk_size : {size_type{0}, size_type{4}}) {
+      auto references = std::vector<std::unique_ptr<MaterialDataManager>>{};
+      auto materials = std::vector<std::unique_ptr<MaterialDataManager>>{};
+      auto requests = std::vector<MaterialIntegrationRequest>{};
+      auto opts = BehaviourIntegrationOptions{};
+      for (const auto n : sizes) {
+        references.push_back(std::make_unique<MaterialDataManager>(b, n));
+        materials.push_back(std::make_unique<MaterialDataManager>(b, n));
+        initialize(*(references.back()));
+        initialize(*(materials.back()));
+        if (integrate(*(references.back()), opts.integration_type, 180, 0,
+                      n) != 1) {
+          mgis::raise("MultiMaterialIntegrationTest: integration failed");
+        }
+        requests.push_back({*(materials.back()), opts, 180});
+      }
+      const auto results = integrate(p, requests, chunk_size);
+      success = check(results.size() == sizes.size(),
+                      "invalid number of results") &&
+                success;
+      for (size_type i = 0; i != sizes.size(); ++i) {
+        success = check(results[i].exit_status == 1, "integration failed") &&
+                  success;
+        if (chunk_size != 0) {
+          const auto nchunks = (sizes[i] + chunk_size - 1) / chunk_size;
+          success = check(results[i].results.size() == nchunks,
+                          "invalid number of chunks") &&
+                    success;
+        }
+        const auto& m1 = *(references[i]);
+        const auto& m2 = *(materials[i]);
+        const auto nK = static_cast<size_type>(m1.K.size());
+        for (size_type idx = 0; idx != nK; ++idx) {
+          success = check(std::abs(m1.K[idx] - m2.K[idx]) <
+                              1.e-8 * (1 + std::abs(m1.K[idx])),
+                          "results differ from the serial integration") &&
+                    success;
+        }
+        const auto nt =
+            static_cast<size_type>(m1.s1.thermodynamic_forces.size());
+        for (size_type idx = 0; idx != nt; ++idx) {
+          const auto s1 = m1.s1.thermodynamic_forces[idx];
+          const auto s2 = m2.s1.thermodynamic_forces[idx];
+          success = check(std::abs(s1 - s2) < 1.e-8 * (1 + std::abs(s1)),
+                          "results differ from the serial integration") &&
+                    success;
+        }
+      }
+    }
+    // duplicated material data managers are rejected
+    auto m = MaterialDataManager{b, 10};
+    initialize(m);
+    auto duplicated = false;
+    try {
+      integrate(p, {{m, BehaviourIntegrationOptions{}, 180},
+                    {m, BehaviourIntegrationOptions{}, 180}});
+    } catch (std::exception&) {
+      duplicated = true;
+    }
+    success = check(duplicated, "duplicated managers were not detected") &&
+              success;
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
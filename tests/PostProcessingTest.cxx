@@ -16,6 +16,7 @@
 #include <array>
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 #include <string_view>
 #include "MGIS/Behaviour/Behaviour.hxx"
 #include "MGIS/Behaviour/BehaviourData.hxx"
@@ -111,6 +112,40 @@ void call_postprocessing2(const mgis::behaviour::Behaviour& b){
   }
 } // end of call_postprocessing2
 
+void call_postprocessing3(const mgis::behaviour::Behaviour& b) {
+  using namespace mgis::behaviour;
+  constexpr auto e =
+      std::array<mgis::real, 6u>{1.3e-2, 1.2e-2, 1.4e-2, 0., 0., 0.};
+  constexpr auto e2 =
+      std::array<mgis::real, 6u>{1.2e-2, 1.3e-2, 1.4e-2, 0., 0., 0.};
+  constexpr auto eps = 10 * std::numeric_limits<mgis::real>::epsilon();
+  auto m = MaterialDataManager{b, 2u};
+  // initialize the states
+  setMaterialProperty(m.s1, "YoungModulus", 150e9);
+  setMaterialProperty(m.s1, "PoissonRatio", 0.3);
+  setExternalStateVariable(m.s1, "Temperature", 293.15);
+  update(m);
+  //
+  for (mgis::size_type i = 0; i != 6; ++i) {
+    m.s1.gradients[i] = e[i];
+    m.s1.gradients[6 + i] = e[i];
+  }
+  // the post-processing is executed right after the behaviour integration
+  auto outputs = allocatePostProcessingVariables(m, "PrincipalStrain");
+  auto opts = BehaviourIntegrationOptions{};
+  opts.integration_type = IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+  const auto requests = std::vector<PostProcessingRequest>{
+      PostProcessingRequest{"PrincipalStrain", outputs}};
+  const auto r = integrate(m, opts, 0, requests, 0, m.n);
+  if (!check(r.exit_status == 1, "integration failed")) {
+    return;
+  }
+  for (mgis::size_type i = 0; i != 3; ++i) {
+    check(std::abs(outputs[i] - e2[i]) < eps, "invalid output value");
+    check(std::abs(outputs[3 + i] - e2[i]) < eps, "invalid output value");
+  }
+}  // end of call_postprocessing3
+
 int main(const int argc, const char* const* argv) {
   using namespace mgis::behaviour;
   constexpr const auto h = Hypothesis::TRIDIMENSIONAL;
@@ -122,6 +157,7 @@ int main(const int argc, const char* const* argv) {
     check_behaviour(b, h);
     call_postprocessing(b);
     call_postprocessing2(b);
+    call_postprocessing3(b);
   } catch (std::exception& e) {
     std::cerr << e.what() << std::endl;
     return EXIT_FAILURE;
@@ -0,0 +1,106 @@
+/*!
+ * \file   ProfilingTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cstdlib>
+#include <sstream>
+#include <iostream>
+#include "MGIS/Raise.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Profiling.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << "ProfilingTest: " << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  using namespace mgis::profiling;
+  if (argc != 2) {
+    std::cerr << "ProfilingTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = true;
+  try {
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    MaterialDataManager m{b, 100};
+    m.s1.external_state_variables["Temperature"] = 293.15;
+    update(m);
+    for (size_type idx = 0; idx != m.n; ++idx) {
+      m.s1.gradients[idx * m.s1.gradients_stride] = 5.e-5 * (idx + 1);
+    }
+    const auto it = IntegrationType::INTEGRATION_NO_TANGENT_OPERATOR;
+    enableProfiling();
+    if (!isProfilingAvailable()) {
+      // nothing shall be recorded
+      success = check(!isProfilingEnabled(), "profiling shall be disabled");
+      integrate(m, it, 180, 0, m.n);
+      const auto r = getProfilingReport();
+      success = check(r.getTotal(Region::INTEGRATE).calls == 0,
+                      "no measure shall be recorded") &&
+                success;
+      return success ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+    resetProfiling();
+    if (integrate(m, it, 180, 0, m.n) != 1) {
+      mgis::raise("ProfilingTest: integration failed");
+    }
+    ThreadPool p(2);
+    if (integrate(p, m, it, 180) != 1) {
+      mgis::raise("ProfilingTest: integration failed");
+    }
+    enableProfiling(false);
+    // not recorded
+    integrate(m, it, 180, 0, m.n);
+    const auto r = getProfilingReport();
+    const auto s = r.getTotal(Region::INTEGRATE);
+    success = check(s.calls == 3, "invalid number of calls") && success;
+    success = check(s.points == 2 * m.n, "invalid number of points") && success;
+    success = check(s.failures == 0, "invalid number of failures") && success;
+    success = check((s.min_time <= s.max_time) && (s.max_time <= s.total_time),
+                    "invalid times") &&
+              success;
+    success = check(r.getTotal(Region::UPDATE_VIEW).calls == 2 * m.n,
+                    "invalid number of calls to updateView") &&
+              success;
+    success = check(r.getTotal(Region::THREAD_POOL_TASK).calls == 2,
+                    "invalid number of tasks") &&
+              success;
+    success = check(r.getTotal(Region::THREAD_POOL_QUEUE).calls == 2,
+                    "invalid number of queued tasks") &&
+              success;
+    success = check(r.getLoadImbalance(Region::THREAD_POOL_TASK) >= 0,
+                    "invalid load imbalance") &&
+              success;
+    std::ostringstream os;
+    print_json(os, r);
+    success = check(os.str().find("\"integrate\"") != std::string::npos,
+                    "invalid JSON output") &&
+              success;
+    resetProfiling();
+    success = check(getProfilingReport().getTotal(Region::INTEGRATE).calls == 0,
+                    "profiling data not reset") &&
+              success;
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
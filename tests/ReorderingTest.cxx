@@ -0,0 +1,146 @@
+/*!
+ * \file   ReorderingTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include "MGIS/Raise.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+#include "MGIS/Behaviour/Reordering.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << "ReorderingTest: " << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+static bool test_orderings() {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  auto success = true;
+  // regular 8x8 grid
+  constexpr size_type nx = 8;
+  auto coordinates = std::vector<real>{};
+  for (size_type i = 0; i != nx * nx; ++i) {
+    coordinates.push_back(static_cast<real>(i % nx));
+    coordinates.push_back(static_cast<real>(i / nx));
+  }
+  // two consecutive points along a Hilbert curve are neighbours
+  const auto p = getHilbertOrdering(coordinates, 2);
+  for (size_type k = 1; k != p.size(); ++k) {
+    const auto d = std::abs(coordinates[2 * p[k]] - coordinates[2 * p[k - 1]]) +
+                   std::abs(coordinates[2 * p[k] + 1] -
+                            coordinates[2 * p[k - 1] + 1]);
+    success = check(std::abs(d - 1) < 1.e-14, "invalid Hilbert ordering") &&
+              success;
+  }
+  const auto m = getMortonOrdering(coordinates, 2);
+  success = check((m[0] == 0) && (m[3] == nx + 1), "invalid Morton ordering") &&
+            success;
+  const auto q = getInversePermutation(p);
+  for (size_type k = 0; k != p.size(); ++k) {
+    success = check(q[p[k]] == k, "invalid inverse permutation") && success;
+  }
+  return success;
+}  // end of test_orderings
+
+static bool test_uniform_values(const char* const l) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  auto success = true;
+  const auto b = load(l, "TensorialExternalStateVariableTest",
+                      Hypothesis::TRIDIMENSIONAL);
+  MaterialDataManager m{b, 3};
+  // uniform material property stored in an external array
+  auto young = std::vector<real>{150e9};
+  m.s1.material_properties["YoungModulus"] = mgis::span<real>(young);
+  // uniform tensorial external state variable whose size is a multiple of
+  // the number of integration points
+  auto s_esv = std::vector<real>{1, 2, 3, 4, 5, 6};
+  setExternalStateVariable(m.s1, "s_esv", s_esv);
+  const auto p = std::vector<size_type>{2, 0, 1};
+  reorderIntegrationPoints(m, p);
+  success = check(young[0] == 150e9, "invalid uniform material property") &&
+            success;
+  const auto& s_esv2 = m.s1.external_state_variables.at("s_esv");
+  const auto v = std::holds_alternative<std::vector<real>>(s_esv2)
+                     ? std::get<std::vector<real>>(s_esv2)
+                     : std::vector<real>{};
+  success = check(v == s_esv, "invalid uniform external state variable") &&
+            success;
+  return success;
+}  // end of test_uniform_values
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  if (argc != 2) {
+    std::cerr << "ReorderingTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = test_orderings();
+  try {
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    MaterialDataManager m{b, 100};
+    const auto gs = m.s1.gradients_stride;
+    auto T = std::vector<real>(m.n);
+    for (size_type idx = 0; idx != m.n; ++idx) {
+      T[idx] = 293.15 + idx;
+      m.s1.gradients[idx * gs] = 5.e-5 * (idx + 1);
+    }
+    m.s1.external_state_variables["Temperature"] = T;
+    // reverse the integration points
+    auto p = std::vector<size_type>(m.n);
+    for (size_type idx = 0; idx != m.n; ++idx) {
+      p[idx] = m.n - 1 - idx;
+    }
+    reorderIntegrationPoints(m, p);
+    const auto& T2 = std::get<std::vector<real>>(
+        m.s1.external_state_variables.at("Temperature"));
+    for (size_type idx = 0; idx != m.n; ++idx) {
+      success = check(std::abs(m.s1.gradients[idx * gs] -
+                               5.e-5 * (m.n - idx)) < 1.e-14,
+                      "invalid gradients") &&
+                success;
+      success = check(std::abs(T2[idx] - T[m.n - 1 - idx]) < 1.e-14,
+                      "invalid external state variable") &&
+                success;
+    }
+    // gather the gradients in the original order
+    const auto q = getInversePermutation(p);
+    auto g = std::vector<real>(m.n * gs);
+    extractGradient(g, m.s1, "Strain", q);
+    for (size_type idx = 0; idx != m.n; ++idx) {
+      success = check(std::abs(g[idx * gs] - 5.e-5 * (idx + 1)) < 1.e-14,
+                      "invalid gather") &&
+                success;
+    }
+    try {
+      p[0] = p[1];
+      reorderIntegrationPoints(m, p);
+      success = check(false, "an invalid permutation shall be rejected") &&
+                success;
+    } catch (std::exception&) {
+    }
+    success = test_uniform_values(argv[1]) && success;
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,151 @@
+/*!
+ * \file   SharedMaterialDataManagerTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/wait.h>
+#endif /* __linux__ */
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+#include "MGIS/Behaviour/SharedMaterialDataManager.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << "SharedMaterialDataManagerTest: " << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+static bool same_values(mgis::span<const mgis::real> a,
+                        mgis::span<const mgis::real> b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (decltype(a.size()) i = 0; i != a.size(); ++i) {
+    if (std::abs(a[i] - b[i]) > 1.e-12 * (1 + std::abs(b[i]))) {
+      return false;
+    }
+  }
+  return true;
+}  // end of same_values
+
+static void setup(mgis::behaviour::MaterialDataManager& m,
+                  mgis::span<mgis::real> temperatures) {
+  using namespace mgis;
+  for (size_type idx = 0; idx != m.n; ++idx) {
+    m.s1.gradients[idx * m.s1.gradients_stride] = 5.e-5 * (1 + idx % 10);
+    temperatures[idx] = 293.15 + idx % 7;
+  }
+}  // end of setup
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  constexpr auto n = size_type{100};
+  constexpr auto dt = real{180};
+  constexpr auto nprocs = size_type{2};
+  if (argc != 2) {
+    std::cerr << "SharedMaterialDataManagerTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+#ifdef __linux__
+  auto success = true;
+  try {
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    const auto it = IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
+    // reference solution
+    auto m1 = MaterialDataManager{b, n};
+    auto temperatures = std::vector<real>(n);
+    setup(m1, temperatures);
+    setExternalStateVariable(m1.s0, "Temperature", 293.15);
+    setExternalStateVariable(m1.s1, "Temperature", temperatures);
+    integrate(m1, it, dt, 0, n);
+    // shared material data manager
+    const auto name = "mgis-test-" + std::to_string(::getpid());
+    auto sm = SharedMaterialDataManager{b, n, name};
+    auto& m2 = sm.getMaterialDataManager();
+    success = check(sm.isOwner(), "invalid owner") && success;
+    success = check(m2.n == n, "invalid number of points") && success;
+    // the temperatures are stored in the shared memory segment
+    auto& T0 = m2.s0.external_state_variables.at("Temperature");
+    auto& T1 = m2.s1.external_state_variables.at("Temperature");
+    success = check(std::holds_alternative<mgis::span<real>>(T0) &&
+                        std::holds_alternative<mgis::span<real>>(T1),
+                    "temperatures are not shared") &&
+              success;
+    for (auto& T : std::get<mgis::span<real>>(T0)) {
+      T = 293.15;
+    }
+    setup(m2, std::get<mgis::span<real>>(T1));
+    // each process integrates a range of integration points
+    auto pids = std::vector<pid_t>{};
+    for (size_type i = 0; i != nprocs; ++i) {
+      const auto pid = ::fork();
+      if (pid == 0) {
+        auto status = EXIT_FAILURE;
+        try {
+          const auto ib = i * n / nprocs;
+          const auto ie = (i + 1) * n / nprocs;
+          auto a = SharedMaterialDataManager{b, name, ib, ie};
+          auto& m3 = a.getMaterialDataManager();
+          if ((!a.isOwner()) && (a.getOffset() == ib) && (m3.n == ie - ib) &&
+              (integrate(m3, it, dt, 0, m3.n) == 1)) {
+            status = EXIT_SUCCESS;
+          }
+        } catch (...) {
+        }
+        ::_exit(status);
+      }
+      pids.push_back(pid);
+    }
+    for (const auto pid : pids) {
+      auto status = int{};
+      ::waitpid(pid, &status, 0);
+      success = check(WIFEXITED(status) && (WEXITSTATUS(status) == 0),
+                      "integration failed in a child process") &&
+                success;
+    }
+    success = check(same_values(m2.s1.thermodynamic_forces,
+                                m1.s1.thermodynamic_forces),
+                    "invalid thermodynamic forces") &&
+              success;
+    success = check(same_values(m2.s1.internal_state_variables,
+                                m1.s1.internal_state_variables),
+                    "invalid internal state variables") &&
+              success;
+    success = check(same_values(m2.K, m1.K), "invalid tangent operator") &&
+              success;
+    // an existing segment can't be created twice
+    auto error = false;
+    try {
+      SharedMaterialDataManager{b, n, name};
+    } catch (std::exception&) {
+      error = true;
+    }
+    success = check(error, "segment created twice") && success;
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+#else  /* __linux__ */
+  return EXIT_SUCCESS;
+#endif /* __linux__ */
+}  // end of main
@@ -0,0 +1,109 @@
+/*!
+ * \file   StreamingIntegrationTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/MemoryResource.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+#include "MGIS/Behaviour/StreamingIntegration.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << "StreamingIntegrationTest: " << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+static bool same_values(mgis::span<const mgis::real> a,
+                        mgis::span<const mgis::real> b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (decltype(a.size()) i = 0; i != a.size(); ++i) {
+    if (std::abs(a[i] - b[i]) > 1.e-12 * (1 + std::abs(b[i]))) {
+      return false;
+    }
+  }
+  return true;
+}  // end of same_values
+
+static void setup(mgis::behaviour::MaterialDataManager& m) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  for (size_type idx = 0; idx != m.n; ++idx) {
+    m.s1.gradients[idx * m.s1.gradients_stride] = 5.e-5 * (1 + idx % 10);
+  }
+  setExternalStateVariable(m.s0, "Temperature", 293.15);
+  setExternalStateVariable(m.s1, "Temperature", 293.15);
+}  // end of setup
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  constexpr auto n = size_type{1000};
+  constexpr auto dt = real{180};
+  if (argc != 2) {
+    std::cerr << "StreamingIntegrationTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = true;
+  try {
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    auto opts = BehaviourIntegrationOptions{};
+    opts.integration_type =
+        IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
+    // reference solution
+    auto m1 = MaterialDataManager{b, n};
+    setup(m1);
+    integrate(m1, opts, dt, 0, n);
+    // out-of-core material data managers
+    ThreadPool p(2);
+    auto r = FileBackedMemoryResource{".", 1024};
+    auto i = MaterialDataManagerInitializer{};
+    i.memory_resource = &r;
+    for (auto* const pool : {static_cast<ThreadPool*>(nullptr), &p}) {
+      auto m2 = MaterialDataManager{b, n, i};
+      setup(m2);
+      auto sopts = StreamingIntegrationOptions{};
+      sopts.window_size = 128;
+      sopts.thread_pool = pool;
+      sopts.writeback = true;
+      const auto results = integrateByWindows(m2, opts, dt, sopts);
+      success = check(results.exit_status == 1, "integration failed") &&
+                success;
+      success = check(results.results.size() == 8,
+                      "invalid number of windows") &&
+                success;
+      success = check(same_values(m2.s1.thermodynamic_forces,
+                                  m1.s1.thermodynamic_forces),
+                      "invalid thermodynamic forces") &&
+                success;
+      success = check(same_values(m2.s1.internal_state_variables,
+                                  m1.s1.internal_state_variables),
+                      "invalid internal state variables") &&
+                success;
+      success = check(same_values(m2.K, m1.K), "invalid tangent operator") &&
+                success;
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,112 @@
+/*!
+ * \file   TangentOperatorStorageTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+#include "MGIS/Behaviour/TangentOperatorStorage.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << "TangentOperatorStorageTest: " << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+static bool same_values(mgis::span<const mgis::real> a,
+                        mgis::span<const mgis::real> b,
+                        const mgis::real eps) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  auto m = mgis::real{};
+  for (const auto v : b) {
+    m = std::max(m, std::abs(v));
+  }
+  for (decltype(a.size()) i = 0; i != a.size(); ++i) {
+    if (std::abs(a[i] - b[i]) > eps * m) {
+      return false;
+    }
+  }
+  return true;
+}  // end of same_values
+
+static void setup(mgis::behaviour::MaterialDataManager& m) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  for (size_type idx = 0; idx != m.n; ++idx) {
+    m.s1.gradients[idx * m.s1.gradients_stride] = 5.e-5 * (1 + idx % 10);
+  }
+  setExternalStateVariable(m.s0, "Temperature", 293.15);
+  setExternalStateVariable(m.s1, "Temperature", 293.15);
+}  // end of setup
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  constexpr auto n = size_type{100};
+  constexpr auto dt = real{180};
+  if (argc != 2) {
+    std::cerr << "TangentOperatorStorageTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = true;
+  try {
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    const auto it = IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
+    // reference solution
+    auto m1 = MaterialDataManager{b, n};
+    setup(m1);
+    integrate(m1, it, dt, 0, n);
+    success = check(m1.K_stride == 36, "invalid stride") && success;
+    for (const auto single_precision : {false, true}) {
+      for (const auto packed_symmetric : {false, true}) {
+        auto i = MaterialDataManagerInitializer{};
+        i.tangent_operator_storage.single_precision = single_precision;
+        i.tangent_operator_storage.packed_symmetric = packed_symmetric;
+        auto m2 = MaterialDataManager{b, n, i};
+        setup(m2);
+        integrate(m2, it, dt, 0, n);
+        success = check(m2.K_stride == (packed_symmetric ? 21 : 36),
+                        "invalid stride") &&
+                  success;
+        success = check(m2.K.empty() == single_precision,
+                        "invalid array of tangent operator blocks") &&
+                  success;
+        success = check(m2.K_single_precision.empty() != single_precision,
+                        "invalid array of tangent operator blocks") &&
+                  success;
+        auto K = std::vector<real>(n * m1.K_stride);
+        getTangentOperatorBlocks(K, m2);
+        const auto eps = single_precision ? real{1e-6} : real{1e-12};
+        success = check(same_values(K, m1.K, eps),
+                        "invalid tangent operator") &&
+                  success;
+        success = check(same_values(m2.s1.thermodynamic_forces,
+                                    m1.s1.thermodynamic_forces, 1e-12),
+                        "invalid thermodynamic forces") &&
+                  success;
+      }
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}  // end of main
@@ -0,0 +1,177 @@
+/*!
+ * \file   ThreadAffinityTest.cxx
+ * \brief
+ * \author Thomas Helfer
+ * \date   18/10/2026
+ * \copyright (C) Copyright Thomas Helfer 2018.
+ * Use, modification and distribution are subject
+ * to one of the following licences:
+ * - GNU Lesser General Public License (LGPL), Version 3.0. (See accompanying
+ *   file LGPL-3.0.txt)
+ * - CECILL-C,  Version 1.0 (See accompanying files
+ *   CeCILL-C_V1-en.txt and CeCILL-C_V1-fr.txt).
+ */
+
+#include <cmath>
+#include <atomic>
+#include <vector>
+#include <thread>
+#include <cstdlib>
+#include <iostream>
+#include "MGIS/Raise.hxx"
+#include "MGIS/ThreadPool.hxx"
+#include "MGIS/Behaviour/Behaviour.hxx"
+#include "MGIS/Behaviour/MaterialDataManager.hxx"
+#include "MGIS/Behaviour/Integrate.hxx"
+
+static bool check(const bool b, const char* const msg) {
+  if (!b) {
+    std::cerr << "ThreadAffinityTest: " << msg << '\n';
+  }
+  return b;
+}  // end of check
+
+static bool test_thread_pool() {
+  using namespace mgis;
+  auto success = true;
+  for (const auto a : {ThreadAffinityPolicy::NONE,
+                       ThreadAffinityPolicy::COMPACT,
+                       ThreadAffinityPolicy::SCATTER}) {
+    ThreadPool p(3, a);
+    success = check(p.getThreadAffinityPolicy() == a,
+                    "invalid thread affinity policy") &&
+              success;
+    success = check(!p.isWorkerThread(),
+                    "the main thread is not a worker thread") &&
+              success;
+    if (a == ThreadAffinityPolicy::NONE) {
+      for (size_type i = 0; i != p.getNumberOfThreads(); ++i) {
+        success = check(p.getThreadProcessingUnit(i) == -1,
+                        "unexpected bound thread") &&
+                  success;
+      }
+    }
+    // tasks added to a given thread are always executed by this thread
+    auto ids = std::vector<std::thread::id>(p.getNumberOfThreads());
+    for (size_type i = 0; i != p.getNumberOfThreads(); ++i) {
+      auto r = p.addTaskToThread(i, [&p] {
+        if (!p.isWorkerThread()) {
+          mgis::raise("the task is not executed by a worker thread");
+        }
+        return std::this_thread::get_id();
+      });
+      ids[i] = *(r.get());
+    }
+    std::atomic<int> counter = 0;
+    for (int k = 0; k != 10; ++k) {
+      for (size_type i = 0; i != p.getNumberOfThreads(); ++i) {
+        p.addTaskToThread(i, [&ids, &counter, i] {
+          if (std::this_thread::get_id() != ids[i]) {
+            mgis::raise("the task is not executed by the expected thread");
+          }
+          ++counter;
+        });
+      }
+    }
+    p.wait();
+    success = check(counter == 30, "some tasks were not executed") && success;
+  }
+  return success;
+}  // end of test_thread_pool
+
+static bool test_initialize_values_in_parallel() {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  auto success = true;
+  ThreadPool p(3, ThreadAffinityPolicy::COMPACT);
+  auto values = std::vector<real>(7 * 6, real{1});
+  initializeValuesInParallel(p, values, 7);
+  for (const auto v : values) {
+    success = check(v == 0, "invalid value") && success;
+  }
+  return success;
+}  // end of test_initialize_values_in_parallel
+
+int main(const int argc, const char* const* argv) {
+  using namespace mgis;
+  using namespace mgis::behaviour;
+  if (argc != 2) {
+    std::cerr << "ThreadAffinityTest: invalid number of arguments\n";
+    std::exit(-1);
+  }
+  auto success = test_thread_pool();
+  success = test_initialize_values_in_parallel() && success;
+  try {
+    const auto b = load(argv[1], "Norton", Hypothesis::TRIDIMENSIONAL);
+    ThreadPool p(3, ThreadAffinityPolicy::COMPACT);
+    auto i = MaterialDataManagerInitializer{};
+    i.thread_pool = &p;
+    MaterialDataManager m1{b, 100};
+    MaterialDataManager m2{b, 100, i};
+    MaterialDataManager m3{b, 100};
+    for (const auto v : m2.s1.internal_state_variables) {
+      success = check(v == 0, "invalid initial value") && success;
+    }
+    for (auto* const m : {&m1, &m2, &m3}) {
+      m->s1.external_state_variables["Temperature"] = 293.15;
+      update(*m);
+      for (size_type idx = 0; idx != m->n; ++idx) {
+        m->s1.gradients[idx * m->s1.gradients_stride] = 5.e-5 * (idx + 1);
+      }
+    }
+    auto opts = BehaviourIntegrationOptions{};
+    opts.integration_type =
+        IntegrationType::INTEGRATION_CONSISTENT_TANGENT_OPERATOR;
+    if (integrate(m1, opts.integration_type, 180, 0, m1.n) != 1) {
+      mgis::raise("ThreadAffinityTest: integration failed");
+    }
+    // the tangent operator blocks are allocated using the thread pool
+    if (integrate(p, m2, opts, 180).exit_status != 1) {
+      mgis::raise("ThreadAffinityTest: integration failed");
+    }
+    const auto nt = static_cast<size_type>(m1.s1.thermodynamic_forces.size());
+    for (size_type idx = 0; idx != nt; ++idx) {
+      const auto s1 = m1.s1.thermodynamic_forces[idx];
+      const auto s2 = m2.s1.thermodynamic_forces[idx];
+      success = check(std::abs(s1 - s2) < 1.e-8 * (1 + std::abs(s1)),
+                      "results differ from the serial integration") &&
+                success;
+    }
+    const auto nK = static_cast<size_type>(m1.K.size());
+    for (size_type idx = 0; idx != nK; ++idx) {
+      const auto K1 = m1.K[idx];
+      const auto K2 = m2.K[idx];
+      success = check(std::abs(K1 - K2) < 1.e-8 * (1 + std::abs(K1)),
+                      "tangent operators differ from the serial integration") &&
+                success;
+    }
+    // integrations started by a task executed by a thread of the pool. The
+    // tasks can't be dedicated to the calling thread, which would wait for
+    // itself.
+    auto r3 = p.addTaskToThread(1, [&p, &m3, &opts] {
+      return integrate(p, m3, opts, 180).exit_status;
+    });
+    success = check(*(r3.get()) == 1,
+                    "integration from a worker thread failed") &&
+              success;
+    auto r4 = p.addTaskToThread(1, [&p, &m3, &opts] {
+      const auto requests =
+          std::vector<MaterialIntegrationRequest>{{m3, opts, 180}};
+      return integrate(p, requests).front().exit_status;
+    });
+    success = check(*(r4.get()) == 1,
+                    "integration from a worker thread failed") &&
+              success;
+    for (size_type idx = 0; idx != nt; ++idx) {
+      const auto s1 = m1.s1.thermodynamic_forces[idx];
+      const auto s3 = m3.s1.thermodynamic_forces[idx];
+      success = check(std::abs(s1 - s3) < 1.e-8 * (1 + std::abs(s1)),
+                      "results differ from the serial integration") &&
+                success;
+    }
+  } catch (std::exception& e) {
+    std::cerr << e.what() << '\n';
+    return EXIT_FAILURE;
+  }
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}